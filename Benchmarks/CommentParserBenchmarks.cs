@@ -0,0 +1,184 @@
+using BenchmarkDotNet.Attributes;
+using BenchmarkDotNet.Columns;
+using BenchmarkDotNet.Configs;
+using BenchmarkDotNet.Reports;
+using BenchmarkDotNet.Running;
+using System;
+using System.IO;
+using System.Linq;
+using System.Text;
+using VSDoxyHighlighter.Tests;
+
+namespace VSDoxyHighlighter.Benchmarks
+{
+  /// <summary>
+  /// Benchmarks for the main parsing hot path, i.e. CommentParser.Parse(). The tests in the "Tests"
+  /// project only verify correctness; these benchmarks exist to quantify performance regressions
+  /// (compare the results on the main branch with the results of the pull request).
+  ///
+  /// Two corpora are used:
+  /// - A "mixed" corpus built from the test input files, i.e. realistic comments with a typical
+  ///   density of Doxygen commands and markdown.
+  /// - An "overlap heavy" corpus where almost every line produces several overlapping fragment
+  ///   groups (markdown nested in titles, etc.). This stresses the filtering of overlapping groups
+  ///   via the NonOverlappingCommandGroupsComparer at the end of Parse(). The comparer is private
+  ///   to CommentParser, so it gets exercised through Parse() rather than directly.
+  ///
+  /// Besides the usual timings, the summary reports the p99 latency, the throughput in MB/s and
+  /// (via the MemoryDiagnoser) the allocations per parse.
+  /// </summary>
+  [MemoryDiagnoser]
+  [Config(typeof(Config))]
+  public class CommentParserBenchmarks
+  {
+    // Roughly: a single comment, a large file worth of comments, and a pathologically large file.
+    [Params(1_000, 100_000, 5_000_000)]
+    public int CorpusSizeInBytes;
+
+    [GlobalSetup]
+    public void Setup()
+    {
+      mParser = new CommentParser(new DoxygenCommands(new GeneralOptionsFake()));
+      mMixedCorpus = BuildCorpus(ReadAllTestInputFiles(), CorpusSizeInBytes);
+      mOverlapCorpus = BuildCorpus(cOverlapHeavyComment, CorpusSizeInBytes);
+    }
+
+    [Benchmark]
+    public int ParseMixedComments()
+    {
+      // Count() forces the enumeration, and returning it prevents dead code elimination.
+      return mParser.Parse(mMixedCorpus).Count();
+    }
+
+    [Benchmark]
+    public int ParseOverlapHeavyComments()
+    {
+      return mParser.Parse(mOverlapCorpus).Count();
+    }
+
+
+    private static string ReadAllTestInputFiles()
+    {
+      var builder = new StringBuilder();
+      foreach (string file in Directory.EnumerateFiles("InputFiles", "*.cpp").OrderBy(f => f)) {
+        builder.Append(File.ReadAllText(file));
+        builder.Append("\n");
+      }
+      return builder.ToString();
+    }
+
+    /// <summary>
+    /// Repeats and truncates the given "seed" text so that the result has exactly the requested size.
+    /// Truncation happens at a line break, so that we do not benchmark the parsing of a comment that
+    /// got cut in half (the size is off by at most one line, which does not matter for the statistics).
+    /// </summary>
+    private static string BuildCorpus(string seed, int sizeInBytes)
+    {
+      var builder = new StringBuilder(sizeInBytes + seed.Length);
+      while (builder.Length < sizeInBytes) {
+        builder.Append(seed);
+      }
+      int lastLineBreak = sizeInBytes;
+      while (lastLineBreak > 0 && builder[lastLineBreak - 1] != '\n') {
+        --lastLineBreak;
+      }
+      return builder.ToString(0, lastLineBreak > 0 ? lastLineBreak : sizeInBytes);
+    }
+
+    private class Config : ManualConfig
+    {
+      public Config()
+      {
+        AddColumn(new PercentileColumn(99));
+        AddColumn(new ThroughputColumn());
+      }
+    }
+
+    private const string cOverlapHeavyComment =
+        "/// @par Some title with @b bold and `inline code` and **stars**\n"
+      + "/// @brief Nested _underscores_ and *stars* and @ref someRef \"with `code` inside\"\n"
+      + "/// @note More **bold** with @p param and `yet more code` and ~~strikethrough~~\n";
+
+    private CommentParser mParser;
+    private string mMixedCorpus;
+    private string mOverlapCorpus;
+  }
+
+
+  /// <summary>
+  /// Reports an arbitrary percentile of the measured times. BenchmarkDotNet itself only comes with
+  /// predefined columns for a few percentiles (and p99 is not among them).
+  /// </summary>
+  internal class PercentileColumn : IColumn
+  {
+    public PercentileColumn(int percentile)
+    {
+      mPercentile = percentile;
+    }
+
+    public string Id => "Percentile" + mPercentile;
+    public string ColumnName => "P" + mPercentile;
+    public bool AlwaysShow => true;
+    public ColumnCategory Category => ColumnCategory.Statistics;
+    public int PriorityInCategory => 0;
+    public bool IsNumeric => true;
+    public UnitType UnitType => UnitType.Time;
+    public string Legend => $"Percentile {mPercentile} of all measurements";
+    public bool IsDefault(Summary summary, BenchmarkCase benchmarkCase) => false;
+    public bool IsAvailable(Summary summary) => true;
+
+    public string GetValue(Summary summary, BenchmarkCase benchmarkCase)
+    {
+      return GetValue(summary, benchmarkCase, summary.Style);
+    }
+
+    public string GetValue(Summary summary, BenchmarkCase benchmarkCase, SummaryStyle style)
+    {
+      var statistics = summary[benchmarkCase]?.ResultStatistics;
+      if (statistics == null) {
+        return "-";
+      }
+      double valueInNs = statistics.Percentiles.Percentile(mPercentile);
+      return (valueInNs / 1000000.0).ToString("0.000") + " ms";
+    }
+
+    private readonly int mPercentile;
+  }
+
+
+  /// <summary>
+  /// Computes the parse throughput in MB/s from the mean time and the "CorpusSizeInBytes" parameter
+  /// of the benchmark. The main use is to compare the large corpora against each other, where the
+  /// absolute times are hard to interpret at a glance.
+  /// </summary>
+  internal class ThroughputColumn : IColumn
+  {
+    public string Id => "ThroughputMBPerSec";
+    public string ColumnName => "MB/s";
+    public bool AlwaysShow => true;
+    public ColumnCategory Category => ColumnCategory.Custom;
+    public int PriorityInCategory => 0;
+    public bool IsNumeric => true;
+    public UnitType UnitType => UnitType.Dimensionless;
+    public string Legend => "Parsed megabytes per second, computed from the mean time and the corpus size";
+    public bool IsDefault(Summary summary, BenchmarkCase benchmarkCase) => false;
+    public bool IsAvailable(Summary summary) => true;
+
+    public string GetValue(Summary summary, BenchmarkCase benchmarkCase)
+    {
+      return GetValue(summary, benchmarkCase, summary.Style);
+    }
+
+    public string GetValue(Summary summary, BenchmarkCase benchmarkCase, SummaryStyle style)
+    {
+      var statistics = summary[benchmarkCase]?.ResultStatistics;
+      object sizeParam = benchmarkCase.Parameters["CorpusSizeInBytes"];
+      if (statistics == null || sizeParam == null) {
+        return "-";
+      }
+      double meanInSeconds = statistics.Mean / 1e9;
+      double sizeInMB = Convert.ToDouble(sizeParam) / (1024.0 * 1024.0);
+      return (sizeInMB / meanInSeconds).ToString("0.00");
+    }
+  }
+}
@@ -0,0 +1,15 @@
+using BenchmarkDotNet.Running;
+
+namespace VSDoxyHighlighter.Benchmarks
+{
+  // Run from the command line via:
+  //   Benchmarks.exe --filter *
+  // Use "--filter *Parse*" etc. to run a subset of the benchmarks.
+  internal class Program
+  {
+    static void Main(string[] args)
+    {
+      BenchmarkSwitcher.FromAssembly(typeof(Program).Assembly).Run(args);
+    }
+  }
+}
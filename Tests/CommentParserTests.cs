@@ -1195,5 +1195,54 @@ namespace VSDoxyHighlighter.Tests
       CollectionAssert.AreEqual(expectedTextFragments, actualTextFragments);
     }
 
+
+    [TestMethod()]
+    public void LargeTextShouldBeParsedTheSameAsManySmallTexts()
+    {
+      var formatter = Utils.CreateDefaultCommentParser();
+
+      // One self-contained comment block, to be repeated until the text is large enough to take the
+      // parallel parsing path in Parse() (i.e. more than 32 KB). The block deliberately contains a
+      // "\qualifier" whose quoted parameter spans two lines: The parallel parse must not place a partition
+      // boundary inside such a parameter, since the partition before the boundary would miss the closing
+      // quote and thus not match the command, unlike a serial parse. With the block repeated over and over,
+      // the initial partition boundary candidates are likely to fall into such a parameter, exercising the
+      // seam-shifting logic.
+      string unit =
+          "/// @brief Some brief description in every repetition of the block.\n"
+        + "/// @param[in] someParam The parameter that gets documented here.\n"
+        + "/// Some **bold** text and `inline code` to cover the markdown matchers.\n"
+        + "/// \\qualifier \"a quoted parameter which\n"
+        + "/// spans to the following line to make partition boundaries risky\"\n"
+        + "/// @note Also a note, so that several matchers find something.\n"
+        + "/// Plain filler line without any commands at the end of the block.\n";
+
+      var unitFragments = Utils.ToFlatFragmentList(formatter.Parse(unit));
+      Assert.IsTrue(unitFragments.Count > 0);
+      // Sanity check that the quoted parameter of the "\qualifier" really got matched across the two lines.
+      Assert.IsTrue(unitFragments.Any(f => unit.Substring(f.StartIndex, f.Length).Contains("\n")));
+
+      int numRepetitions = (64 * 1024) / unit.Length + 1;
+      var largeTextBuilder = new StringBuilder(numRepetitions * unit.Length);
+      for (int rep = 0; rep < numRepetitions; ++rep) {
+        largeTextBuilder.Append(unit);
+      }
+      string largeText = largeTextBuilder.ToString();
+      Assert.IsTrue(largeText.Length > 2 * 32 * 1024);
+
+      // Since each block is self-contained (especially, all quotes are closed within it), a serial parse of
+      // the large text finds exactly the fragments of a single block, repeated with shifted positions. The
+      // parallel parse must produce the identical result.
+      var expectedFragments = new List<FormattedFragment>();
+      for (int rep = 0; rep < numRepetitions; ++rep) {
+        foreach (FormattedFragment f in unitFragments) {
+          expectedFragments.Add(new FormattedFragment(f.StartIndex + rep * unit.Length, f.Length, f.Classification));
+        }
+      }
+
+      var actualFragments = Utils.ToFlatFragmentList(formatter.Parse(largeText));
+      CollectionAssert.AreEqual(expectedFragments, actualFragments);
+    }
+
   }
 }
@@ -0,0 +1,76 @@
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+using System.Linq;
+
+namespace VSDoxyHighlighter.Tests
+{
+  // Tests for the commands that got extracted from the Doxygen help page and that are stored as binary
+  // resource in the VSDoxyHighlighter assembly. Since the resource gets read lazily at runtime, a mistake
+  // in the generation script or in the reader would otherwise surface only once a user hovers over or
+  // autocompletes the affected command in Visual Studio.
+  [TestClass()]
+  public class DoxygenHelpPageCommandsTests
+  {
+    // Touching cCommands forces the static initialization, i.e. the reading of the index of the binary
+    // resource. The counts and the concrete first and last command need to be adapted whenever the
+    // resource gets regenerated from a new version of the Doxygen help page.
+    [TestMethod()]
+    public void CommandsShouldGetLoadedFromTheBinaryResource()
+    {
+      DoxygenHelpPageCommand[] commands = DoxygenCommandsGeneratedFromHelpPage.cCommands;
+
+      Assert.AreEqual(217, commands.Length);
+      Assert.AreEqual("addtogroup", commands[0].Command);
+      Assert.AreEqual("https://www.doxygen.nl/manual/commands.html#cmdaddtogroup", commands[0].Hyperlink);
+      Assert.AreEqual("---", commands[commands.Length - 1].Command);
+    }
+
+
+    // Forces the deserialization of every single description, so that a malformed offset or fragment
+    // record in the binary resource fails here instead of at runtime in Visual Studio.
+    [TestMethod()]
+    public void EveryDescriptionShouldDeserializeSuccessfully()
+    {
+      foreach (DoxygenHelpPageCommand command in DoxygenCommandsGeneratedFromHelpPage.cCommands) {
+        (object type, string text, string hyperlink)[] description = command.Description;
+
+        Assert.IsNotNull(description, $"Command '{command.Command}' has no description.");
+        Assert.IsTrue(description.Length > 0, $"Command '{command.Command}' has an empty description.");
+        foreach ((object type, string text, string hyperlink) fragment in description) {
+          Assert.IsNotNull(fragment.text);
+          Assert.IsTrue(
+            fragment.type == null
+              || fragment.type is ClassificationEnum
+              || (fragment.type is DoxygenHelpPageCommand.OtherTypesEnum otherType
+                  && otherType == DoxygenHelpPageCommand.OtherTypesEnum.Command),
+            $"Command '{command.Command}' has a fragment with unknown type '{fragment.type}'.");
+        }
+
+        // Accessing the description again must return the cached array instead of deserializing anew.
+        Assert.AreSame(description, command.Description);
+      }
+    }
+
+
+    // The amended list additionally contains the command variations (e.g. "param[in]" for "param") and the
+    // manually added commands; its descriptions must be available, too.
+    [TestMethod()]
+    public void AmendedCommandsShouldProvideDescriptions()
+    {
+      var amendedCommands = AllDoxygenHelpPageCommands.cAmendedDoxygenCommands;
+
+      Assert.IsTrue(amendedCommands.Count > DoxygenCommandsGeneratedFromHelpPage.cCommands.Length);
+      Assert.AreEqual("param", amendedCommands[0].Command); // Specially ordered commands come first.
+      Assert.IsTrue(amendedCommands.Any(cmd => cmd.Command == "{"));
+
+      foreach (DoxygenHelpPageCommand command in amendedCommands) {
+        Assert.IsTrue(command.Description.Length > 0, $"Command '{command.Command}' has an empty description.");
+      }
+
+      // A variation shares the description with its original command, i.e. causes no additional
+      // deserialization of the resource.
+      DoxygenHelpPageCommand paramCommand = amendedCommands.Find(cmd => cmd.Command == "param");
+      DoxygenHelpPageCommand paramInCommand = amendedCommands.Find(cmd => cmd.Command == "param[in]");
+      Assert.AreSame(paramCommand.Description, paramInCommand.Description);
+    }
+  }
+}
@@ -8,8 +8,14 @@ namespace VSDoxyHighlighter.Tests
   internal class GeneralOptionsFake : IGeneralOptions
   {
     public bool EnableHighlighting { get; } = true;
+    public bool EnableMarkdownHighlighting { get; } = true;
     public bool EnableAutocomplete { get; } = true;
     public bool EnableQuickInfo { get; } = true;
+    public bool EnableParsingInBackground { get; } = false;
+    public bool EnableWholeDocumentPreWarm { get; } = false;
+    public bool EnablePersistentHighlightCache { get; } = false;
+    public bool EnablePerformanceLogging { get; } = false;
+    public int CacheMemoryBudgetMB { get; } = 50;
 
     public bool EnableParameterAutocompleteFor_param { get; } = true;
     public bool EnableParameterAutocompleteFor_tparam { get; } = true;
@@ -0,0 +1,146 @@
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+using Microsoft.VisualStudio.Text;
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+
+namespace VSDoxyHighlighter.Tests
+{
+  [TestClass()]
+  public class PersistentHighlightCacheTests
+  {
+    [TestInitialize()]
+    public void Initialize()
+    {
+      // Redirect the sidecar files to a fresh temporary directory, so that the tests neither touch nor
+      // depend on the cache of an actual Visual Studio installation on the machine running the tests.
+      mTestCacheDirectory = Path.Combine(Path.GetTempPath(), "VSDoxyHighlighterTests_" + Guid.NewGuid().ToString("N"));
+      PersistentHighlightCache.CacheDirectoryOverride = mTestCacheDirectory;
+    }
+
+    [TestCleanup()]
+    public void Cleanup()
+    {
+      PersistentHighlightCache.CacheDirectoryOverride = null;
+      try {
+        Directory.Delete(mTestCacheDirectory, recursive: true);
+      }
+      catch (IOException) {
+      }
+    }
+
+
+    [TestMethod()]
+    public void SaveThenLoadShouldRestoreTheIdenticalEntries()
+    {
+      List<KeyValuePair<Span, List<FormattedFragmentGroup>>> savedEntries = CreateTestEntries();
+      PersistentHighlightCache.Save(cDocumentFilePath, cDocumentText, cConfigHash, savedEntries);
+
+      Dictionary<Span, List<FormattedFragmentGroup>> loadedEntries
+        = PersistentHighlightCache.TryLoad(cDocumentFilePath, cDocumentText, cConfigHash);
+
+      Assert.IsNotNull(loadedEntries);
+      Assert.AreEqual(savedEntries.Count, loadedEntries.Count);
+      foreach (KeyValuePair<Span, List<FormattedFragmentGroup>> savedEntry in savedEntries) {
+        Assert.IsTrue(loadedEntries.ContainsKey(savedEntry.Key));
+        List<FormattedFragmentGroup> loadedGroups = loadedEntries[savedEntry.Key];
+        Assert.AreEqual(savedEntry.Value.Count, loadedGroups.Count);
+        for (int groupIdx = 0; groupIdx < savedEntry.Value.Count; ++groupIdx) {
+          // FormattedFragment is a struct, so CollectionAssert compares the actual fragment values.
+          CollectionAssert.AreEqual(
+            savedEntry.Value[groupIdx].Fragments.ToList(), loadedGroups[groupIdx].Fragments.ToList());
+        }
+      }
+    }
+
+
+    [TestMethod()]
+    public void LoadWithoutPriorSaveShouldReturnNull()
+    {
+      Assert.IsNull(PersistentHighlightCache.TryLoad(cDocumentFilePath, cDocumentText, cConfigHash));
+    }
+
+
+    [TestMethod()]
+    public void LoadOfTruncatedCacheFileShouldReturnNull()
+    {
+      PersistentHighlightCache.Save(cDocumentFilePath, cDocumentText, cConfigHash, CreateTestEntries());
+
+      // Simulate a half-written or otherwise corrupted sidecar file by cutting off its end. Every possible
+      // truncation must get rejected, regardless of which part of the format it destroys.
+      string cacheFilePath = GetSingleCacheFile();
+      byte[] fullContent = File.ReadAllBytes(cacheFilePath);
+      foreach (int truncatedLength in new int[] { 0, 1, fullContent.Length / 2, fullContent.Length - 1 }) {
+        File.WriteAllBytes(cacheFilePath, fullContent.Take(truncatedLength).ToArray());
+        Assert.IsNull(PersistentHighlightCache.TryLoad(cDocumentFilePath, cDocumentText, cConfigHash),
+          $"Truncation to {truncatedLength} of {fullContent.Length} bytes was not rejected.");
+      }
+    }
+
+
+    [TestMethod()]
+    public void LoadWithDifferentConfigHashShouldReturnNull()
+    {
+      PersistentHighlightCache.Save(cDocumentFilePath, cDocumentText, cConfigHash, CreateTestEntries());
+      Assert.IsNull(PersistentHighlightCache.TryLoad(cDocumentFilePath, cDocumentText, cConfigHash + 1));
+    }
+
+
+    [TestMethod()]
+    public void LoadWithEditedDocumentContentShouldReturnNull()
+    {
+      PersistentHighlightCache.Save(cDocumentFilePath, cDocumentText, cConfigHash, CreateTestEntries());
+
+      // Edit that changes the document length.
+      Assert.IsNull(PersistentHighlightCache.TryLoad(cDocumentFilePath, cDocumentText + "int i;\n", cConfigHash));
+
+      // Edit that keeps the document length, so that only the content hash can detect it.
+      string editedText = cDocumentText.Replace("@brief", "@param");
+      Assert.AreEqual(cDocumentText.Length, editedText.Length);
+      Assert.IsNull(PersistentHighlightCache.TryLoad(cDocumentFilePath, editedText, cConfigHash));
+
+      // The unchanged document must still load successfully, i.e. the rejections above did not
+      // accidentally come from an entirely broken sidecar file.
+      Assert.IsNotNull(PersistentHighlightCache.TryLoad(cDocumentFilePath, cDocumentText, cConfigHash));
+    }
+
+
+    // Classification results as the colorer would save them: one entry per comment span, each with some
+    // fragment groups. The concrete values are arbitrary, but all indices lie within cDocumentText.
+    private List<KeyValuePair<Span, List<FormattedFragmentGroup>>> CreateTestEntries()
+    {
+      return new List<KeyValuePair<Span, List<FormattedFragmentGroup>>> {
+        new KeyValuePair<Span, List<FormattedFragmentGroup>>(
+          new Span(0, 30),
+          new List<FormattedFragmentGroup> {
+            new FormattedFragmentGroup(new List<FormattedFragment> {
+              new FormattedFragment(4, 6, ClassificationEnum.Command),
+              new FormattedFragment(11, 9, ClassificationEnum.Title),
+            }),
+            new FormattedFragmentGroup(new FormattedFragment(22, 6, ClassificationEnum.EmphasisMinor)),
+          }),
+        new KeyValuePair<Span, List<FormattedFragmentGroup>>(
+          new Span(32, 20),
+          new List<FormattedFragmentGroup> {
+            new FormattedFragmentGroup(new FormattedFragment(36, 5, ClassificationEnum.Note)),
+          }),
+      };
+    }
+
+
+    private string GetSingleCacheFile()
+    {
+      string[] cacheFiles = Directory.GetFiles(mTestCacheDirectory, "*.vsdhc");
+      Assert.AreEqual(1, cacheFiles.Length);
+      return cacheFiles[0];
+    }
+
+
+    private const string cDocumentFilePath = @"C:\SomeDirectory\SomeFile.cpp";
+    private const string cDocumentText = "/// @brief Some text *itali* \n/// @note again\n more \n";
+    private const int cConfigHash = 123456789;
+
+    private string mTestCacheDirectory;
+  }
+}
@@ -54,6 +54,132 @@ namespace VSDoxyHighlighter
   }
 
 
+  //================================================================================
+  // CommentCommandParameterPreFetcher
+  //================================================================================
+
+  [Export(typeof(IWpfTextViewCreationListener))]
+  [ContentType("C/C++")]
+  [TextViewRole(PredefinedTextViewRoles.Editable)]
+  class CommentCommandParameterPreFetcherProvider : IWpfTextViewCreationListener
+  {
+    [Import]
+    private IVsEditorAdaptersFactoryService mAdapterService = null;
+
+    public void TextViewCreated(IWpfTextView textView)
+    {
+      // The pre-fetcher unsubscribes itself when the view gets closed, so we don't need to keep a reference.
+      new CommentCommandParameterPreFetcher(mAdapterService, textView);
+    }
+  }
+
+
+  /// <summary>
+  /// Speculatively resolves the information needed for the parameter autocompletion ("\param", "\tparam",
+  /// "\p" and "\a") while the caret idles inside a comment. The first query for a given location hits the
+  /// slow COM based FileCodeModel (compare CppFileSemanticsFromVSCodeModelAndCache), which makes the first
+  /// "\param" popup in a file noticeably laggy when everything is done on demand. So, when the caret rests
+  /// in a comment for a moment, we run the same queries that the completion would run, thereby filling the
+  /// cache of CachedVisualStudioCppFileSemantics. If the user then actually triggers the completion, the
+  /// result gets served from the cache with near-zero work on the main thread.
+  /// One instance exists per text view; it dies together with the view.
+  /// </summary>
+  class CommentCommandParameterPreFetcher
+  {
+    public CommentCommandParameterPreFetcher(IVsEditorAdaptersFactoryService adapterService, ITextView textView)
+    {
+      mAdapterService = adapterService;
+      mTextView = textView;
+      mTextView.Caret.PositionChanged += OnCaretPositionChanged;
+      mTextView.Closed += OnTextViewClosed;
+    }
+
+
+    private void OnTextViewClosed(object sender, EventArgs e)
+    {
+      mTextView.Caret.PositionChanged -= OnCaretPositionChanged;
+      mTextView.Closed -= OnTextViewClosed;
+    }
+
+
+    private void OnCaretPositionChanged(object sender, CaretPositionChangedEventArgs e)
+    {
+      ++mCaretGeneration;
+      if (mPreFetchTaskRuns) {
+        return;
+      }
+      mPreFetchTaskRuns = true;
+
+      _ = ThreadHelper.JoinableTaskFactory.RunAsync(async () => {
+        try {
+          // Wait until the caret did not move for a while. Every caret movement restarts the wait, so we do
+          // not cause any work while the user is typing or navigating around.
+          int generationBeforeDelay;
+          do {
+            generationBeforeDelay = mCaretGeneration;
+            await Task.Delay(cCaretIdleDelayInMs);
+          } while (generationBeforeDelay != mCaretGeneration);
+
+          await ThreadHelper.JoinableTaskFactory.SwitchToMainThreadAsync();
+          if (!mTextView.IsClosed) {
+            TryPreFetchAtCaret();
+          }
+        }
+        finally {
+          mPreFetchTaskRuns = false;
+        }
+      });
+    }
+
+
+    private void TryPreFetchAtCaret()
+    {
+      ThreadHelper.ThrowIfNotOnUIThread();
+
+      IGeneralOptions options = VSDoxyHighlighterPackage.GeneralOptions;
+      if (!options.EnableAutocomplete
+          || !(options.EnableParameterAutocompleteFor_param
+               || options.EnableParameterAutocompleteFor_tparam
+               || options.EnableParameterAutocompleteFor_p_a)) {
+        return;
+      }
+
+      SnapshotPoint caretPoint = mTextView.Caret.Position.BufferPosition;
+
+      // Only pre-fetch when the caret rests in a comment for which the autocomplete is enabled. That is the
+      // only place from which the completion can ask for the information later.
+      CommentClassifier commentClassifier = CommentCommandCompletionSource.TryGetCommentClassifier(mTextView.TextBuffer);
+      if (commentClassifier == null) {
+        return;
+      }
+      CommentType? commentType = commentClassifier.CommentExtractor.GetTypeOfCommentBeforeLocation(caretPoint);
+      if (commentType == null || !options.IsEnabledInCommentType(commentType.Value)) {
+        return;
+      }
+
+      // Run the same queries that TryGetParametersOfNextCodeElementAsync() and
+      // TryGetTemplateParametersOfNextCodeElementAsync() will run later. The results (including negative
+      // ones) get stashed in the cache of CachedVisualStudioCppFileSemantics, which is keyed per line, so
+      // the later completion point hits the cache although it is not exactly the caret position.
+      var cppFileSemantics = CachedVisualStudioCppFileSemantics.GetOrCreate(mAdapterService, mTextView.TextBuffer);
+      FunctionInfo funcInfo = cppFileSemantics.TryGetFunctionInfoIfNextIsAFunction(caretPoint);
+      if (funcInfo == null) {
+        cppFileSemantics.TryGetMacroInfoIfNextIsAMacro(caretPoint);
+        cppFileSemantics.TryGetClassInfoIfNextIsATemplateClassOrAlias(caretPoint);
+      }
+    }
+
+
+    private const int cCaretIdleDelayInMs = 500;
+
+    private readonly IVsEditorAdaptersFactoryService mAdapterService;
+    private readonly ITextView mTextView;
+
+    private int mCaretGeneration = 0;
+    private bool mPreFetchTaskRuns = false;
+  }
+
+
   /// <summary>
   /// Defines when the autocomplete box should appear as well as its content.
   /// Note: The instance is reused for every autocomplete operation in the same text view.
@@ -162,8 +288,11 @@ namespace VSDoxyHighlighter
         char startChar = startPoint.GetChar();
         // '\' and '@' start a command.
         if (startChar == '\\' || startChar == '@') {
-          itemsBuilder = PopulateAutcompleteBoxWithCommands(startChar);
           session.Properties.AddProperty(typeof(CompletionTarget), CompletionTarget.Command);
+          // The items for the Doxygen commands are the same for every completion session and every text
+          // view. So, instead of constructing the ~200 items again every time the user types a "\" or "@",
+          // a shared list gets constructed once and reused. See GetOrCreateSharedCommandItems().
+          return new CompletionContext(GetOrCreateSharedCommandItems(startChar), null);
         }
         // If the user typed a whitespace, we check whether it happend after a Doxygen command for which we
         // support autocompletion of the command's parameter, and if yes, populate the autocomplete box with possible parameter values.
@@ -229,7 +358,7 @@ namespace VSDoxyHighlighter
     }
 
 
-    CommentClassifier TryGetCommentClassifier(ITextBuffer textBuffer)
+    public static CommentClassifier TryGetCommentClassifier(ITextBuffer textBuffer)
     {
       // The CommentClassifier got created by Visual Studio via CommentClassifierProvider.GetClassifier() when the text
       // buffer got created.
@@ -241,7 +370,106 @@ namespace VSDoxyHighlighter
     }
 
 
-      private ImmutableArray<CompletionItem>.Builder PopulateAutcompleteBoxWithCommands(char startChar)
+    /// <summary>
+    /// Returns the completion items for all Doxygen commands, where each display text starts with the given
+    /// <paramref name="startChar"/> ('\' or '@'). The items are built only once per start character and then
+    /// shared by all completion sessions and all text views: The item list does not depend on the session at
+    /// all, and building the ~200 items (icons, suffixes, sort texts, properties) on every single "\" the user
+    /// types in a comment is measurable, pointless work on the background thread.
+    /// </summary>
+    private ImmutableArray<CompletionItem> GetOrCreateSharedCommandItems(char startChar)
+    {
+      Debug.Assert(startChar == '\\' || startChar == '@');
+
+      // Note the lock: GetCompletionContextAsync() runs on a background thread, and multiple text views can
+      // trigger completion sessions concurrently.
+      lock (cSharedCommandItemsLock) {
+        if (sSharedCommandItemsSource == null) {
+          sSharedCommandItemsSource = new SharedCommandItemsDescriptionSource(mCommentParser);
+        }
+        if (startChar == '\\') {
+          if (sSharedCommandItemsForBackslash.IsDefault) {
+            sSharedCommandItemsForBackslash = PopulateAutcompleteBoxWithCommands(startChar, sSharedCommandItemsSource).ToImmutable();
+          }
+          return sSharedCommandItemsForBackslash;
+        }
+        else {
+          if (sSharedCommandItemsForAt.IsDefault) {
+            sSharedCommandItemsForAt = PopulateAutcompleteBoxWithCommands(startChar, sSharedCommandItemsSource).ToImmutable();
+          }
+          return sSharedCommandItemsForAt;
+        }
+      }
+    }
+
+
+    /// <summary>
+    /// Throws away the shared command completion items. Called by DoxygenCommands when the Doxygen commands
+    /// got updated, right next to the invalidation of the description cache. Strictly speaking, the items
+    /// themselves do not embed any of the configurable information at the moment (the descriptions are
+    /// constructed lazily in GetDescriptionAsync()). But the rebuild happens at most once per settings change
+    /// and is therefore essentially free, while it protects us from a silently stale cache in case the item
+    /// construction ever starts to take the configuration into account.
+    /// </summary>
+    public static void InvalidateSharedCommandItems()
+    {
+      lock (cSharedCommandItemsLock) {
+        sSharedCommandItemsForBackslash = default;
+        sSharedCommandItemsForAt = default;
+      }
+    }
+
+
+    /// <summary>
+    /// Every CompletionItem permanently stores the IAsyncCompletionSource that created it; Visual Studio uses
+    /// that source to request the tooltip via GetDescriptionAsync(). The shared command items must therefore
+    /// not reference an ordinary CommentCommandCompletionSource: That would keep the text view which happened
+    /// to build the list (plus its text buffer) alive for the rest of the VS session. Instead, the shared items
+    /// reference an instance of this dedicated source, which has no per-view state and only serves descriptions.
+    /// </summary>
+    private sealed class SharedCommandItemsDescriptionSource : IAsyncCompletionSource
+    {
+      public SharedCommandItemsDescriptionSource(CommentParser commentParser)
+      {
+        mCommentParser = commentParser;
+      }
+
+      public Task<object> GetDescriptionAsync(IAsyncCompletionSession session, CompletionItem item, CancellationToken token)
+      {
+        if (item.Properties.TryGetProperty(typeof(DoxygenHelpPageCommand), out DoxygenHelpPageCommand cmd)) {
+          // We don't show hyperlinks because Visual Studio does not allow clicking on them.
+          var description = AllDoxygenHelpPageCommands.ConstructDescription(mCommentParser, cmd, showHyperlinks: false);
+          return Task.FromResult<object>(description);
+        }
+        return Task.FromResult<object>("");
+      }
+
+      // The following two methods never get called: Completion sessions are always started by a
+      // CommentCommandCompletionSource, which VS created via the MEF-exported provider. This class only
+      // ever appears as the source of individual items.
+      public CompletionStartData InitializeCompletion(CompletionTrigger trigger, SnapshotPoint triggerLocation, CancellationToken token)
+      {
+        Debug.Assert(false);
+        return CompletionStartData.DoesNotParticipateInCompletion;
+      }
+
+      public Task<CompletionContext> GetCompletionContextAsync(
+          IAsyncCompletionSession session,
+          CompletionTrigger trigger,
+          SnapshotPoint triggerLocation,
+          SnapshotSpan applicableToSpan,
+          CancellationToken cancellationToken)
+      {
+        Debug.Assert(false);
+        return Task.FromResult(CompletionContext.Empty);
+      }
+
+      private readonly CommentParser mCommentParser;
+    }
+
+
+    private static ImmutableArray<CompletionItem>.Builder PopulateAutcompleteBoxWithCommands(
+        char startChar, IAsyncCompletionSource itemSource)
     {
       var itemsBuilder = ImmutableArray.CreateBuilder<CompletionItem>();
 
@@ -253,7 +481,7 @@ namespace VSDoxyHighlighter
           // Add the "\" or "@" since it is not actually part of the autocompleted command, because
           // the applicableToSpan does not cover it. See InitializeCompletion() for the reason.
           displayText: startChar + cmd.Command,
-          source: this,
+          source: itemSource,
           icon: cCompletionImage,
           filters: ImmutableArray<CompletionFilter>.Empty,
           suffix: cmd.Parameters,
@@ -384,7 +612,9 @@ namespace VSDoxyHighlighter
       // and https://github.com/dotnet/project-system/issues/924.
       await ThreadHelper.JoinableTaskFactory.SwitchToMainThreadAsync(cancellationToken);
 
-      var cppFileSemantics = new CppFileSemanticsFromVSCodeModelAndCache(mAdapterService, mTextView.TextBuffer);
+      // Note: The semantics instance lives on the text buffer and caches the query results, so that successive
+      // completion requests (e.g. while the user types the parameter name) don't hit the slow FileCodeModel again.
+      var cppFileSemantics = CachedVisualStudioCppFileSemantics.GetOrCreate(mAdapterService, mTextView.TextBuffer);
 
       FunctionInfo funcInfo = cppFileSemantics.TryGetFunctionInfoIfNextIsAFunction(startPoint);
       if (funcInfo != null) {
@@ -426,7 +656,7 @@ namespace VSDoxyHighlighter
       // As in TryGetParametersOfNextCodeElementAsync(): Switch to the main thread for the FileCodeModel, especially because of performance.
       await ThreadHelper.JoinableTaskFactory.SwitchToMainThreadAsync(cancellationToken);
 
-      var cppFileSemantics = new CppFileSemanticsFromVSCodeModelAndCache(mAdapterService, mTextView.TextBuffer);
+      var cppFileSemantics = CachedVisualStudioCppFileSemantics.GetOrCreate(mAdapterService, mTextView.TextBuffer);
 
       FunctionInfo funcInfo = cppFileSemantics.TryGetFunctionInfoIfNextIsAFunction(startPoint);
       if (funcInfo != null) {
@@ -527,21 +757,6 @@ namespace VSDoxyHighlighter
       string[] doxygenCmds)
     {
       ThreadHelper.ThrowIfNotOnUIThread();
-      FormattedFragmentGroup group = TryFindPreviousDoxygenCommandOnLinesBeforePoint(cppFileSemantics, point, doxygenCmds);
-      if (group != null && group.Fragments.Count == 2) {
-        return group.Fragments[1].GetText(point.Snapshot);
-      }
-      return null;
-    }
-
-
-    // Given a text point, tries to find the next Doxygen command before that point which is in the given array 'doxygenCmds'.
-    private FormattedFragmentGroup TryFindPreviousDoxygenCommandOnLinesBeforePoint(
-      IVisualStudioCppFileSemantics cppFileSemantics, 
-      SnapshotPoint point, 
-      string[] doxygenCmds)
-    {
-      ThreadHelper.ThrowIfNotOnUIThread();
 
       // The task is to find the next Doxygen command in 'doxygenCmds' that comes before 'point. So we need to iterate backward
       // until we either find it or leave the current comment section. But how do we detect that we leave the current comment
@@ -561,27 +776,58 @@ namespace VSDoxyHighlighter
       int backwardsSearchStopPosition = cppFileSemantics.TryGetEndPositionOfCppElementBefore(point, cNumLinesBackwards);
       Debug.Assert(backwardsSearchStopPosition <= point.Position);
 
+      CommentClassifier commentClassifier = TryGetCommentClassifier(point.Snapshot.TextBuffer);
+      if (commentClassifier == null) {
+        Debug.Assert(false);
+        return null;
+      }
+
+      // Fast path: If all lines of the searched range got classified before (the common case, since the user
+      // triggers the completion in the middle of the visible, classified text), the classifier's command
+      // index finds the previous command without parsing anything.
+      if (commentClassifier.TryFindIndexedCommandBefore(
+            point, backwardsSearchStopPosition, doxygenCmds, out CommentCommandIndex.CommandOccurrence occurrence)) {
+        return (occurrence != null && occurrence.NumFragments == 2) ? occurrence.FirstParameter : null;
+      }
+
+      FormattedFragmentGroup group = TryFindPreviousDoxygenCommandOnLinesBeforePoint(
+        commentClassifier, point, backwardsSearchStopPosition, doxygenCmds);
+      if (group != null && group.Fragments.Count == 2) {
+        return group.Fragments[1].GetText(point.Snapshot);
+      }
+      return null;
+    }
+
+
+    // Given a text point, tries to find the next Doxygen command before that point which is in the given array 'doxygenCmds',
+    // by parsing the lines between the stop position and the point (served from the classifier's cache where possible).
+    // Fallback for the cases in which the command index cannot answer, see TryFindParameterOfPreviousDoxygenCommandWithOneParameter().
+    private FormattedFragmentGroup TryFindPreviousDoxygenCommandOnLinesBeforePoint(
+      CommentClassifier commentClassifier,
+      SnapshotPoint point,
+      int backwardsSearchStopPosition,
+      string[] doxygenCmds)
+    {
+      ThreadHelper.ThrowIfNotOnUIThread();
+
       var snapshot = point.Snapshot;
       int backwardsSearchLineNumStop = snapshot.GetLineFromPosition(backwardsSearchStopPosition).LineNumber;
 
-      CommentClassifier commentClassifier = TryGetCommentClassifier(snapshot.TextBuffer);
-      if (commentClassifier != null) {
-        // We assume only one Doxygen command per line.
-        for (int lineNum = point.GetContainingLineNumber() - 1; lineNum >= backwardsSearchLineNumStop; --lineNum) {
-          ITextSnapshotLine line = snapshot.GetLineFromLineNumber(lineNum);
-
-          // We use the extent **including** the line break characters (\r\n) because CommentClassifier.GetClassificationSpans()
-          // is called by Visual Studio typically with lines including them, meaning that the CommentClassifier caches lines
-          // including the line break characters. So, by including them here, too, the ParseSpan() method can more likely simply
-          // return already cached information.
-          var foundFragmentGroups = commentClassifier.ParseSpan(line.ExtentIncludingLineBreak);
-
-          foreach (FormattedFragmentGroup group in foundFragmentGroups.Reverse()) {
-            if (group.Fragments.Count > 0) {
-              string classifiedCommand = group.Fragments[0].GetText(snapshot);
-              if (classifiedCommand.Length > 1 && doxygenCmds.Contains(classifiedCommand.Substring(1))) {
-                return group;
-              }
+      // We assume only one Doxygen command per line.
+      for (int lineNum = point.GetContainingLineNumber() - 1; lineNum >= backwardsSearchLineNumStop; --lineNum) {
+        ITextSnapshotLine line = snapshot.GetLineFromLineNumber(lineNum);
+
+        // We use the extent **including** the line break characters (\r\n) because CommentClassifier.GetClassificationSpans()
+        // is called by Visual Studio typically with lines including them, meaning that the CommentClassifier caches lines
+        // including the line break characters. So, by including them here, too, the ParseSpan() method can more likely simply
+        // return already cached information.
+        var foundFragmentGroups = commentClassifier.ParseSpan(line.ExtentIncludingLineBreak);
+
+        foreach (FormattedFragmentGroup group in foundFragmentGroups.Reverse()) {
+          if (group.Fragments.Count > 0) {
+            string classifiedCommand = group.Fragments[0].GetText(snapshot);
+            if (classifiedCommand.Length > 1 && doxygenCmds.Contains(classifiedCommand.Substring(1))) {
+              return group;
             }
           }
         }
@@ -598,6 +844,13 @@ namespace VSDoxyHighlighter
     private static ImageElement cParamImage = new ImageElement(KnownMonikers.FieldPublic.ToImageId(), "Doxygen parameter");
     private static ImageElement cTemplateParamImage = new ImageElement(KnownMonikers.TypeDefinition.ToImageId(), "Doxygen template parameter");
 
+    // The completion items for the Doxygen commands, shared by all sessions and text views.
+    // See GetOrCreateSharedCommandItems(). The lock guards all three fields.
+    private static readonly object cSharedCommandItemsLock = new object();
+    private static ImmutableArray<CompletionItem> sSharedCommandItemsForBackslash;
+    private static ImmutableArray<CompletionItem> sSharedCommandItemsForAt;
+    private static SharedCommandItemsDescriptionSource sSharedCommandItemsSource;
+
     private static readonly string[] cCmdsToDocumentParam = new string[] { "param", "param[in]", "param[out]", "param[in,out]" };
     private static readonly string[] cCmdsToReferToParam = new string[] { "p", "a" };
     private static readonly string[] cCmdsToDocumentTParam = new string[] { "tparam" };
@@ -84,20 +84,16 @@ namespace VSDoxyHighlighter
       // hundreds of times in every second.
       await ThreadHelper.JoinableTaskFactory.SwitchToMainThreadAsync(cancellationToken);
 
-      (DoxygenHelpPageCommand helpPageCmdInfo, FormattedFragmentGroup fragmentGroup) = TryGetHelpPageCommandInfoForTriggerPoint(triggerPoint.Value);
-
-      if (fragmentGroup != null && helpPageCmdInfo != null) {
-        // Only the first fragment can contain the Doxygen command.
-        ClassificationEnum commandClassification = fragmentGroup.Fragments[0].Classification;
+      (DoxygenHelpPageCommand helpPageCmdInfo, ClassificationEnum commandClassification, Span commandGroupSpan)
+        = TryGetHelpPageCommandInfoForTriggerPoint(triggerPoint.Value);
 
+      if (helpPageCmdInfo != null) {
         var description = AllDoxygenHelpPageCommands.ConstructDescription(
           mCommentParser, helpPageCmdInfo, commandClassification, showHyperlinks: true);
 
         // If the user moves away with the mouse from this tracking span, the quick info vanishes.
         var spanWhereQuickInfoIsValid = mTextBuffer.CurrentSnapshot.CreateTrackingSpan(
-          fragmentGroup.StartIndex,
-          fragmentGroup.Length,
-          SpanTrackingMode.EdgeInclusive);
+          commandGroupSpan, SpanTrackingMode.EdgeInclusive);
 
         return new QuickInfoItem(spanWhereQuickInfoIsValid, description);
       }
@@ -106,13 +102,27 @@ namespace VSDoxyHighlighter
     }
 
 
-    private (DoxygenHelpPageCommand helpPageCmdInfo, FormattedFragmentGroup fragmentGroup) TryGetHelpPageCommandInfoForTriggerPoint(SnapshotPoint triggerPoint)
+    private (DoxygenHelpPageCommand helpPageCmdInfo, ClassificationEnum commandClassification, Span commandGroupSpan)
+      TryGetHelpPageCommandInfoForTriggerPoint(SnapshotPoint triggerPoint)
     {
       ThreadHelper.ThrowIfNotOnUIThread();
 
       if (triggerPoint.Snapshot.TextBuffer.Properties.TryGetProperty(
             typeof(CommentClassifier), out CommentClassifier commentClassifier)) {
 
+        // Fast path: If the line got classified before (the common case, since the user hovers over text
+        // that is visible and thus already classified), the classifier's command index knows the command
+        // under the mouse without any parsing.
+        if (commentClassifier.TryGetIndexedCommandAt(triggerPoint, out CommentCommandIndex.CommandOccurrence occurrence)) {
+          if (occurrence != null) {
+            DoxygenHelpPageCommand indexedHelpPageCmd = TryFindHelpPageCommand(occurrence.Command);
+            if (indexedHelpPageCmd != null) {
+              return (indexedHelpPageCmd, occurrence.CommandClassification, new Span(occurrence.StartIndex, occurrence.Length));
+            }
+          }
+          return (null, default, default);
+        }
+
         ITextSnapshotLine line = triggerPoint.GetContainingLine();
 
         // We use the extent **including** the line break characters (\r\n) because CommentClassifier.GetClassificationSpans()
@@ -137,13 +147,14 @@ namespace VSDoxyHighlighter
 
             DoxygenHelpPageCommand helpPageCmd = TryFindHelpPageCommand(potentialCmdWithSlashOrAt);
             if (helpPageCmd != null) {
-              return (helpPageCmd, group);
+              // Only the first fragment can contain the Doxygen command.
+              return (helpPageCmd, fragmentWithCommand.Classification, new Span(group.StartIndex, group.Length));
             }
           }
         }
       }
 
-      return (null, null);
+      return (null, default, default);
     }
 
 
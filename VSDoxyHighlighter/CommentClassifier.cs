@@ -14,6 +14,8 @@ using Microsoft.VisualStudio.Utilities;
 using System.ComponentModel.Composition;
 using Microsoft.VisualStudio.Shell;
 using System.Linq;
+using System.Threading.Tasks;
+using Microsoft.VisualStudio.Text.Editor;
 
 namespace VSDoxyHighlighter
 {
@@ -114,12 +116,258 @@ namespace VSDoxyHighlighter
 
     public IClassifier GetClassifier(ITextBuffer buffer)
     {
-      return buffer.Properties.GetOrCreateSingletonProperty<CommentClassifier>(
-        creator: () => new CommentClassifier(this.classificationRegistry, buffer));
+      bool newlyCreated = false;
+      CommentClassifier classifier = buffer.Properties.GetOrCreateSingletonProperty<CommentClassifier>(
+        creator: () => {
+          newlyCreated = true;
+          return new CommentClassifier(this.classificationRegistry, buffer);
+        });
+
+      // Only when the buffer just got attached (i.e. when the document got opened), and not for the
+      // additional GetClassifier() calls that happen e.g. for every new view of the same buffer.
+      if (newlyCreated) {
+        classifier.StartWholeDocumentWarmUpIfEnabled();
+      }
+
+      return classifier;
+    }
+  }
+
+
+
+  //=========================================================================================
+  // CommentTextViewTracker
+  //=========================================================================================
+
+  /// <summary>
+  /// Keeps track of the text views that display a certain text buffer, so that CommentClassifier can
+  /// prioritize the classification of the spans that are actually visible. Automatically created and
+  /// used by MEF. (An IClassifier itself only knows its text buffer, not the views.)
+  /// </summary>
+  [Export(typeof(IWpfTextViewCreationListener))]
+  [ContentType("C/C++")]
+  [TextViewRole(PredefinedTextViewRoles.Document)]
+  internal class CommentTextViewTracker : IWpfTextViewCreationListener
+  {
+    public void TextViewCreated(IWpfTextView textView)
+    {
+      List<ITextView> textViews = textView.TextBuffer.Properties.GetOrCreateSingletonProperty(
+        cTextViewsPropertyKey, () => new List<ITextView>());
+      textViews.Add(textView);
+      textView.Closed += (sender, args) => textViews.Remove(textView);
+    }
+
+    /// <summary>
+    /// Returns the text views that currently display the given text buffer, or null if there are none.
+    /// </summary>
+    public static List<ITextView> GetTextViews(ITextBuffer textBuffer)
+    {
+      textBuffer.Properties.TryGetProperty(cTextViewsPropertyKey, out List<ITextView> textViews);
+      return textViews;
     }
+
+    private static readonly object cTextViewsPropertyKey = new object();
   }
 
 
+  //=========================================================================================
+  // CommentCommandIndex
+  //=========================================================================================
+
+  /// <summary>
+  /// An ordered index of all recognized Doxygen command occurrences in a text buffer, so that questions like
+  /// "which command is at this position" (quick info) or "which was the previous \param command before this
+  /// position" (autocomplete preselection) can be answered with a binary search instead of re-driving the
+  /// classification over the nearby lines.
+  ///
+  /// The index is owned and maintained by the CommentClassifier of the buffer: It mirrors exactly those
+  /// entries of the classifier's span cache whose span is a single line (which is what Visual Studio
+  /// requests almost exclusively, and what the quick info and the autocomplete request). This way the index
+  /// requires no parsing of its own, and a cached line entry guarantees that the index contains precisely
+  /// the command occurrences of that line's parse result. Entries for multi-line spans are deliberately not
+  /// mirrored: Their parse results can differ from the line-local ones near the span boundaries, and
+  /// distinct line spans never overlap, which keeps the bookkeeping trivial. The consumers therefore ask the
+  /// CommentClassifier (which knows which lines are cached) and fall back to the ordinary parse if a line in
+  /// the queried range is not cached.
+  ///
+  /// The occurrences store plain strings and positions instead of references to the fragment groups, so that
+  /// translating the index through text buffer edits only needs to shift the positions (the groups themselves
+  /// get replaced during the translation of the cache). The memory consumption (a few small strings per
+  /// command in the document) is negligible compared to the span cache and thus not counted into the cache
+  /// memory budget.
+  ///
+  /// All members must only be used on the UI thread, like the cache of the CommentClassifier.
+  /// </summary>
+  internal class CommentCommandIndex
+  {
+    /// <summary>
+    /// One recognized Doxygen command occurrence, i.e. the data of one FormattedFragmentGroup whose first
+    /// fragment starts with "\" or "@".
+    /// </summary>
+    public class CommandOccurrence
+    {
+      public int StartIndex; // Absolute start of the fragment group in the text buffer.
+      public int Length; // Length of the whole fragment group.
+      public string Command; // Text of the first fragment, including the "\" or "@".
+      public ClassificationEnum CommandClassification; // Classification of the first fragment.
+      public int NumFragments; // Number of fragments in the group (command + parameters).
+      public string FirstParameter; // Text of the second fragment if NumFragments == 2, else null.
+    }
+
+
+    /// <summary>
+    /// Replaces the occurrences in the given span with the command occurrences found in the given parse
+    /// result. Called whenever the CommentClassifier caches the parse result of a single line.
+    /// </summary>
+    public void UpdateSpan(Span span, IEnumerable<FormattedFragmentGroup> fragmentGroups, ITextSnapshot snapshot)
+    {
+      RemoveOccurrencesIn(span);
+
+      foreach (FormattedFragmentGroup group in fragmentGroups) {
+        if (group.Fragments.Count == 0) {
+          continue;
+        }
+        FormattedFragment firstFragment = group.Fragments[0];
+        if (firstFragment.Length < 2) {
+          continue;
+        }
+        string commandText = firstFragment.GetText(snapshot);
+        if (commandText[0] != '\\' && commandText[0] != '@') {
+          continue; // E.g. a markdown fragment; only actual Doxygen commands get indexed.
+        }
+
+        mOccurrences[group.StartIndex] = new CommandOccurrence {
+          StartIndex = group.StartIndex,
+          Length = group.Length,
+          Command = commandText,
+          CommandClassification = firstFragment.Classification,
+          NumFragments = group.Fragments.Count,
+          FirstParameter = (group.Fragments.Count == 2) ? group.Fragments[1].GetText(snapshot) : null
+        };
+      }
+    }
+
+
+    /// <summary>
+    /// Removes all occurrences whose group starts in the given span. Called when the corresponding cache
+    /// entry gets removed.
+    /// </summary>
+    public void RemoveOccurrencesIn(Span span)
+    {
+      int firstIdx = FindFirstOccurrenceAtOrAfter(span.Start);
+      int lastIdx = FindFirstOccurrenceAtOrAfter(span.End) - 1;
+      for (int idx = lastIdx; idx >= firstIdx; --idx) {
+        mOccurrences.RemoveAt(idx);
+      }
+    }
+
+
+    public void Clear()
+    {
+      mOccurrences.Clear();
+    }
+
+
+    /// <summary>
+    /// Translates the index through the edits of a single text buffer version, using the same rules as the
+    /// cache translation in CommentClassifier.TranslateCacheThroughChanges(): Occurrences on or next to an
+    /// edit are dropped (the line gets re-parsed, which re-adds them via UpdateSpan()), occurrences behind
+    /// an edit are shifted by the edit's delta. A dropped occurrence can outlive its dropped cache entry for
+    /// a moment, but that is harmless: The CommentClassifier only consults the index for lines that are
+    /// actually cached.
+    /// </summary>
+    public void TranslateThroughChanges(INormalizedTextChangeCollection changes)
+    {
+      var translated = new SortedList<int, CommandOccurrence>(mOccurrences.Count);
+      foreach (KeyValuePair<int, CommandOccurrence> posAndOccurrence in mOccurrences) {
+        CommandOccurrence occurrence = posAndOccurrence.Value;
+        int delta = 0;
+        bool dropped = false;
+        foreach (ITextChange change in changes) { // The changes are sorted and non-overlapping.
+          // Same "extended by one character" rule as for the cache entries.
+          if (occurrence.StartIndex <= change.OldEnd + 1 && occurrence.StartIndex + occurrence.Length >= change.OldPosition - 1) {
+            dropped = true;
+            break;
+          }
+          else if (change.OldEnd < occurrence.StartIndex) {
+            delta += change.Delta;
+          }
+          else {
+            break; // All further changes are behind the occurrence and thus cannot affect it.
+          }
+        }
+
+        if (!dropped) {
+          occurrence.StartIndex += delta;
+          // The iteration is in ascending key order and all deltas stem from the same sorted change list,
+          // so the shifted keys are appended in ascending order, too (which SortedList.Add handles in O(1)).
+          translated.Add(occurrence.StartIndex, occurrence);
+        }
+      }
+      mOccurrences = translated;
+    }
+
+
+    /// <summary>
+    /// Returns the occurrence whose fragment group contains the given position, or null if there is none.
+    /// </summary>
+    public CommandOccurrence TryGetOccurrenceContaining(int position)
+    {
+      int idx = FindFirstOccurrenceAtOrAfter(position + 1) - 1; // Last occurrence starting at or before 'position'.
+      if (idx >= 0) {
+        CommandOccurrence occurrence = mOccurrences.Values[idx];
+        if (position <= occurrence.StartIndex + occurrence.Length - 1) {
+          return occurrence;
+        }
+      }
+      return null;
+    }
+
+
+    /// <summary>
+    /// Searches backward from <paramref name="rangeEnd"/> (exclusive) to <paramref name="rangeStart"/> for
+    /// the nearest occurrence whose command (without the "\" or "@") is one of <paramref name="doxygenCmds"/>.
+    /// Returns null if there is none in the range.
+    /// </summary>
+    public CommandOccurrence TryFindLastOccurrenceInRange(int rangeStart, int rangeEnd, string[] doxygenCmds)
+    {
+      for (int idx = FindFirstOccurrenceAtOrAfter(rangeEnd) - 1; idx >= 0; --idx) {
+        CommandOccurrence occurrence = mOccurrences.Values[idx];
+        if (occurrence.StartIndex < rangeStart) {
+          break;
+        }
+        if (doxygenCmds.Contains(occurrence.Command.Substring(1))) {
+          return occurrence;
+        }
+      }
+      return null;
+    }
+
+
+    // Binary search for the index (into the sorted list) of the first occurrence whose start position is
+    // >= the given position. Returns the number of occurrences if there is no such occurrence.
+    private int FindFirstOccurrenceAtOrAfter(int position)
+    {
+      IList<int> keys = mOccurrences.Keys;
+      int low = 0;
+      int high = keys.Count;
+      while (low < high) {
+        int mid = low + (high - low) / 2;
+        if (keys[mid] < position) {
+          low = mid + 1;
+        }
+        else {
+          high = mid;
+        }
+      }
+      return low;
+    }
+
+
+    // All occurrences, keyed (and thus sorted) by the absolute start position of their fragment group.
+    private SortedList<int, CommandOccurrence> mOccurrences = new SortedList<int, CommandOccurrence>();
+  }
+
 
   //=========================================================================================
   // CommentClassifier
@@ -137,7 +385,9 @@ namespace VSDoxyHighlighter
     {
       mTextBuffer = textBuffer;
 
-      mVSCppColorer = new DefaultVSCppColorerImpl(textBuffer);
+      // The batching layer fetches the tags for the whole visible region in one call instead of issuing a
+      // separate request to the VS tagger for every single line that Visual Studio asks us to classify.
+      mVSCppColorer = new BatchingVSCppColorer(new DefaultVSCppColorerImpl(textBuffer), textBuffer);
       mVSCppColorer.CppColorerReclassifiedSpan += OnVSCppColorerReclassifiedSpan;
 
       mCommentExtractor = new CommentExtractor(mVSCppColorer);
@@ -157,6 +407,9 @@ namespace VSDoxyHighlighter
 
       mParser = VSDoxyHighlighterPackage.CommentParser;
       mParser.ParsingMethodChanged += OnSettingsOrCommandsChanged;
+
+      // Register for the global cache memory budget (only ever touched on the UI thread).
+      sAllClassifiers.Add(this);
     }
 
 
@@ -187,8 +440,10 @@ namespace VSDoxyHighlighter
 
       ThreadHelper.ThrowIfNotOnUIThread();
 
-      var formattedFragments = ParseSpan(originalSpanToCheck);
+      long startTimestamp = PerformanceMetrics.StartTiming();
+      var formattedFragments = ParseSpan(originalSpanToCheck, allowParsingInBackground: true);
       var classificationSpans = FormattedFragmentGroupsToClassifications(originalSpanToCheck.Snapshot, formattedFragments);
+      PerformanceMetrics.RecordClassificationRequest(startTimestamp, originalSpanToCheck.Length);
       return classificationSpans;
     }
 
@@ -197,8 +452,14 @@ namespace VSDoxyHighlighter
     /// Parses the given span for comments and the comments themselves for Doxygen commands, markdown, etc.
     /// Returns a list of found fragments that should be formatted. Note that the start index in each returned
     /// fragment is absolute (i.e. relative to the start of the whole text buffer).
+    ///
+    /// If <paramref name="allowParsingInBackground"/> is true and the corresponding setting is enabled, a span
+    /// that is not yet in the cache gets parsed on a background thread, and this function returns an empty
+    /// collection for now; once the background parse has finished, ClassificationChanged is fired so that
+    /// Visual Studio requests the classification again (which is then served from the cache). Callers that
+    /// need the parse result immediately (quick info, autocomplete) must pass false.
     /// </summary>
-    public IEnumerable<FormattedFragmentGroup> ParseSpan(SnapshotSpan originalSpanToCheck)
+    public IEnumerable<FormattedFragmentGroup> ParseSpan(SnapshotSpan originalSpanToCheck, bool allowParsingInBackground = false)
     {
       // Because of the used DefaultVSCppColorerImpl, we need to be on the main thread (since the Visual Studio cpp colorer
       // seems to not work if called from somewhere else). Also, we know that we do call this code here on the main thread; and
@@ -222,40 +483,388 @@ namespace VSDoxyHighlighter
       // ==> We optimize (3), (4) and (5) via a cache. This reduces the CPU load very notably.
       //
       // Additionally, the code also gets called for the quick info, where we also can reuse the cache.
-      if (mCachedVersion != textSnapshot.Version.VersionNumber) {
-        InvalidateCache();
-        mCachedVersion = textSnapshot.Version.VersionNumber;
-      }
-      else if (mCache.TryGetValue(originalSpanToCheck.Span, out var cachedFormattedFragmentGroups)) {
-        return cachedFormattedFragmentGroups;
+      //
+      // Note that the cache is not simply thrown away when the text buffer version changes (i.e. after an
+      // edit): Instead, the cached results get translated through the edit, and only the entries for the
+      // actually edited lines get dropped. So after a keystroke only the edited lines get re-parsed rather
+      // than every visible line, which makes a real difference while typing in large files.
+      TranslateCacheToSnapshot(textSnapshot);
+      if (mCache.TryGetValue(originalSpanToCheck.Span, out CacheEntry cachedEntry)) {
+        PerformanceMetrics.RecordParseSpanCall(servedFromCache: true);
+        cachedEntry.LastAccessStamp = ++sNextAccessStamp;
+        mLastAccessStamp = cachedEntry.LastAccessStamp;
+        return cachedEntry.FragmentGroups;
       }
+      PerformanceMetrics.RecordParseSpanCall(servedFromCache: false);
 
       // First step: Identify those parts in the span that are actually comments and not code.
-      // But do not yet parse the text for the Doxygen commands.
+      // But do not yet parse the text for the Doxygen commands. This genuinely needs the UI thread,
+      // because of the reliance on the Visual Studio cpp colorer.
       List<CommentSpan> commentSpans = mCommentExtractor.SplitIntoComments(originalSpanToCheck);
 
+#if !ENABLE_COMMENT_TYPE_DEBUGGING
+      if (allowParsingInBackground && mGeneralOptions.EnableParsingInBackground) {
+        // Second step, pipelined variant: Parse the comments on a background thread, so that the expensive
+        // part of the classification does not block the UI thread (relevant especially when scrolling fast
+        // through large files). Until the parse has finished, the span simply shows no extra highlighting.
+        StartParsingCommentsInBackground(originalSpanToCheck, commentSpans);
+        return Array.Empty<FormattedFragmentGroup>();
+      }
+#endif
+
       // Second step: For each identified piece of comment, parse it for Doxygen commands, markdown, etc.
+      List<FormattedFragmentGroup> result = ParseCommentsInSpan(textSnapshot, commentSpans);
+      AddToCache(originalSpanToCheck.Span, result);
+      return result;
+    }
+
+
+    /// <summary>
+    /// Parses each given piece of comment for Doxygen commands, markdown, etc. This function deliberately
+    /// accesses no mutable members and may therefore be called from any thread (ITextSnapshot is immutable,
+    /// and CommentParser.Parse() is thread-safe).
+    /// </summary>
+    private List<FormattedFragmentGroup> ParseCommentsInSpan(ITextSnapshot textSnapshot, List<CommentSpan> commentSpans)
+    {
       var result = new List<FormattedFragmentGroup>();
       foreach (CommentSpan commentSpan in commentSpans) {
 #if !ENABLE_COMMENT_TYPE_DEBUGGING
         if (mGeneralOptions.IsEnabledInCommentType(commentSpan.commentType)) {
           string codeText = textSnapshot.GetText(commentSpan.span);
-          var fragmentGroupsToFormat = mParser.Parse(codeText);
-          // Convert each start position of a fragment: Instead of relative to "codeText", it
-          // should be absolute (i.e. relative to the span start).
-          result.AddRange(MakeFormattedFragmentGroupsAbsolute(fragmentGroupsToFormat, commentSpan.span.Start));
+          // By passing the absolute start of the comment, the parser emits the fragments directly in
+          // snapshot coordinates; no separate translation pass over all fragments is necessary.
+          var fragmentGroupsToFormat = mParser.Parse(codeText, commentSpan.span.Start);
+          result.AddRange(fragmentGroupsToFormat);
         }
 #else
         var debugFragment = new FormattedFragment(commentSpan.span.Start, commentSpan.span.Length, cCommentTypeDebugFormats[commentSpan.commentType]);
         result.Add(new FormattedFragmentGroup(new List<FormattedFragment>() {debugFragment}));
 #endif
       }
-
-      mCache[originalSpanToCheck.Span] = result;
       return result;
     }
 
 
+    /// <summary>
+    /// Queues the given pieces of comment so that CommentParser.Parse() runs for them on a background
+    /// thread. When done, the result is put into the cache (on the UI thread again) and a
+    /// re-classification of the span is triggered, so that Visual Studio picks up the result. If the text
+    /// buffer changed in the meantime, the result is stale and simply gets dropped; the edit itself
+    /// already caused a new classification request for the new snapshot.
+    ///
+    /// The queue is drained with viewport priority: Spans that are currently visible in some text view get
+    /// parsed first, all other spans (which Visual Studio requests e.g. for the outlining feature, or which
+    /// third-party extensions request via aggregators) only afterwards and slightly delayed. This way, when
+    /// paging through a big file, the lines the user is actually looking at do not compete with off-screen
+    /// requests.
+    /// </summary>
+    private void StartParsingCommentsInBackground(SnapshotSpan originalSpanToCheck, List<CommentSpan> commentSpans)
+    {
+      ThreadHelper.ThrowIfNotOnUIThread();
+
+      Span span = originalSpanToCheck.Span;
+      if (!mSpansBeingParsedInBackground.Add(span)) {
+        // A background parse for that span is already queued or running; it will fire
+        // ClassificationChanged when done.
+        return;
+      }
+
+      mPendingBackgroundParses[span] = new PendingBackgroundParse {
+        Snapshot = originalSpanToCheck.Snapshot,
+        CommentSpans = commentSpans
+      };
+      EnsureBackgroundParsingPumpRuns();
+    }
+
+
+    // Starts the loop that processes mPendingBackgroundParses, unless it is already running. The loop
+    // itself runs on the UI thread (it needs to choose requests depending on the viewport, and to touch
+    // the cache), while the actual parsing of every single request happens on the thread pool.
+    private void EnsureBackgroundParsingPumpRuns()
+    {
+      ThreadHelper.ThrowIfNotOnUIThread();
+      if (mBackgroundParsingPumpRuns) {
+        return;
+      }
+      mBackgroundParsingPumpRuns = true;
+
+      _ = ThreadHelper.JoinableTaskFactory.RunAsync(async () => {
+        try {
+          while (mPendingBackgroundParses.Count > 0) {
+            (Span span, bool isVisible) = ChooseNextPendingBackgroundParse();
+
+            if (!isVisible) {
+              // Only off-screen spans are pending. Give requests for visible spans (which might arrive any
+              // moment, e.g. because the user paged further) the chance to overtake.
+              await Task.Delay(cOffScreenParseDelayInMs);
+              await ThreadHelper.JoinableTaskFactory.SwitchToMainThreadAsync();
+              if (mPendingBackgroundParses.Count == 0) {
+                return;
+              }
+              (span, isVisible) = ChooseNextPendingBackgroundParse();
+            }
+
+            PendingBackgroundParse request = mPendingBackgroundParses[span];
+            mPendingBackgroundParses.Remove(span);
+            int parseGeneration = mParseGeneration;
+
+            List<FormattedFragmentGroup> result
+              = await Task.Run(() => ParseCommentsInSpan(request.Snapshot, request.CommentSpans));
+
+            // The cache and the events must be touched on the UI thread only.
+            await ThreadHelper.JoinableTaskFactory.SwitchToMainThreadAsync();
+            mSpansBeingParsedInBackground.Remove(span);
+
+            if (parseGeneration != mParseGeneration
+                || mCachedSnapshot == null
+                || mCachedSnapshot.Version.VersionNumber != request.Snapshot.Version.VersionNumber) {
+              // The buffer, the settings or the VS cpp colorer's tags changed while we were parsing.
+              continue;
+            }
+
+            AddToCache(span, result);
+            ClassificationChanged?.Invoke(this, new ClassificationChangedEventArgs(new SnapshotSpan(request.Snapshot, span)));
+          }
+        }
+        finally {
+          mBackgroundParsingPumpRuns = false;
+        }
+      });
+    }
+
+
+    // Returns the span of a pending background parse that is visible in some text view, if there is one;
+    // otherwise, some pending span. Must not be called with an empty queue.
+    private (Span span, bool isVisible) ChooseNextPendingBackgroundParse()
+    {
+      ThreadHelper.ThrowIfNotOnUIThread();
+      Debug.Assert(mPendingBackgroundParses.Count > 0);
+
+      List<ITextView> textViews = CommentTextViewTracker.GetTextViews(mTextBuffer);
+      if (textViews != null) {
+        foreach (KeyValuePair<Span, PendingBackgroundParse> pending in mPendingBackgroundParses) {
+          foreach (ITextView textView in textViews) {
+            if (!textView.IsClosed && !textView.InLayout && textView.TextViewLines != null
+                && textView.TextViewLines.FormattedSpan.Span.IntersectsWith(pending.Key)) {
+              return (pending.Key, true);
+            }
+          }
+        }
+      }
+
+      return (mPendingBackgroundParses.Keys.First(), false);
+    }
+
+
+    private void DropPendingBackgroundParses()
+    {
+      mSpansBeingParsedInBackground.Clear();
+      mPendingBackgroundParses.Clear();
+    }
+
+
+    /// <summary>
+    /// Depending on the enabled (opt-in) settings, warms up the cache for the whole document shortly after
+    /// it got opened: First, an attempt is made to restore the classification results of a previous session
+    /// from the persistent sidecar cache, which succeeds if the document and the relevant settings are
+    /// unchanged and then makes the full highlighting available without running the parser at all. If that
+    /// is not possible, the whole document gets parsed once and the results are put into the cache (and
+    /// saved to the sidecar cache for the next session). Afterwards, the classification requests from
+    /// Visual Studio are pure cache hits, so scrolling through a freshly opened file does not stutter
+    /// because of comments getting parsed on demand.
+    /// </summary>
+    public void StartWholeDocumentWarmUpIfEnabled()
+    {
+      ThreadHelper.ThrowIfNotOnUIThread();
+
+      if (!mGeneralOptions.EnableHighlighting) {
+        return;
+      }
+      bool preWarmEnabled = mGeneralOptions.EnableWholeDocumentPreWarm;
+      bool persistentCacheEnabled = mGeneralOptions.EnablePersistentHighlightCache;
+      if (!preWarmEnabled && !persistentCacheEnabled) {
+        return;
+      }
+
+      _ = ThreadHelper.JoinableTaskFactory.RunAsync(async () => {
+        if (persistentCacheEnabled) {
+          bool restored = await TryRestorePersistentCacheAsync();
+          if (restored || mDisposed) {
+            return;
+          }
+        }
+
+        // Directly after the buffer got attached, the VS cpp tagger is typically not yet set up for it.
+        // Give it a moment; if it is still not ready afterwards, the pre-warm silently does nothing and
+        // everything is classified on demand, as without the option.
+        await Task.Delay(cPreWarmInitialDelayInMs);
+        await ThreadHelper.JoinableTaskFactory.SwitchToMainThreadAsync();
+        if (!mDisposed) {
+          bool completed = await PreWarmWholeDocumentAsync();
+          if (completed && persistentCacheEnabled && !mDisposed) {
+            SavePersistentCache();
+          }
+        }
+      });
+    }
+
+
+    /// <summary>
+    /// Attempts to restore the classification results of the whole document from the persistent sidecar
+    /// cache of a previous session. Returns false (and changes nothing) if there is no sidecar file for the
+    /// current document content and settings, or if the document got edited while the file was being read.
+    /// </summary>
+    private async Task<bool> TryRestorePersistentCacheAsync()
+    {
+      ThreadHelper.ThrowIfNotOnUIThread();
+
+      string documentFilePath = GetDocumentFilePath();
+      if (documentFilePath == null) {
+        return false;
+      }
+
+      ITextSnapshot snapshot = mTextBuffer.CurrentSnapshot;
+      int parseGenerationAtStart = mParseGeneration;
+      int configHash = PersistentHighlightCache.ComputeConfigHash(mGeneralOptions);
+
+      // The file IO and the content hashing happen on the thread pool; especially hashing a 1 MB document
+      // should not run on the UI thread. ITextSnapshot is immutable and thus safe to read there.
+      Dictionary<Span, List<FormattedFragmentGroup>> entries = await Task.Run(
+        () => PersistentHighlightCache.TryLoad(documentFilePath, snapshot.GetText(), configHash));
+
+      await ThreadHelper.JoinableTaskFactory.SwitchToMainThreadAsync();
+
+      if (entries == null
+          || mDisposed
+          || parseGenerationAtStart != mParseGeneration
+          || snapshot.Version.VersionNumber != mTextBuffer.CurrentSnapshot.Version.VersionNumber) {
+        return false;
+      }
+
+      TranslateCacheToSnapshot(snapshot);
+      foreach (KeyValuePair<Span, List<FormattedFragmentGroup>> entry in entries) {
+        if (!mCache.ContainsKey(entry.Key)) {
+          AddToCache(entry.Key, entry.Value);
+        }
+      }
+
+      // The restored results were computed in a session where the VS cpp colorer had fully classified the
+      // document, and the document content is identical. The colorer's initial burst of TagsChanged events
+      // for this session must therefore not throw them away again (see OnVSCppColorerReclassifiedSpan);
+      // otherwise the restore would be pointless. The protection ends with the first edit.
+      mPersistentCacheRestoreActive = true;
+      ++NumPersistentCacheRestores;
+
+      FireClassificationChangedForWholeBuffer();
+      return true;
+    }
+
+
+    /// <summary>
+    /// Saves the current content of the cache to the persistent sidecar cache, so that re-opening the
+    /// unchanged document (possibly in a future session) can skip the parsing entirely. Expects that the
+    /// cache covers the whole document, i.e. should only be called after a completed whole document pre-warm.
+    /// </summary>
+    private void SavePersistentCache()
+    {
+      ThreadHelper.ThrowIfNotOnUIThread();
+
+      string documentFilePath = GetDocumentFilePath();
+      if (documentFilePath == null) {
+        return;
+      }
+
+      ITextSnapshot snapshot = mTextBuffer.CurrentSnapshot;
+      int configHash = PersistentHighlightCache.ComputeConfigHash(mGeneralOptions);
+
+      // Copy out the entries on the UI thread, since the cache may get modified at any time there. The
+      // fragment group lists themselves are never mutated after they got cached, so the copy can share them.
+      var entries = new List<KeyValuePair<Span, List<FormattedFragmentGroup>>>(mCache.Count);
+      foreach (KeyValuePair<Span, CacheEntry> cacheEntry in mCache) {
+        entries.Add(new KeyValuePair<Span, List<FormattedFragmentGroup>>(cacheEntry.Key, cacheEntry.Value.FragmentGroups));
+      }
+
+      // Writing the file is fire-and-forget on the thread pool; nothing needs to happen afterwards, and
+      // failures are swallowed (and logged) by the cache itself.
+      _ = Task.Run(() => PersistentHighlightCache.Save(documentFilePath, snapshot.GetText(), configHash, entries));
+    }
+
+
+    private string GetDocumentFilePath()
+    {
+      if (mTextBuffer.Properties.TryGetProperty(typeof(ITextDocument), out ITextDocument textDocument)) {
+        return textDocument?.FilePath;
+      }
+      return null;
+    }
+
+
+    // Parses the whole document in chunks: The comment extraction of a chunk of lines happens on the UI
+    // thread (the VS cpp colorer does not work anywhere else), the parsing of the extracted comments of
+    // the chunk then happens in parallel on the thread pool, and finally the results get added to the
+    // cache (on the UI thread again). Control returns to the UI thread's message pump while a chunk is
+    // being parsed, so the UI stays responsive during the warm-up. Returns true if the whole document got
+    // processed, false if the pre-warm had to give up (not ready, stale, disposed, ...).
+    private async Task<bool> PreWarmWholeDocumentAsync()
+    {
+      ThreadHelper.ThrowIfNotOnUIThread();
+      mVSCppColorer.InitializeLazily();
+
+      ITextSnapshot snapshot = mTextBuffer.CurrentSnapshot;
+      int parseGenerationAtStart = mParseGeneration;
+
+      for (int chunkStartLine = 0; chunkStartLine < snapshot.LineCount; chunkStartLine += cPreWarmChunkSizeInLines) {
+        // First step for the chunk: Identify the comments in every line, exactly like ParseSpan() does for
+        // an on-demand request (using the extent including the line break, since that is what Visual Studio
+        // requests and thus what gets looked up in the cache).
+        TranslateCacheToSnapshot(snapshot);
+        int chunkEndLine = Math.Min(chunkStartLine + cPreWarmChunkSizeInLines, snapshot.LineCount);
+        var lineSpans = new List<Span>();
+        var commentSpansOfLines = new List<List<CommentSpan>>();
+        for (int lineNumber = chunkStartLine; lineNumber < chunkEndLine; ++lineNumber) {
+          Span lineSpan = snapshot.GetLineFromLineNumber(lineNumber).ExtentIncludingLineBreak.Span;
+          if (mCache.ContainsKey(lineSpan) || mSpansBeingParsedInBackground.Contains(lineSpan)) {
+            continue; // Already known, e.g. because the line is visible and got classified normally.
+          }
+          List<CommentSpan> commentSpans = mCommentExtractor.SplitIntoComments(new SnapshotSpan(snapshot, lineSpan));
+          if (commentSpans.Any(c => c.commentType == CommentType.Unknown)) {
+            // The VS cpp tagger is not (yet) able to classify the line. Do not fill the cache with garbage;
+            // give up and leave the document to the ordinary on-demand classification.
+            return false;
+          }
+          lineSpans.Add(lineSpan);
+          commentSpansOfLines.Add(commentSpans);
+        }
+
+        // Second step: Parse the comments of all lines of the chunk in parallel on the thread pool.
+        // ParseCommentsInSpan() is deliberately thread-safe (compare its comment).
+        var parsedLines = new List<FormattedFragmentGroup>[lineSpans.Count];
+        await Task.Run(() => {
+          Parallel.For(0, lineSpans.Count, idx => {
+            parsedLines[idx] = ParseCommentsInSpan(snapshot, commentSpansOfLines[idx]);
+          });
+        });
+
+        await ThreadHelper.JoinableTaskFactory.SwitchToMainThreadAsync();
+
+        if (mDisposed
+            || parseGenerationAtStart != mParseGeneration
+            || snapshot.Version.VersionNumber != mTextBuffer.CurrentSnapshot.Version.VersionNumber) {
+          // The buffer, the settings or the VS cpp colorer's tags changed in the meantime, so the results
+          // are stale. Simply stop: The pre-warm is only an optimization, the on-demand classification
+          // produces correct results for everything we did not get to.
+          return false;
+        }
+
+        for (int idx = 0; idx < lineSpans.Count; ++idx) {
+          AddToCache(lineSpans[idx], parsedLines[idx]);
+        }
+      }
+
+      return true;
+    }
+
+
     public void Dispose()
     {
       // TODO: This is currently dead code.
@@ -281,6 +890,9 @@ namespace VSDoxyHighlighter
       }
       mDisposed = true;
 
+      ClearOwnCache();
+      sAllClassifiers.Remove(this);
+
       if (mGeneralOptions != null) {
         mGeneralOptions.SettingsChanged -= OnSettingsOrCommandsChanged;
       }
@@ -297,6 +909,76 @@ namespace VSDoxyHighlighter
     public CommentExtractor CommentExtractor { get { return mCommentExtractor; } }
 
 
+    /// <summary>
+    /// Attempts to answer "which Doxygen command occurrence contains the given position" purely from the
+    /// command index, i.e. without parsing anything. Returns true if the index is authoritative for the
+    /// position, which is the case if the containing line is in the cache (the common case, since the user
+    /// usually interacts with text that is visible and thus got classified). <paramref name="occurrence"/>
+    /// is then the found occurrence, or null if there is no command at the position. Returns false if the
+    /// line is not cached; the caller must then fall back to ParseSpan().
+    /// </summary>
+    public bool TryGetIndexedCommandAt(SnapshotPoint point, out CommentCommandIndex.CommandOccurrence occurrence)
+    {
+      ThreadHelper.ThrowIfNotOnUIThread();
+      occurrence = null;
+
+      TranslateCacheToSnapshot(point.Snapshot);
+      ITextSnapshotLine line = point.GetContainingLine();
+      if (!mCache.TryGetValue(line.ExtentIncludingLineBreak.Span, out CacheEntry entry)
+          || !entry.MirroredInCommandIndex) {
+        return false;
+      }
+
+      // Touch the entry like a ParseSpan() cache hit would, so that the memory budget eviction treats
+      // lines looked up via the index as recently used, too.
+      entry.LastAccessStamp = ++sNextAccessStamp;
+      mLastAccessStamp = entry.LastAccessStamp;
+
+      occurrence = mCommandIndex.TryGetOccurrenceContaining(point.Position);
+      return true;
+    }
+
+
+    /// <summary>
+    /// Attempts to find the nearest Doxygen command out of <paramref name="doxygenCmds"/> (given without the
+    /// "\" or "@") that occurs on the lines before the line containing <paramref name="point"/>, searching
+    /// backward no further than <paramref name="backwardsSearchStopPosition"/>'s line, purely from the
+    /// command index. Returns true if the index is authoritative for the whole searched range, i.e. if every
+    /// line in the range is in the cache; <paramref name="occurrence"/> is then the found occurrence or null.
+    /// Returns false if some line is not cached; the caller must then fall back to parsing the lines.
+    /// </summary>
+    public bool TryFindIndexedCommandBefore(
+        SnapshotPoint point, int backwardsSearchStopPosition, string[] doxygenCmds,
+        out CommentCommandIndex.CommandOccurrence occurrence)
+    {
+      ThreadHelper.ThrowIfNotOnUIThread();
+      occurrence = null;
+
+      ITextSnapshot snapshot = point.Snapshot;
+      TranslateCacheToSnapshot(snapshot);
+
+      int stopLineNumber = snapshot.GetLineFromPosition(backwardsSearchStopPosition).LineNumber;
+      int pointLineNumber = point.GetContainingLineNumber();
+      if (pointLineNumber - 1 < stopLineNumber) {
+        return true; // Empty search range; authoritatively "no command found".
+      }
+
+      int rangeStart = snapshot.GetLineFromLineNumber(stopLineNumber).Start;
+      int rangeEnd = point.GetContainingLine().Start;
+      for (int lineNum = stopLineNumber; lineNum <= pointLineNumber - 1; ++lineNum) {
+        if (!mCache.TryGetValue(snapshot.GetLineFromLineNumber(lineNum).ExtentIncludingLineBreak.Span, out CacheEntry entry)
+            || !entry.MirroredInCommandIndex) {
+          return false;
+        }
+        entry.LastAccessStamp = ++sNextAccessStamp; // As in TryGetIndexedCommandAt().
+        mLastAccessStamp = entry.LastAccessStamp;
+      }
+
+      occurrence = mCommandIndex.TryFindLastOccurrenceInRange(rangeStart, rangeEnd, doxygenCmds);
+      return true;
+    }
+
+
     // When this function is called, the user clicked on "OK" in the options, or the list of Doxygen commands changed.
     // We need to re-initialize most things.
     // Note that with the current implementation, this is fired twice whenever the user clicked "OK" in the options:
@@ -310,32 +992,387 @@ namespace VSDoxyHighlighter
 
       // Some of our settings might or might not have changed. Regardless, we force a re-classification of the whole text.
       // This ensures that any possible changes become visible immediately.
+      //
+      // However, we do this immediately only for buffers that are currently displayed somewhere. All other open
+      // buffers get their whole-document reclassification staggered with a small delay per buffer: Every classifier
+      // runs this handler when the user clicks "OK" in the options, and firing ClassificationChanged for hundreds
+      // of open files in one go froze the UI for seconds. With the stagger, the visible documents update at once
+      // and the rest follows progressively while the UI stays responsive.
+      if (AnyTextViewDisplaysBuffer()) {
+        FireClassificationChangedForWholeBuffer();
+      }
+      else {
+        int slot = ++sNumPendingStaggeredReclassifications;
+        _ = ThreadHelper.JoinableTaskFactory.RunAsync(async () => {
+          await Task.Delay(cStaggeredReclassificationDelayInMs * slot);
+          await ThreadHelper.JoinableTaskFactory.SwitchToMainThreadAsync();
+          --sNumPendingStaggeredReclassifications;
+          if (!mDisposed) {
+            FireClassificationChangedForWholeBuffer();
+          }
+        });
+      }
+    }
+
+
+    private void FireClassificationChangedForWholeBuffer()
+    {
       ClassificationChanged?.Invoke(this, new ClassificationChangedEventArgs(
         new SnapshotSpan(mTextBuffer.CurrentSnapshot, new Span(0, mTextBuffer.CurrentSnapshot.Length))));
     }
 
 
+    private bool AnyTextViewDisplaysBuffer()
+    {
+      List<ITextView> textViews = CommentTextViewTracker.GetTextViews(mTextBuffer);
+      if (textViews == null) {
+        return false;
+      }
+      foreach (ITextView textView in textViews) {
+        if (!textView.IsClosed && !textView.InLayout && textView.TextViewLines != null) {
+          return true;
+        }
+      }
+      return false;
+    }
+
+
     // When this is called, the default Visual Studio cpp colorer updated some colors (i.e. some classifications).
-    private void OnVSCppColorerReclassifiedSpan(object sender, SnapshotSpanEventArgs e) 
+    private void OnVSCppColorerReclassifiedSpan(object sender, SnapshotSpanEventArgs e)
     {
-      InvalidateCache();
+      // Only drop the cache entries that are affected by the re-classified span. The VS cpp colorer fires this
+      // event after every edit (it updates its tags with a delay). If we threw away the whole cache here, the
+      // incremental cache translation in ParseSpan() would be pointless, since this event arrives shortly after
+      // each keystroke. Note that edits which actually change the comment structure (typing "/*", etc.) always
+      // contain one of the comment-structure characters and therefore already caused a full invalidation in
+      // TranslateCacheThroughChanges() before this event arrives.
+      TranslateCacheToSnapshot(e.Span.Snapshot);
+      if (!mPersistentCacheRestoreActive) {
+        InvalidateCacheInSpan(e.Span.Span);
+      }
+      // If the cache got restored from the persistent sidecar cache and the document was not edited since,
+      // the entries are known to be correct: They were computed in a session in which the VS cpp colorer had
+      // fully classified the very same document content. The colorer's initial TagsChanged burst after
+      // opening the document must then not invalidate them (that would re-parse the whole visible region and
+      // make the restore pointless). The comment extractor's cache is invalidated regardless, since it
+      // mirrors the colorer's tags directly and is cheap to refill.
+      mCommentExtractor.InvalidateCacheInSpan(e.Span.Span);
 
       // Since our classification logic is based on the VS cpp colorer (due to the cache, but also because of the CommentExtractor),
       // we need to trigger a reclassification, too. In principle, even without us triggering another reclassification, the one from
       // the VS cpp colorer might be enough. However, this would depend on the execution order of the listeners of the VS cpp
       // colorer's TagsChanged event. This is brittle. So we trigger one ourselves.
-      ClassificationChanged?.Invoke(this, new ClassificationChangedEventArgs(e.Span));
+      //
+      // We do not fire the event immediately, though: The VS cpp colorer tends to fire its TagsChanged event in
+      // bursts (often with several overlapping spans for a single edit), and on top of that every pass over a
+      // span is amplified by the outlining feature and by aggregators of other extensions (compare the list in
+      // ParseSpan()). Hence, we collect the spans of a burst for a short moment and then fire a single
+      // ClassificationChanged per merged span, which cuts the number of redundant reparses during fast typing
+      // considerably. The cache invalidation above already happened, so any classification request arriving
+      // during the coalescing window is still answered correctly (just based on a fresh parse).
+      ++NumCppColorerReclassificationEvents;
+      mPendingReclassificationSpans.Add(e.Span);
+      if (mReclassificationCoalescingPending) {
+        ++NumCoalescedCppColorerReclassifications;
+        return;
+      }
+      mReclassificationCoalescingPending = true;
+
+      _ = ThreadHelper.JoinableTaskFactory.RunAsync(async () => {
+        try {
+          await Task.Delay(cReclassificationCoalescingDelayInMs);
+          await ThreadHelper.JoinableTaskFactory.SwitchToMainThreadAsync();
+        }
+        finally {
+          // Reset before firing, so that an event arriving while the listeners run starts a new burst.
+          mReclassificationCoalescingPending = false;
+        }
+        FirePendingCoalescedReclassifications();
+      });
+    }
+
+
+    /// <summary>
+    /// Fires ClassificationChanged for the spans collected during one burst of VS cpp colorer events.
+    /// The collected spans get translated to the current snapshot (the buffer might have been edited during
+    /// the coalescing window) and merged, so that overlapping spans of the burst cause only one reparse.
+    /// </summary>
+    private void FirePendingCoalescedReclassifications()
+    {
+      ThreadHelper.ThrowIfNotOnUIThread();
+
+      if (mDisposed || mPendingReclassificationSpans.Count == 0) {
+        mPendingReclassificationSpans.Clear();
+        return;
+      }
+
+      ITextSnapshot currentSnapshot = mTextBuffer.CurrentSnapshot;
+      var translatedSpans = new List<SnapshotSpan>(mPendingReclassificationSpans.Count);
+      foreach (SnapshotSpan span in mPendingReclassificationSpans) {
+        translatedSpans.Add(span.TranslateTo(currentSnapshot, SpanTrackingMode.EdgeInclusive));
+      }
+      mPendingReclassificationSpans.Clear();
+
+      var normalizedSpans = new NormalizedSnapshotSpanCollection(translatedSpans);
+      foreach (SnapshotSpan mergedSpan in normalizedSpans) {
+        ClassificationChanged?.Invoke(this, new ClassificationChangedEventArgs(mergedSpan));
+      }
     }
 
 
     private void InvalidateCache()
     {
-      mCache.Clear();
-      mCachedVersion = -1;
+      ClearOwnCache();
+      mCachedSnapshot = null;
+      mPersistentCacheRestoreActive = false;
+      DropPendingBackgroundParses();
+      ++mParseGeneration; // Causes still running background parses to drop their (now stale) results.
       mCommentExtractor.InvalidateCache();
     }
 
 
+    //-----------------------------------------------------------------------------------
+    // Cache management, including the global memory budget.
+    //
+    // The cache of every CommentClassifier instance (i.e. of every open document) counts its approximate
+    // memory consumption, and the sum over all instances is kept below the budget configured on the options
+    // page. Without the bound, the caches of all open documents would stay alive until the next edit of the
+    // respective document, which with hundreds of open documents adds up to hundreds of MB.
+
+    private void AddToCache(Span span, List<FormattedFragmentGroup> fragmentGroups)
+    {
+      if (mCache.TryGetValue(span, out CacheEntry existingEntry)) {
+        mCacheBytes -= existingEntry.ApproximateBytes;
+        sTotalCacheBytes -= existingEntry.ApproximateBytes;
+      }
+
+      var entry = new CacheEntry {
+        FragmentGroups = fragmentGroups,
+        LastAccessStamp = ++sNextAccessStamp,
+        ApproximateBytes = ApproximateCacheEntryBytes(fragmentGroups)
+      };
+
+      // Mirror the entry in the command index if its span is exactly one line, so that the quick info and
+      // the autocomplete can look up commands without re-driving the classification. See CommentCommandIndex
+      // for why only single-line entries get mirrored.
+      if (mCachedSnapshot != null && span.End <= mCachedSnapshot.Length) {
+        ITextSnapshotLine line = mCachedSnapshot.GetLineFromPosition(span.Start);
+        entry.MirroredInCommandIndex = (line.ExtentIncludingLineBreak.Span == span);
+        if (entry.MirroredInCommandIndex) {
+          mCommandIndex.UpdateSpan(span, fragmentGroups, mCachedSnapshot);
+        }
+      }
+
+      mCache[span] = entry;
+      mCacheBytes += entry.ApproximateBytes;
+      sTotalCacheBytes += entry.ApproximateBytes;
+      mLastAccessStamp = entry.LastAccessStamp;
+
+      EnforceCacheMemoryBudget();
+    }
+
+
+    private void RemoveFromCache(Span span)
+    {
+      if (mCache.TryGetValue(span, out CacheEntry entry)) {
+        mCache.Remove(span);
+        mCacheBytes -= entry.ApproximateBytes;
+        sTotalCacheBytes -= entry.ApproximateBytes;
+        if (entry.MirroredInCommandIndex) {
+          mCommandIndex.RemoveOccurrencesIn(span);
+        }
+      }
+    }
+
+
+    private void ClearOwnCache()
+    {
+      mCache.Clear();
+      mCommandIndex.Clear();
+      sTotalCacheBytes -= mCacheBytes;
+      mCacheBytes = 0;
+    }
+
+
+    // Rough estimate of the memory consumption of one cache entry: The dictionary slot and the CacheEntry
+    // object, plus the List and FormattedFragmentGroup objects, plus the FormattedFragment structs. The goal
+    // is not to be exact, only to be proportional to the real consumption, so that the configured budget is
+    // meaningful.
+    private static int ApproximateCacheEntryBytes(List<FormattedFragmentGroup> fragmentGroups)
+    {
+      int bytes = 96;
+      foreach (FormattedFragmentGroup group in fragmentGroups) {
+        bytes += 64 + group.Fragments.Count * 24;
+      }
+      return bytes;
+    }
+
+
+    private void EnforceCacheMemoryBudget()
+    {
+      int budgetMB = mGeneralOptions.CacheMemoryBudgetMB;
+      if (budgetMB <= 0) {
+        return; // No bound configured.
+      }
+      long budgetBytes = (long)budgetMB * 1024 * 1024;
+      if (sTotalCacheBytes <= budgetBytes) {
+        return;
+      }
+
+      // First stage ("generational"): Throw away the whole caches of the classifiers (i.e. documents) that
+      // have not been accessed for the longest time. With many open documents, this frees the memory of the
+      // documents that are not visible, while the cache of the actively viewed document stays untouched.
+      foreach (CommentClassifier classifier
+               in sAllClassifiers.Where(c => c != this && c.mCacheBytes > 0).OrderBy(c => c.mLastAccessStamp).ToArray()) {
+        if (sTotalCacheBytes <= budgetBytes) {
+          return;
+        }
+        classifier.ClearOwnCache();
+        ++NumCacheEvictionsOfWholeDocuments;
+      }
+
+      // Second stage: Only our own cache is left; evict its least recently used entries.
+      foreach (KeyValuePair<Span, CacheEntry> spanAndEntry in mCache.OrderBy(kvp => kvp.Value.LastAccessStamp).ToArray()) {
+        if (sTotalCacheBytes <= budgetBytes) {
+          return;
+        }
+        RemoveFromCache(spanAndEntry.Key);
+        ++NumCacheEvictionsOfSingleEntries;
+      }
+    }
+
+
+    /// <summary>
+    /// Brings the cache from the snapshot for which it was built to the given (newer) snapshot, by translating
+    /// the cached spans and fragments through all edits that happened in-between. Entries on or next to edited
+    /// lines are dropped (so that they get re-parsed), entries behind an edit are shifted by the edit's delta.
+    /// If an edit might have changed the comment structure (e.g. the user typed a "/*"), the whole cache is
+    /// invalidated, because then the comment type of every following line might have changed.
+    /// </summary>
+    private void TranslateCacheToSnapshot(ITextSnapshot targetSnapshot)
+    {
+      if (mCachedSnapshot == null
+          || mCachedSnapshot.TextBuffer != targetSnapshot.TextBuffer
+          || mCachedSnapshot.Version.VersionNumber > targetSnapshot.Version.VersionNumber) {
+        // No valid cache yet, or we got called with an older snapshot than the cached one (should not
+        // really happen). Start from scratch.
+        InvalidateCache();
+        mCachedSnapshot = targetSnapshot;
+        return;
+      }
+
+      if (mCachedSnapshot.Version.VersionNumber != targetSnapshot.Version.VersionNumber) {
+        // Any queued or still running background parse works on an outdated snapshot and will drop its
+        // result itself. Unmark the spans so that they can be scheduled again for the new snapshot.
+        DropPendingBackgroundParses();
+        // The first edit ends the protection of the entries restored from the persistent sidecar cache;
+        // from now on the VS cpp colorer's reclassification events must invalidate normally again.
+        mPersistentCacheRestoreActive = false;
+      }
+
+      // Walk forward through the version chain, applying the edits of every version one after another.
+      ITextVersion version = mCachedSnapshot.Version;
+      while (version.VersionNumber < targetSnapshot.Version.VersionNumber) {
+        INormalizedTextChangeCollection changes = version.Changes;
+        if (changes == null || !TranslateCacheThroughChanges(changes)) {
+          InvalidateCache();
+          mCachedSnapshot = targetSnapshot;
+          return;
+        }
+        version = version.Next;
+      }
+
+      mCachedSnapshot = targetSnapshot;
+    }
+
+
+    /// <summary>
+    /// Applies the edits of a single text buffer version to the cache. Returns false if the cache cannot be
+    /// translated and must be invalidated entirely.
+    /// </summary>
+    private bool TranslateCacheThroughChanges(INormalizedTextChangeCollection changes)
+    {
+      foreach (ITextChange change in changes) {
+        if (CommentExtractor.EditMightChangeCommentStructure(change.OldText)
+            || CommentExtractor.EditMightChangeCommentStructure(change.NewText)) {
+          // The edit removed or inserted a character that can start/end a comment or change its type
+          // (e.g. "/*" -> "/**"). In this case the comment type of every line after the edit might have
+          // changed, although the text of those lines did not. We cannot know this without re-parsing,
+          // so give up on the translation.
+          return false;
+        }
+      }
+
+      var translated = new Dictionary<Span, CacheEntry>(mCache.Count);
+      foreach (KeyValuePair<Span, CacheEntry> entry in mCache) {
+        Span cachedSpan = entry.Key;
+        int delta = 0;
+        bool dropped = false;
+        foreach (ITextChange change in changes) { // The changes are sorted and non-overlapping.
+          // Drop entries that intersect or directly touch the edited range (extended by one character, so
+          // that an edit at the very start or end of a line also drops the cached neighboring line, whose
+          // parse result might depend on the characters at the shared boundary).
+          if (cachedSpan.Start <= change.OldEnd + 1 && cachedSpan.End >= change.OldPosition - 1) {
+            dropped = true;
+            break;
+          }
+          else if (change.OldEnd < cachedSpan.Start) {
+            delta += change.Delta;
+          }
+          else {
+            break; // All further changes are behind the cached span and thus cannot affect it.
+          }
+        }
+
+        if (dropped) {
+          mCacheBytes -= entry.Value.ApproximateBytes;
+          sTotalCacheBytes -= entry.Value.ApproximateBytes;
+        }
+        else if (delta == 0) {
+          translated[cachedSpan] = entry.Value;
+        }
+        else {
+          // The fragments store absolute positions, so they need to be shifted, too. The CacheEntry object
+          // (and thus its access stamp and size) is reused; only the fragments are replaced.
+          entry.Value.FragmentGroups = ShiftFormattedFragmentGroups(entry.Value.FragmentGroups, delta).ToList();
+          translated[new Span(cachedSpan.Start + delta, cachedSpan.Length)] = entry.Value;
+        }
+      }
+
+      mCache = translated;
+      mCommandIndex.TranslateThroughChanges(changes);
+      return true;
+    }
+
+
+    /// <summary>
+    /// Removes all cache entries that intersect or directly touch the given span.
+    /// </summary>
+    private void InvalidateCacheInSpan(Span span)
+    {
+      List<Span> entriesToRemove = null;
+      foreach (Span cachedSpan in mCache.Keys) {
+        if (cachedSpan.Start <= span.End && cachedSpan.End >= span.Start) {
+          if (entriesToRemove == null) {
+            entriesToRemove = new List<Span>();
+          }
+          entriesToRemove.Add(cachedSpan);
+        }
+      }
+
+      if (entriesToRemove != null) {
+        foreach (Span spanToRemove in entriesToRemove) {
+          RemoveFromCache(spanToRemove);
+        }
+      }
+
+      // The tags of the VS cpp colorer changed in the span, and pending background parses started before the
+      // change (based on the old tags). Their results might be stale, so have them dropped.
+      ++mParseGeneration;
+      DropPendingBackgroundParses();
+    }
+
+
     private List<ClassificationSpan> FormattedFragmentGroupsToClassifications(ITextSnapshot textSnapshot, IEnumerable<FormattedFragmentGroup> formattedFragmentGroups)
     {
       var result = new List<ClassificationSpan>();
@@ -352,16 +1389,17 @@ namespace VSDoxyHighlighter
 
 
     /// <summary>
-    /// Converts the start of all given fragments to start at <paramref name="absoluteTextStart"/>.
+    /// Shifts the start of all given fragments by <paramref name="offset"/>. Used when translating cached
+    /// results through text buffer edits.
     /// </summary>
-    private IEnumerable<FormattedFragmentGroup> MakeFormattedFragmentGroupsAbsolute(IEnumerable<FormattedFragmentGroup> formattedCommands, int absoluteTextStart)
+    private IEnumerable<FormattedFragmentGroup> ShiftFormattedFragmentGroups(IEnumerable<FormattedFragmentGroup> formattedCommands, int offset)
     {
-      var withAbsolutePositions = formattedCommands.Select(
+      var shifted = formattedCommands.Select(
         origGroup => new FormattedFragmentGroup(
           origGroup.Fragments.Select(
-            fragment => new FormattedFragment(absoluteTextStart + fragment.StartIndex, fragment.Length, fragment.Classification))
+            fragment => new FormattedFragment(offset + fragment.StartIndex, fragment.Length, fragment.Classification))
           .ToList()));
-      return withAbsolutePositions;
+      return shifted;
     }
 
 
@@ -372,8 +1410,94 @@ namespace VSDoxyHighlighter
     private readonly IGeneralOptions mGeneralOptions;
     private readonly CommentParser mParser;
 
-    private Dictionary<Span, IEnumerable<FormattedFragmentGroup>> mCache = new Dictionary<Span, IEnumerable<FormattedFragmentGroup>>();
-    private int mCachedVersion = -1;
+    private class CacheEntry
+    {
+      public IEnumerable<FormattedFragmentGroup> FragmentGroups;
+      public long LastAccessStamp; // Compare sNextAccessStamp.
+      public int ApproximateBytes; // Estimated memory consumption of the entry, see ApproximateCacheEntryBytes().
+      public bool MirroredInCommandIndex; // True if the entry's command occurrences are in mCommandIndex.
+    }
+
+    private Dictionary<Span, CacheEntry> mCache = new Dictionary<Span, CacheEntry>();
+    // Ordered index of the Doxygen command occurrences of the single-line entries in mCache, kept in sync
+    // with the cache by AddToCache()/RemoveFromCache()/ClearOwnCache() and the cache translation.
+    private readonly CommentCommandIndex mCommandIndex = new CommentCommandIndex();
+    // The snapshot for which the entries in mCache are valid. The cache gets translated through the edits
+    // in ITextVersion.Changes when a newer snapshot comes in. Null if the cache is empty/invalid.
+    private ITextSnapshot mCachedSnapshot = null;
+    // Approximate memory consumption of mCache, and the stamp of its most recent access. Maintained for
+    // the global cache memory budget.
+    private long mCacheBytes = 0;
+    private long mLastAccessStamp = 0;
+
+    // All existing CommentClassifier instances, i.e. one per open document. Only accessed on the UI thread.
+    // Together, their caches are kept below the memory budget configured on the options page.
+    private static readonly List<CommentClassifier> sAllClassifiers = new List<CommentClassifier>();
+    private static long sNextAccessStamp = 0;
+    private static long sTotalCacheBytes = 0;
+
+    // Eviction counters; not used by the code itself, but can be inspected in a debugger or a memory dump
+    // to judge whether the configured budget is too small.
+    public static long NumCacheEvictionsOfWholeDocuments { get; private set; } = 0;
+    public static long NumCacheEvictionsOfSingleEntries { get; private set; } = 0;
+    public static long TotalCacheBytes { get { return sTotalCacheBytes; } }
+
+    // Counters for the coalescing of the VS cpp colorer's reclassification bursts; like the eviction
+    // counters, only meant for inspection in a debugger. The difference between the two is the number of
+    // redundant reparse passes that the coalescing eliminated.
+    public static long NumCppColorerReclassificationEvents { get; private set; } = 0;
+    public static long NumCoalescedCppColorerReclassifications { get; private set; } = 0;
+
+    // One queued request for the background parsing of a specific span.
+    private class PendingBackgroundParse
+    {
+      public ITextSnapshot Snapshot;
+      public List<CommentSpan> CommentSpans;
+    }
+
+    // Spans for which a background parse is currently queued or running, so that no second request gets
+    // scheduled for them while the first one is still pending. Only accessed on the UI thread.
+    private readonly HashSet<Span> mSpansBeingParsedInBackground = new HashSet<Span>();
+    // The queued background parse requests, drained by the pump with viewport priority.
+    // Only accessed on the UI thread.
+    private readonly Dictionary<Span, PendingBackgroundParse> mPendingBackgroundParses = new Dictionary<Span, PendingBackgroundParse>();
+    private bool mBackgroundParsingPumpRuns = false;
+    // How long the pump waits before it parses an off-screen span, to let requests for visible spans overtake.
+    private const int cOffScreenParseDelayInMs = 15;
+
+    // Delay between opening a document and the start of the whole-document pre-warm, to give the VS cpp
+    // tagger time to become available for the new buffer, and number of lines processed per pre-warm chunk.
+    private const int cPreWarmInitialDelayInMs = 1000;
+    private const int cPreWarmChunkSizeInLines = 200;
+
+    // True while the cache content stems from the persistent sidecar cache and the document was not edited
+    // since: The VS cpp colorer's initial reclassification burst must not invalidate the restored entries.
+    // Only touched on the UI thread.
+    private bool mPersistentCacheRestoreActive = false;
+    // Number of documents whose highlighting got restored from the persistent sidecar cache; like the other
+    // counters, only meant for inspection in a debugger.
+    public static long NumPersistentCacheRestores { get; private set; } = 0;
+
+    // The spans of the VS cpp colorer events of the current burst, waiting to be merged and fired as
+    // ClassificationChanged once the coalescing window elapsed. Only accessed on the UI thread.
+    private readonly List<SnapshotSpan> mPendingReclassificationSpans = new List<SnapshotSpan>();
+    private bool mReclassificationCoalescingPending = false;
+    // Length of the coalescing window. Events of the VS cpp colorer arriving within this time after the
+    // first one of a burst are merged into it. Small enough to not noticeably delay the highlighting of
+    // freshly typed text, but large enough to cover the bursts the colorer fires for a single edit.
+    private const int cReclassificationCoalescingDelayInMs = 50;
+
+    // Delay between the whole-document reclassifications of non-visible buffers after an options change.
+    // Each pending buffer waits one slot longer than the previous one, so they update one after another.
+    private const int cStaggeredReclassificationDelayInMs = 50;
+
+    // Number of staggered whole-document reclassifications that are currently waiting for their slot.
+    // Only touched on the UI thread.
+    private static int sNumPendingStaggeredReclassifications = 0;
+    // Incremented whenever cached or in-flight parse results become invalid for reasons other than a new
+    // text buffer version (settings changes, updated VS cpp colorer tags). Background parses compare it
+    // before publishing their result.
+    private int mParseGeneration = 0;
 
     private bool mDisposed = false;
 
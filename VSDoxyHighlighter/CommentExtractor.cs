@@ -1,6 +1,7 @@
 ﻿using Microsoft.VisualStudio.Text.Tagging;
 using Microsoft.VisualStudio.Text;
 using System;
+using System.Collections;
 using System.Collections.Generic;
 using System.Diagnostics;
 using System.Linq;
@@ -96,9 +97,53 @@ namespace VSDoxyHighlighter
     }
 
     
-    public void InvalidateCache() 
+    public void InvalidateCache()
     {
       mCommentTypeIdentification.InvalidateCache();
+      mLinesKnownWithoutComments = null;
+      mNoCommentLinesSnapshot = null;
+    }
+
+
+    /// <summary>
+    /// Removes the cached comment types of all comment fragments starting inside the given span, while
+    /// keeping the rest of the cache.
+    /// </summary>
+    public void InvalidateCacheInSpan(Span span)
+    {
+      mCommentTypeIdentification.InvalidateCacheInSpan(span);
+
+      // The tags of the VS cpp colorer changed in the span, so the lines there might now contain comments
+      // although they did not before. Unset their "definitely no comment" bits; the next extraction for
+      // those lines sets them again.
+      if (mLinesKnownWithoutComments != null && mNoCommentLinesSnapshot != null) {
+        int clampedStart = Math.Min(span.Start, mNoCommentLinesSnapshot.Length);
+        int clampedEnd = Math.Min(span.End, mNoCommentLinesSnapshot.Length);
+        int firstLine = mNoCommentLinesSnapshot.GetLineFromPosition(clampedStart).LineNumber;
+        int lastLine = mNoCommentLinesSnapshot.GetLineFromPosition(clampedEnd).LineNumber;
+        for (int lineNum = firstLine; lineNum <= lastLine; ++lineNum) {
+          mLinesKnownWithoutComments[lineNum] = false;
+        }
+      }
+    }
+
+
+    /// <summary>
+    /// Returns true if the given removed or inserted text might change where a comment starts or ends, or
+    /// the type of a comment. '/', '*' and '!' can start/end a comment or change its type, '\\' can be a
+    /// line continuation (which extends a "//" comment to the next line), quotes can turn comment starts
+    /// into string contents and vice versa, and newlines terminate "//" comments and change all following
+    /// line boundaries. I.e. if this returns false, the edit cannot affect the comment structure of any
+    /// line other than the directly edited ones.
+    /// </summary>
+    public static bool EditMightChangeCommentStructure(string changedText)
+    {
+      foreach (char c in changedText) {
+        if (c == '/' || c == '*' || c == '!' || c == '\\' || c == '"' || c == '\'' || c == '\n' || c == '\r') {
+          return true;
+        }
+      }
+      return false;
     }
 
 
@@ -172,7 +217,9 @@ namespace VSDoxyHighlighter
       //        or a comment line. But it does not. It seems to return a span of the whole line and, if the line break is included,
       //        also including the next line. But not the whole comment. So this is useless for our purpose.
 
-      IEnumerable<ITagSpan<IClassificationTag>> vsCppTags 
+      long startTimestamp = PerformanceMetrics.StartTiming();
+
+      IEnumerable<ITagSpan<IClassificationTag>> vsCppTags
         = mVSCppColorer.TryGetTags(new NormalizedSnapshotSpanCollection(spanToCheck.Snapshot, spanToCheck.Span));
       if (vsCppTags == null) {
         ActivityLog.LogWarning("VSDoxyHighlighter", "Failed to get tags from VS cpp colorer.");
@@ -199,6 +246,9 @@ namespace VSDoxyHighlighter
         //}
       }
 
+      MarkLinesWithoutComments(spanToCheck, result);
+
+      PerformanceMetrics.RecordCommentExtraction(startTimestamp, spanToCheck.Length);
       return result;
     }
 
@@ -207,12 +257,19 @@ namespace VSDoxyHighlighter
     /// If the character at 'point-1' is inside a comment, returns the type of the corresponding comment.
     /// Otherwise, returns null.
     /// </summary>
-    public CommentType? GetTypeOfCommentBeforeLocation(SnapshotPoint point) 
+    public CommentType? GetTypeOfCommentBeforeLocation(SnapshotPoint point)
     {
       if (point.Position == 0) {
         return null;
       }
 
+      // Fast path: This function gets called on every trigger-character keystroke (to decide whether the
+      // autocomplete should pop up). If the line got extracted before and is known to contain no comment at
+      // all, we can answer without consulting the VS cpp colorer.
+      if (IsPositionKnownToBeOutsideOfComments(point.Snapshot, point.Position - 1)) {
+        return null;
+      }
+
       var inputSpan = new SnapshotSpan(point.Snapshot, point.Position - 1, 1);
       List<CommentSpan> commentTypes = SplitIntoComments(inputSpan);
       Debug.Assert(commentTypes.Count <= 1);
@@ -225,6 +282,103 @@ namespace VSDoxyHighlighter
     }
 
 
+    /// <summary>
+    /// Returns true if it is known for certain that the given position is not inside any comment, based on
+    /// the "no comment on this line" bitmap. This is a conservative pre-filter: false only means that the
+    /// position *might* be in a comment, and the caller must consult the actual extraction machinery then.
+    /// The check is cheap (a bit lookup plus finding the line number), in contrast to SplitIntoComments(),
+    /// which drives the VS cpp colorer.
+    /// </summary>
+    public bool IsPositionKnownToBeOutsideOfComments(ITextSnapshot snapshot, int position)
+    {
+      TranslateNoCommentBitmapToSnapshot(snapshot);
+      if (mLinesKnownWithoutComments == null || position < 0 || position > snapshot.Length) {
+        return false;
+      }
+      int lineNumber = snapshot.GetLineFromPosition(position).LineNumber;
+      return lineNumber < mLinesKnownWithoutComments.Length && mLinesKnownWithoutComments[lineNumber];
+    }
+
+
+    /// <summary>
+    /// Feeds the "no comment on this line" bitmap with the outcome of an extraction: Every line that is
+    /// fully covered by the checked span and that overlaps none of the found comments definitely contains
+    /// no comment (the VS cpp colorer reported all comments overlapping the span, including those of type
+    /// Unknown). Only fully covered lines can be judged; for a partially covered line, a comment might hide
+    /// in the unchecked part. Since Visual Studio requests the classification of (at least) the visible
+    /// lines, the bitmap fills up with the lines the user actually types in.
+    /// </summary>
+    private void MarkLinesWithoutComments(SnapshotSpan spanToCheck, List<CommentSpan> foundComments)
+    {
+      ITextSnapshot snapshot = spanToCheck.Snapshot;
+      TranslateNoCommentBitmapToSnapshot(snapshot);
+
+      for (int lineNum = snapshot.GetLineFromPosition(spanToCheck.Start).LineNumber; lineNum < snapshot.LineCount; ++lineNum) {
+        ITextSnapshotLine line = snapshot.GetLineFromLineNumber(lineNum);
+        if (line.Start < spanToCheck.Start) {
+          continue; // Line only partially covered at the start of the span.
+        }
+        if (line.EndIncludingLineBreak > spanToCheck.End) {
+          break; // This line (and all further ones) is not fully covered by the span.
+        }
+
+        bool lineOverlapsComment = foundComments.Any(
+          c => c.span.Start < line.EndIncludingLineBreak && c.span.End > line.Start);
+        if (!lineOverlapsComment) {
+          if (mLinesKnownWithoutComments == null) {
+            mLinesKnownWithoutComments = new BitArray(snapshot.LineCount);
+          }
+          if (lineNum < mLinesKnownWithoutComments.Length) {
+            mLinesKnownWithoutComments[lineNum] = true;
+          }
+        }
+        else if (mLinesKnownWithoutComments != null && lineNum < mLinesKnownWithoutComments.Length) {
+          mLinesKnownWithoutComments[lineNum] = false;
+        }
+      }
+    }
+
+
+    /// <summary>
+    /// Brings the bitmap from the snapshot for which it was built to the given snapshot. Note that, unlike
+    /// the comment type cache, the bitmap needs no actual translation: Any edit that might change where a
+    /// comment starts or ends, or that inserts or removes line breaks (and thus changes the line count or
+    /// moves content between lines), contains one of the comment-structure characters and therefore resets
+    /// the bitmap entirely. All other edits keep every line's "contains no comment" property intact.
+    /// </summary>
+    private void TranslateNoCommentBitmapToSnapshot(ITextSnapshot targetSnapshot)
+    {
+      if (mNoCommentLinesSnapshot == null
+          || mNoCommentLinesSnapshot.TextBuffer != targetSnapshot.TextBuffer
+          || mNoCommentLinesSnapshot.Version.VersionNumber > targetSnapshot.Version.VersionNumber) {
+        mLinesKnownWithoutComments = null;
+        mNoCommentLinesSnapshot = targetSnapshot;
+        return;
+      }
+
+      ITextVersion version = mNoCommentLinesSnapshot.Version;
+      while (version.VersionNumber < targetSnapshot.Version.VersionNumber) {
+        INormalizedTextChangeCollection changes = version.Changes;
+        if (changes == null) {
+          mLinesKnownWithoutComments = null;
+          break;
+        }
+        foreach (ITextChange change in changes) {
+          if (EditMightChangeCommentStructure(change.OldText) || EditMightChangeCommentStructure(change.NewText)) {
+            mLinesKnownWithoutComments = null;
+            break;
+          }
+        }
+        if (mLinesKnownWithoutComments == null) {
+          break;
+        }
+        version = version.Next;
+      }
+
+      mNoCommentLinesSnapshot = targetSnapshot;
+    }
+
+
     /// <summary>
     /// Returns true if the given tag corresponds to one of the tags used by Visual Studio for comments.
     /// </summary>
@@ -244,6 +398,14 @@ namespace VSDoxyHighlighter
 
     private readonly IVisualStudioCppColorer mVSCppColorer;
     private readonly CommentTypeIdentification mCommentTypeIdentification;
+
+    // One bit per line of mNoCommentLinesSnapshot: A set bit means that the line is known for certain to
+    // contain no comment at all. An unset bit means "unknown". The bitmap is conservative: It gets fed only
+    // from successful extractions of fully covered lines, and it gets reset completely whenever an edit
+    // contains a character that might change the comment structure (which includes line breaks, so the line
+    // count cannot change while the bitmap is alive). Null if nothing is known.
+    private BitArray mLinesKnownWithoutComments = null;
+    private ITextSnapshot mNoCommentLinesSnapshot = null;
   }
 
 
@@ -271,11 +433,34 @@ namespace VSDoxyHighlighter
       // cleared before the reclassification gets triggered in CommentClassifier, we cannot use the event
       // IVisualStudioCppColorer.CppColorerReclassifiedSpan. Otherwise, the result would depend on the order
       // of the listeners in the event.
-      mFileVersionOfCache = -1;
+      mCachedSnapshot = null;
       mCommentTypeCache.Clear();
     }
 
 
+    /// <summary>
+    /// Removes the cached types of all comment fragments starting inside (or directly next to) the given span.
+    /// </summary>
+    public void InvalidateCacheInSpan(Span span)
+    {
+      List<int> keysToRemove = null;
+      foreach (int fragmentStartCharIdx in mCommentTypeCache.Keys) {
+        if (span.Start - 1 <= fragmentStartCharIdx && fragmentStartCharIdx <= span.End + 1) {
+          if (keysToRemove == null) {
+            keysToRemove = new List<int>();
+          }
+          keysToRemove.Add(fragmentStartCharIdx);
+        }
+      }
+
+      if (keysToRemove != null) {
+        foreach (int key in keysToRemove) {
+          mCommentTypeCache.Remove(key);
+        }
+      }
+    }
+
+
     /// <summary>
     /// Given a specific fragment of a comment (as identified by the Visual Studio's default cpp tagger),
     /// returns the type of that comment ("//", "///", "/*", etc).
@@ -299,11 +484,12 @@ namespace VSDoxyHighlighter
       // in the file until we hit the start of the comment for every single classification request. For example,
       // if we have a C-style comment with 10000 lines and attempt to scroll near the end of it, Visual Studio
       // constantly hangs for several seconds without the cache.
-      if (textSnapshot.Version.VersionNumber != mFileVersionOfCache) {
-        // File was edited, reset cache.
-        InvalidateCache();
-        mFileVersionOfCache = textSnapshot.Version.VersionNumber;
-      }
+      //
+      // Note that the cache is persistent: When the file gets edited, the cached entries get translated through
+      // the edits rather than thrown away. Otherwise, every single keystroke near the end of the 10000 lines
+      // C-style comment would again trigger one full backward scan through the comment (namely for the first
+      // classification request after the edit).
+      TranslateCacheToSnapshot(textSnapshot);
 
       // Stack: We go BACKWARD through the lines. So the top element of the stack represents
       // a line earlier in the text file.
@@ -378,6 +564,80 @@ namespace VSDoxyHighlighter
     }
 
 
+    /// <summary>
+    /// Brings the cache from the snapshot for which it was built to the given (newer) snapshot: The cached
+    /// fragment start indices get shifted through all edits that happened in-between, and the entries on
+    /// edited positions get dropped. If an edit might have changed the comment structure (e.g. the user
+    /// typed a "/*"), the whole cache gets invalidated, because then the comment type of every line in the
+    /// file might have changed.
+    /// </summary>
+    private void TranslateCacheToSnapshot(ITextSnapshot targetSnapshot)
+    {
+      if (mCachedSnapshot == null
+          || mCachedSnapshot.TextBuffer != targetSnapshot.TextBuffer
+          || mCachedSnapshot.Version.VersionNumber > targetSnapshot.Version.VersionNumber) {
+        InvalidateCache();
+        mCachedSnapshot = targetSnapshot;
+        return;
+      }
+
+      ITextVersion version = mCachedSnapshot.Version;
+      while (version.VersionNumber < targetSnapshot.Version.VersionNumber) {
+        INormalizedTextChangeCollection changes = version.Changes;
+        if (changes == null || !TranslateCacheThroughChanges(changes)) {
+          InvalidateCache();
+          mCachedSnapshot = targetSnapshot;
+          return;
+        }
+        version = version.Next;
+      }
+
+      mCachedSnapshot = targetSnapshot;
+    }
+
+
+    // Applies the edits of a single text buffer version to the cached fragment start indices. Returns false
+    // if the cache cannot be translated and must be invalidated entirely.
+    private bool TranslateCacheThroughChanges(INormalizedTextChangeCollection changes)
+    {
+      foreach (ITextChange change in changes) {
+        if (CommentExtractor.EditMightChangeCommentStructure(change.OldText)
+            || CommentExtractor.EditMightChangeCommentStructure(change.NewText)) {
+          return false;
+        }
+      }
+
+      var translated = new Dictionary<int, CommentType>(mCommentTypeCache.Count);
+      foreach (KeyValuePair<int, CommentType> entry in mCommentTypeCache) {
+        int fragmentStartCharIdx = entry.Key;
+        int delta = 0;
+        bool dropped = false;
+        foreach (ITextChange change in changes) { // The changes are sorted and non-overlapping.
+          // Drop entries whose fragment start lies in (or directly next to) the edited range; the fragment
+          // start might have moved in a way that a simple shift cannot express (e.g. when inserting text
+          // directly before the "//" of a comment at the end of a code line).
+          if (change.OldPosition - 1 <= fragmentStartCharIdx && fragmentStartCharIdx <= change.OldEnd + 1) {
+            dropped = true;
+            break;
+          }
+          else if (change.OldEnd < fragmentStartCharIdx) {
+            delta += change.Delta;
+          }
+          else {
+            break; // All further changes come after the fragment start and thus cannot affect it.
+          }
+        }
+
+        if (!dropped) {
+          translated[fragmentStartCharIdx + delta] = entry.Value;
+        }
+      }
+
+      mCommentTypeCache = translated;
+      return true;
+    }
+
+
     private CommentType IdentifyTypeOfCommentStartingAt(ITextSnapshot textSnapshot, int startOfCommentCharIndex)
     {
       string commentStart = textSnapshot.GetText(
@@ -595,8 +855,10 @@ namespace VSDoxyHighlighter
     private readonly IVisualStudioCppColorer mVSCppColorer;
 
     // For every start index of some comment fragment (index in terms of the character index in the file), we cache
-    // the resulting comment type for performance reasons. The cache gets reset after every edit.
-    private int mFileVersionOfCache = -1;
+    // the resulting comment type for performance reasons. The cache gets translated through every edit (or, if the
+    // edit might have changed the comment structure, reset); "mCachedSnapshot" is the snapshot for which the cached
+    // indices are valid (null if the cache is empty/invalid).
+    private ITextSnapshot mCachedSnapshot = null;
     private Dictionary<int /*commentFragmentStartCharIdx*/, CommentType> mCommentTypeCache = new Dictionary<int, CommentType>();
   }
 
@@ -0,0 +1,1046 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Linq;
+
+namespace VSDoxyHighlighter
+{
+  /// <summary>
+  /// Single-pass lexer that finds all Doxygen commands (i.e. fragments starting with "\" or "@") in a given
+  /// piece of comment text. It replaces the former approach of running one big alternation regex per
+  /// DoxygenCommandGroup over the whole text, which scanned the text once per command group (i.e. roughly
+  /// 20 times). Instead, the text is scanned exactly once: Whenever a "\" or "@" is found, the following
+  /// characters are matched against a prefix trie of the known commands, and the parameters of a
+  /// successfully matched command are then parsed according to the parameter parsing rule of the command's
+  /// group. For typical comment text, which consists mostly of prose, this is dramatically cheaper.
+  ///
+  /// The lexer is constructed from the configured DoxygenCommandGroups. Each group's RegexCreatorDelegate
+  /// is mapped to a hand-written parsing routine that mimics the regex built by that creator. The parsing
+  /// routines are intended to produce exactly the same fragments as the corresponding regexes; the existing
+  /// CommentParserTests are run against both implementations. Command groups with an unknown
+  /// RegexCreatorDelegate are not handled by the lexer; they are given back to the caller (CommentParser),
+  /// which runs the original regexes for them as a fallback. This keeps the door open for future custom
+  /// user commands with arbitrary regexes.
+  ///
+  /// Like the CommentParser, the lexer is independent of Visual Studio services, and thus can be easily
+  /// unit tested.
+  /// </summary>
+  internal class CommentLexer
+  {
+    /// <summary>
+    /// Creates a lexer for all command groups whose RegexCreatorDelegate is known to the lexer.
+    /// All other groups are added to <paramref name="groupsNotSupportedByLexer"/>; the caller is expected
+    /// to handle them via the original regexes.
+    /// </summary>
+    public static CommentLexer Create(
+        ICollection<DoxygenCommandGroup> commandGroups,
+        List<DoxygenCommandGroup> groupsNotSupportedByLexer)
+    {
+      var trieRoot = new CommandTrieNode();
+
+      foreach (DoxygenCommandGroup group in commandGroups) {
+        // The old regex based implementation skipped matches where the regex contained more capture groups
+        // than configured classifications. To get the same behavior (namely, that such commands are never
+        // highlighted), such groups are treated as unsupported: The corresponding fallback regex then
+        // produces matches that get skipped.
+        if (!cRegexCreatorToParamRule.TryGetValue(group.RegexCreator, out ParamRule rule)
+            || group.Classifications.Length < GetNumCaptureGroups(rule)) {
+          groupsNotSupportedByLexer.Add(group);
+          continue;
+        }
+
+        foreach (string command in group.Commands) {
+          if (command.Length == 0) {
+            Debug.Assert(false); // An empty Doxygen command should be impossible.
+            continue;
+          }
+
+          // Insert the command into the trie, one node per character.
+          CommandTrieNode node = trieRoot;
+          foreach (char c in command) {
+            if (!node.Children.TryGetValue(c, out CommandTrieNode childNode)) {
+              childNode = new CommandTrieNode();
+              node.Children[c] = childNode;
+            }
+            node = childNode;
+          }
+
+          Debug.Assert(node.Command == null); // The same command in more than one group should be impossible.
+          node.Command = new CommandInfo(command, rule, group.Classifications);
+        }
+      }
+
+      return new CommentLexer(trieRoot);
+    }
+
+
+    /// <summary>
+    /// Scans the whole given text once and appends one FormattedFragmentGroup for every found Doxygen
+    /// command to <paramref name="outputList"/>. The appended groups are sorted by their start index
+    /// and do not overlap. The fragment indices are in snapshot coordinates, i.e. they include the
+    /// TextSegment.OffsetInSnapshot of <paramref name="text"/>.
+    /// </summary>
+    public void FindAllCommandGroups(TextSegment text, List<FormattedFragmentGroup> outputList)
+    {
+      int idx = 0;
+      while (idx < text.Length) {
+        char c = text[idx];
+        if (c == '\\' || c == '@') {
+          FormattedFragmentGroup group = TryMatchCommandAt(text, idx);
+          if (group != null) {
+            outputList.Add(group);
+            // Continue after the last formatted fragment (note that the group indices are in snapshot
+            // coordinates, while "idx" is relative to the text). Anything starting before that point
+            // would overlap with the group we just found and thus would get discarded anyway by the
+            // "first one wins" overlap filtering in CommentParser.Parse().
+            idx = group.EndIndex + 1 - text.OffsetInSnapshot;
+            continue;
+          }
+        }
+        ++idx;
+      }
+    }
+
+
+    //-----------------------------------------------------------------------------------
+    // Matching of a single command
+
+    private FormattedFragmentGroup TryMatchCommandAt(TextSegment text, int prefixPos)
+    {
+      // Walk down the trie as far as the text allows, and remember every visited node that terminates
+      // a command. The cost is O(length of the longest matching command), independent of how many
+      // commands are configured.
+      List<CommandInfo> candidates = null;
+      CommandTrieNode node = mCommandTrieRoot;
+      int idx = prefixPos + 1;
+      while (idx < text.Length && node.Children.TryGetValue(text[idx], out CommandTrieNode childNode)) {
+        node = childNode;
+        ++idx;
+        if (node.Command != null) {
+          if (candidates == null) {
+            candidates = new List<CommandInfo>();
+          }
+          candidates.Add(node.Command);
+        }
+      }
+
+      if (candidates == null) {
+        return null;
+      }
+
+      // Try the candidates from the longest to the shortest so that the longest command wins. This mirrors
+      // ConcatKeywordsForRegex(), which orders the keywords the same way for the same reason. Note that
+      // even if a long command matches but its parameter rule then fails, we need to go on and try the
+      // shorter commands. Example: Considering "\param[in]" and "\param", for the text "\param[out]" the
+      // command "\param" must not match (because the rule requires whitespace after the command), but for
+      // the text "\param foo" it must.
+      for (int candidateIdx = candidates.Count - 1; candidateIdx >= 0; --candidateIdx) {
+        CommandInfo candidate = candidates[candidateIdx];
+        FormattedFragmentGroup group
+          = TryMatchParamRule(text, prefixPos, prefixPos + 1 + candidate.Command.Length, candidate);
+        if (group != null) {
+          return group;
+        }
+      }
+
+      return null;
+    }
+
+
+    private FormattedFragmentGroup TryMatchParamRule(TextSegment text, int prefixPos, int posAfterCmd, CommandInfo info)
+    {
+      // Check the context before the command prefix ("\" or "@").
+      if (RequiresCommentLineStart(info.Rule) && !IsAtCommentLineStart(text, prefixPos)) {
+        return null;
+      }
+      else if (ForbidsWordCharBeforePrefix(info.Rule) && prefixPos > 0 && IsWordChar(text[prefixPos - 1])) {
+        // Mirrors the "\B" before the command prefix in e.g. BuildRegex_KeywordSomewhereInLine_1RequiredParamAsWord.
+        return null;
+      }
+
+      switch (info.Rule) {
+        case ParamRule.AtLineStart_NoParam:
+        case ParamRule.Anywhere_NoParam_WhitespaceAfterwards:
+          return IsWhitespaceNewlineOrEnd(text, posAfterCmd) ? CommandOnlyGroup(text, prefixPos, posAfterCmd, info) : null;
+
+        case ParamRule.Anywhere_NoParam:
+          return CommandOnlyGroup(text, prefixPos, posAfterCmd, info);
+
+        case ParamRule.CodeCommand:
+          return TryMatchCodeCommand(text, prefixPos, posAfterCmd, info);
+
+        case ParamRule.FormulaEnvironmentStart:
+          return TryMatchFormulaEnvironmentStart(text, prefixPos, posAfterCmd, info);
+
+        case ParamRule.Language:
+          return MatchLanguageCommand(text, prefixPos, posAfterCmd, info);
+
+        case ParamRule.AtLineStart_1ParamAsWord:
+        case ParamRule.InLine_1ParamAsWord:
+          return TryMatch1ParamAsWord(text, prefixPos, posAfterCmd, info);
+
+        case ParamRule.AtLineStart_1ParamTillEnd:
+          return TryMatch1ParamTillEnd(text, prefixPos, posAfterCmd, info);
+
+        case ParamRule.AtLineStart_1OptionalParamTillEnd:
+          return TryMatch1OptionalParamTillEnd(text, prefixPos, posAfterCmd, info);
+
+        case ParamRule.AtLineStart_1ParamAsWord_1OptionalParamTillEnd:
+          return TryMatch1ParamAsWord_1OptionalParamTillEnd(text, prefixPos, posAfterCmd, info);
+
+        case ParamRule.AtLineStart_1QuotedParam_1OptionalParamTillEnd:
+          return TryMatch1QuotedParam_1OptionalParamTillEnd(text, prefixPos, posAfterCmd, info);
+
+        case ParamRule.AtLineStart_1ParamAsWord_1OptionalParamAsWord_1OptionalParamTillEnd:
+          return TryMatch2ParamsAsWord_1OptionalParamTillEnd(text, prefixPos, posAfterCmd, info);
+
+        case ParamRule.InLine_1ParamAsWordOrQuoted:
+          return TryMatch1ParamAsWordOrQuoted(text, prefixPos, posAfterCmd, info);
+
+        case ParamRule.InLine_1ParamAsWord_1OptionalQuotedParam:
+          return TryMatch1ParamAsWord_1OptionalQuotedParam(text, prefixPos, posAfterCmd, info);
+
+        case ParamRule.OptionalCaptionAndSize:
+          return TryMatchOptionalCaptionAndSize(text, prefixPos, posAfterCmd, info);
+
+        case ParamRule.StartUmlCommand:
+          return MatchStartUmlCommand(text, prefixPos, posAfterCmd, info);
+
+        case ParamRule.File_OptionalCaptionAndSize:
+          return TryMatchFile_OptionalCaptionAndSize(text, prefixPos, posAfterCmd, info);
+
+        case ParamRule.ImageCommand:
+          return TryMatchImageCommand(text, prefixPos, posAfterCmd, info);
+
+        default:
+          Debug.Assert(false); // Missing case?
+          return null;
+      }
+    }
+
+
+    // Mirrors BuildRegex_CodeCommand: "\code" or "\code{.ext}" with a known file extension,
+    // followed by whitespace, a newline or the end of the text.
+    private FormattedFragmentGroup TryMatchCodeCommand(TextSegment text, int prefixPos, int posAfterCmd, CommandInfo info)
+    {
+      int cmdEnd = posAfterCmd;
+      if (cmdEnd < text.Length && text[cmdEnd] == '{') {
+        // If a "{" follows, it must be a valid "{.ext}" part. Otherwise, the whole match fails (because
+        // then no whitespace follows after the command).
+        if (cmdEnd + 1 >= text.Length || text[cmdEnd + 1] != '.') {
+          return null;
+        }
+        int closingBrace = text.IndexOf('}', cmdEnd + 2);
+        if (closingBrace <= cmdEnd + 2) {
+          return null;
+        }
+        string extension = text.Substring(cmdEnd + 2, closingBrace - (cmdEnd + 2));
+        if (!cCodeFileExtensions.Contains(extension)) {
+          return null;
+        }
+        cmdEnd = closingBrace + 1;
+      }
+
+      if (!IsWhitespaceNewlineOrEnd(text, cmdEnd)) {
+        return null;
+      }
+      return CommandOnlyGroup(text, prefixPos, cmdEnd, info);
+    }
+
+
+    // Mirrors BuildRegex_FormulaEnvironmentStart: "\f{environment}{". Note that the "{...}" part is matched
+    // greedily till the **last** "}" in the line, just like the ".*" in the regex.
+    private FormattedFragmentGroup TryMatchFormulaEnvironmentStart(TextSegment text, int prefixPos, int posAfterCmd, CommandInfo info)
+    {
+      if (posAfterCmd >= text.Length || text[posAfterCmd] != '{') {
+        return null;
+      }
+      int endOfLine = FindEndOfLine(text, posAfterCmd);
+      int lastClosingBrace = text.LastIndexOf('}', endOfLine - 1, endOfLine - posAfterCmd);
+      if (lastClosingBrace <= posAfterCmd) {
+        return null;
+      }
+      int cmdEnd = lastClosingBrace + 1;
+      if (cmdEnd < text.Length && text[cmdEnd] == '{') {
+        ++cmdEnd;
+      }
+      return CommandOnlyGroup(text, prefixPos, cmdEnd, info);
+    }
+
+
+    // Mirrors BuildRegex_Language: "\~" followed by an optional language id, which consists of one
+    // arbitrary non-space character and at least one word character.
+    private FormattedFragmentGroup MatchLanguageCommand(TextSegment text, int prefixPos, int posAfterCmd, CommandInfo info)
+    {
+      int cmdEnd = posAfterCmd;
+      if (posAfterCmd < text.Length && !IsSpaceOrTab(text[posAfterCmd])) {
+        int wordEnd = posAfterCmd + 1;
+        while (wordEnd < text.Length && IsWordChar(text[wordEnd])) {
+          ++wordEnd;
+        }
+        if (wordEnd > posAfterCmd + 1) {
+          cmdEnd = wordEnd;
+        }
+      }
+      return CommandOnlyGroup(text, prefixPos, cmdEnd, info);
+    }
+
+
+    // Mirrors BuildRegex_KeywordAtLineStart_1RequiredParamAsWord ("(\w[^ \t\n\r]*)?" parameter) and
+    // BuildRegex_KeywordSomewhereInLine_1RequiredParamAsWord ("([^ \t\n\r]*)?" parameter).
+    private FormattedFragmentGroup TryMatch1ParamAsWord(TextSegment text, int prefixPos, int posAfterCmd, CommandInfo info)
+    {
+      if (IsNewlineOrEnd(text, posAfterCmd)) {
+        return CommandOnlyGroup(text, prefixPos, posAfterCmd, info);
+      }
+      if (!IsSpaceOrTab(text[posAfterCmd])) {
+        return null;
+      }
+
+      int paramStart = SkipSpacesAndTabs(text, posAfterCmd);
+      int paramEnd = paramStart;
+      if (info.Rule == ParamRule.AtLineStart_1ParamAsWord) {
+        // The parameter must start with a word character.
+        if (paramStart < text.Length && IsWordChar(text[paramStart])) {
+          paramEnd = SkipNonWhitespace(text, paramStart);
+        }
+      }
+      else {
+        paramEnd = SkipNonWhitespace(text, paramStart);
+      }
+
+      var fragments = NewFragmentsWithCommand(text, prefixPos, posAfterCmd, info);
+      AddParam(text, fragments, info, 1, paramStart, paramEnd - paramStart);
+      return new FormattedFragmentGroup(fragments);
+    }
+
+
+    // Mirrors BuildRegex_KeywordAtLineStart_1RequiredParamTillEnd.
+    private FormattedFragmentGroup TryMatch1ParamTillEnd(TextSegment text, int prefixPos, int posAfterCmd, CommandInfo info)
+    {
+      if (IsNewlineOrEnd(text, posAfterCmd)) {
+        return CommandOnlyGroup(text, prefixPos, posAfterCmd, info);
+      }
+      if (!IsSpaceOrTab(text[posAfterCmd])) {
+        return null;
+      }
+
+      int paramStart = SkipSpacesAndTabs(text, posAfterCmd);
+      int paramEnd = FindEndOfLine(text, paramStart);
+
+      var fragments = NewFragmentsWithCommand(text, prefixPos, posAfterCmd, info);
+      AddParam(text, fragments, info, 1, paramStart, paramEnd - paramStart);
+      return new FormattedFragmentGroup(fragments);
+    }
+
+
+    // Mirrors BuildRegex_KeywordAtLineStart_1OptionalParamTillEnd. Note that there must be a word boundary
+    // after the command, but no whitespace is required before the parameter (e.g. in "\par: Title" the
+    // parameter is ": Title").
+    private FormattedFragmentGroup TryMatch1OptionalParamTillEnd(TextSegment text, int prefixPos, int posAfterCmd, CommandInfo info)
+    {
+      if (!IsAtWordBoundary(text, posAfterCmd)) {
+        return null;
+      }
+
+      int paramStart = SkipSpacesAndTabs(text, posAfterCmd);
+      int paramEnd = FindEndOfLine(text, paramStart);
+
+      var fragments = NewFragmentsWithCommand(text, prefixPos, posAfterCmd, info);
+      AddParam(text, fragments, info, 1, paramStart, paramEnd - paramStart);
+      return new FormattedFragmentGroup(fragments);
+    }
+
+
+    // Mirrors BuildRegex_KeywordAtLineStart_1RequiredParamAsWord_1OptionalParamTillEnd.
+    private FormattedFragmentGroup TryMatch1ParamAsWord_1OptionalParamTillEnd(TextSegment text, int prefixPos, int posAfterCmd, CommandInfo info)
+    {
+      if (IsNewlineOrEnd(text, posAfterCmd)) {
+        return CommandOnlyGroup(text, prefixPos, posAfterCmd, info);
+      }
+      if (!IsSpaceOrTab(text[posAfterCmd])) {
+        return null;
+      }
+
+      var fragments = NewFragmentsWithCommand(text, prefixPos, posAfterCmd, info);
+
+      int param1Start = SkipSpacesAndTabs(text, posAfterCmd);
+      int param1End = SkipNonWhitespace(text, param1Start);
+      if (param1End > param1Start) {
+        AddParam(text, fragments, info, 1, param1Start, param1End - param1Start);
+
+        // The optional "till the end of the line" parameter requires its own whitespace.
+        if (param1End < text.Length && IsSpaceOrTab(text[param1End])) {
+          int param2Start = SkipSpacesAndTabs(text, param1End);
+          AddParam(text, fragments, info, 2, param2Start, FindEndOfLine(text, param2Start) - param2Start);
+        }
+      }
+
+      return new FormattedFragmentGroup(fragments);
+    }
+
+
+    // Mirrors BuildRegex_KeywordAtLineStart_1RequiredQuotedParam_1OptionalParamTillEnd.
+    private FormattedFragmentGroup TryMatch1QuotedParam_1OptionalParamTillEnd(TextSegment text, int prefixPos, int posAfterCmd, CommandInfo info)
+    {
+      if (IsNewlineOrEnd(text, posAfterCmd)) {
+        return CommandOnlyGroup(text, prefixPos, posAfterCmd, info);
+      }
+      if (!IsSpaceOrTab(text[posAfterCmd])) {
+        return null;
+      }
+
+      var fragments = NewFragmentsWithCommand(text, prefixPos, posAfterCmd, info);
+
+      int afterWhitespace = SkipSpacesAndTabs(text, posAfterCmd);
+
+      // Note: If there is no quoted parameter, the "till the end of the line" parameter cannot match
+      // either: The greedy "[ \t]+" before the quotes consumed all the whitespace already, and since all
+      // the parameters are optional in the regex, the regex engine never backtracks into it.
+      int quoteEnd = TryScanQuotedInLine(text, afterWhitespace);
+      if (quoteEnd >= 0) {
+        AddParam(text, fragments, info, 1, afterWhitespace, quoteEnd - afterWhitespace);
+        if (quoteEnd < text.Length && IsSpaceOrTab(text[quoteEnd])) {
+          int param2Start = SkipSpacesAndTabs(text, quoteEnd);
+          AddParam(text, fragments, info, 2, param2Start, FindEndOfLine(text, param2Start) - param2Start);
+        }
+      }
+
+      return new FormattedFragmentGroup(fragments);
+    }
+
+
+    // Mirrors BuildRegex_KeywordAtLineStart_1RequiredParamAsWord_1OptionalParamAsWord_1OptionalParamTillEnd.
+    private FormattedFragmentGroup TryMatch2ParamsAsWord_1OptionalParamTillEnd(TextSegment text, int prefixPos, int posAfterCmd, CommandInfo info)
+    {
+      if (IsNewlineOrEnd(text, posAfterCmd)) {
+        return CommandOnlyGroup(text, prefixPos, posAfterCmd, info);
+      }
+      if (!IsSpaceOrTab(text[posAfterCmd])) {
+        return null;
+      }
+
+      var fragments = NewFragmentsWithCommand(text, prefixPos, posAfterCmd, info);
+
+      int afterWhitespace = SkipSpacesAndTabs(text, posAfterCmd);
+
+      // Note: If the first parameter does not match (it must start with a word character), the later
+      // parameters cannot match either: The greedy "[ \t]+" consumed all the whitespace already, and
+      // since all the parameters are optional in the regex, the regex engine never backtracks into it.
+      if (afterWhitespace < text.Length && IsWordChar(text[afterWhitespace])) {
+        int param1End = SkipNonWhitespace(text, afterWhitespace);
+        AddParam(text, fragments, info, 1, afterWhitespace, param1End - afterWhitespace);
+        if (param1End < text.Length && IsSpaceOrTab(text[param1End])) {
+          int param2Start = SkipSpacesAndTabs(text, param1End);
+          int param2End = SkipNonWhitespace(text, param2Start);
+          AddParam(text, fragments, info, 2, param2Start, param2End - param2Start);
+          if (param2End < text.Length && IsSpaceOrTab(text[param2End])) {
+            int param3Start = SkipSpacesAndTabs(text, param2End);
+            AddParam(text, fragments, info, 3, param3Start, FindEndOfLine(text, param3Start) - param3Start);
+          }
+        }
+      }
+
+      return new FormattedFragmentGroup(fragments);
+    }
+
+
+    // Mirrors BuildRegex_KeywordSomewhereInLine_1RequiredParamAsWordOrQuoted.
+    private FormattedFragmentGroup TryMatch1ParamAsWordOrQuoted(TextSegment text, int prefixPos, int posAfterCmd, CommandInfo info)
+    {
+      if (!IsAtWordBoundary(text, posAfterCmd)) {
+        return null;
+      }
+
+      var fragments = NewFragmentsWithCommand(text, prefixPos, posAfterCmd, info);
+
+      int afterWhitespace = SkipSpacesAndTabs(text, posAfterCmd);
+      int numWhitespaceChars = afterWhitespace - posAfterCmd;
+
+      // The quoted variant may directly follow the command, and may span multiple lines ("[^\"]*" in the regex).
+      if (afterWhitespace < text.Length && text[afterWhitespace] == '"') {
+        int closingQuote = text.IndexOf('"', afterWhitespace + 1);
+        if (closingQuote >= 0) {
+          AddParam(text, fragments, info, 1, afterWhitespace, closingQuote + 1 - afterWhitespace);
+          return new FormattedFragmentGroup(fragments);
+        }
+      }
+
+      // The non-quoted variant requires at least one whitespace before it ("(?<=[ \t])" in the regex).
+      if (numWhitespaceChars >= 1) {
+        int paramEnd = SkipNonWhitespace(text, afterWhitespace);
+        AddParam(text, fragments, info, 1, afterWhitespace, paramEnd - afterWhitespace);
+      }
+
+      return new FormattedFragmentGroup(fragments);
+    }
+
+
+    // Mirrors BuildRegex_KeywordSomewhereInLine_1RequiredParamAsWord_1OptionalQuotedParam (i.e. especially
+    // the "\ref" command, whose parameter may contain "::", "." and a trailing "(...)" part).
+    private FormattedFragmentGroup TryMatch1ParamAsWord_1OptionalQuotedParam(TextSegment text, int prefixPos, int posAfterCmd, CommandInfo info)
+    {
+      if (IsNewlineOrEnd(text, posAfterCmd)) {
+        return CommandOnlyGroup(text, prefixPos, posAfterCmd, info);
+      }
+      if (!IsSpaceOrTab(text[posAfterCmd])) {
+        return null;
+      }
+
+      var fragments = NewFragmentsWithCommand(text, prefixPos, posAfterCmd, info);
+
+      int afterWhitespace = SkipSpacesAndTabs(text, posAfterCmd);
+
+      // Note: If the first parameter does not match, the quoted parameter cannot match either: The greedy
+      // "[ \t]+" consumed all the whitespace already, and since all the parameters are optional in the
+      // regex, the regex engine never backtracks into it.
+      int param1End = ScanRefParamName(text, afterWhitespace);
+      if (param1End > afterWhitespace) {
+        // Optionally match "(...)" after the name, e.g. "\ref func(double, int)". Mirroring the lazy
+        // "\(.*?\)" in the regex, everything up to the next ")" in the same line belongs to the parameter.
+        if (param1End < text.Length && text[param1End] == '(') {
+          int endOfLine = FindEndOfLine(text, param1End);
+          int closingParen = text.IndexOf(')', param1End + 1, endOfLine - (param1End + 1) < 0 ? 0 : endOfLine - (param1End + 1));
+          if (closingParen >= 0) {
+            param1End = closingParen + 1;
+          }
+        }
+        AddParam(text, fragments, info, 1, afterWhitespace, param1End - afterWhitespace);
+
+        // Optional quoted parameter, requiring its own whitespace.
+        if (param1End < text.Length && IsSpaceOrTab(text[param1End])) {
+          int quoteStart = SkipSpacesAndTabs(text, param1End);
+          int quoteEnd = TryScanQuotedInLine(text, quoteStart);
+          AddParam(text, fragments, info, 2, quoteStart, quoteEnd >= 0 ? quoteEnd - quoteStart : 0);
+        }
+      }
+
+      return new FormattedFragmentGroup(fragments);
+    }
+
+
+    // Mirrors BuildRegex_1OptionalCaption_1OptionalSizeIndication (after the command).
+    private FormattedFragmentGroup TryMatchOptionalCaptionAndSize(TextSegment text, int prefixPos, int posAfterCmd, CommandInfo info)
+    {
+      if (!IsAtWordBoundary(text, posAfterCmd)) {
+        return null;
+      }
+      var fragments = NewFragmentsWithCommand(text, prefixPos, posAfterCmd, info);
+      MatchOptionalCaptionAndSizeParams(text, posAfterCmd, info, firstParamSlot: 1, fragments);
+      return new FormattedFragmentGroup(fragments);
+    }
+
+
+    // Mirrors BuildRegex_StartUmlCommandWithBracesOptions: "\startuml{options}" plus the optional
+    // caption and size parameters. Note: No word boundary is required after the command.
+    private FormattedFragmentGroup MatchStartUmlCommand(TextSegment text, int prefixPos, int posAfterCmd, CommandInfo info)
+    {
+      int cmdEnd = TrySkipLazyBracesOption(text, posAfterCmd);
+      var fragments = NewFragmentsWithCommand(text, prefixPos, cmdEnd, info);
+      MatchOptionalCaptionAndSizeParams(text, cmdEnd, info, firstParamSlot: 1, fragments);
+      return new FormattedFragmentGroup(fragments);
+    }
+
+
+    // Mirrors BuildRegex_1File_1OptionalCaption_1OptionalSizeIndication.
+    private FormattedFragmentGroup TryMatchFile_OptionalCaptionAndSize(TextSegment text, int prefixPos, int posAfterCmd, CommandInfo info)
+    {
+      if (!IsAtWordBoundary(text, posAfterCmd)) {
+        return null;
+      }
+      var fragments = NewFragmentsWithCommand(text, prefixPos, posAfterCmd, info);
+      int afterFile = MatchOptionalFileParam(text, posAfterCmd, info, paramSlot: 1, fragments);
+      MatchOptionalCaptionAndSizeParams(text, afterFile, info, firstParamSlot: 2, fragments);
+      return new FormattedFragmentGroup(fragments);
+    }
+
+
+    // Mirrors BuildRegex_ImageCommand: "\image{options}" followed by the output format, a file,
+    // and the optional caption and size parameters.
+    private FormattedFragmentGroup TryMatchImageCommand(TextSegment text, int prefixPos, int posAfterCmd, CommandInfo info)
+    {
+      int cmdEnd = posAfterCmd;
+      if (posAfterCmd < text.Length && text[posAfterCmd] == '{') {
+        // The "{options}" part. Note that whitespace, a newline or the end of the text must follow after
+        // the command. If that is not the case for the first "}", the lazy "{.*?}" of the regex expands
+        // to the next "}" in the line, and so on. (This cannot happen for e.g. "\startuml", where
+        // everything after the command is optional and thus the regex never backtracks.)
+        int endOfLine = FindEndOfLine(text, posAfterCmd);
+        int closingBrace = posAfterCmd;
+        while (true) {
+          closingBrace = text.IndexOf('}', closingBrace + 1, endOfLine - closingBrace - 1);
+          if (closingBrace < 0) {
+            // Also with the "{options}" part omitted, the "{" after the command is neither whitespace
+            // nor a newline, so there is no match at all.
+            return null;
+          }
+          if (IsWhitespaceNewlineOrEnd(text, closingBrace + 1)) {
+            cmdEnd = closingBrace + 1;
+            break;
+          }
+        }
+      }
+
+      if (IsNewlineOrEnd(text, cmdEnd)) {
+        return CommandOnlyGroup(text, prefixPos, cmdEnd, info);
+      }
+      if (!IsSpaceOrTab(text[cmdEnd])) {
+        return null;
+      }
+
+      var fragments = NewFragmentsWithCommand(text, prefixPos, cmdEnd, info);
+
+      int afterWhitespace = SkipSpacesAndTabs(text, cmdEnd);
+
+      // Optional output format ("(html|latex|docbook|rtf|xml)\b").
+      // Note: If the format does not match, the later parameters cannot match either: The greedy "[ \t]+"
+      // consumed all the whitespace already, and since all the parameters are optional in the regex, the
+      // regex engine never backtracks into it.
+      int formatEnd = TryScanImageFormat(text, afterWhitespace);
+      if (formatEnd >= 0) {
+        AddParam(text, fragments, info, 1, afterWhitespace, formatEnd - afterWhitespace);
+        int posAfterFile = MatchOptionalFileParam(text, formatEnd, info, paramSlot: 2, fragments);
+        MatchOptionalCaptionAndSizeParams(text, posAfterFile, info, firstParamSlot: 3, fragments);
+      }
+
+      return new FormattedFragmentGroup(fragments);
+    }
+
+
+    //-----------------------------------------------------------------------------------
+    // Shared pieces of the parameter rules
+
+    // Matches the three optional parameters of cRegex_1OptionalCaption_1OptionalSizeIndication:
+    // a quoted caption, "width=..." and "height=...". Returns the position after the last matched parameter.
+    private int MatchOptionalCaptionAndSizeParams(TextSegment text, int pos, CommandInfo info, int firstParamSlot, List<FormattedFragment> fragments)
+    {
+      // Quoted caption.
+      if (pos < text.Length && IsSpaceOrTab(text[pos])) {
+        int captionStart = SkipSpacesAndTabs(text, pos);
+        int captionEnd = TryScanQuotedInLine(text, captionStart);
+        if (captionEnd >= 0) {
+          AddParam(text, fragments, info, firstParamSlot, captionStart, captionEnd - captionStart);
+          pos = captionEnd;
+        }
+      }
+
+      // "width=..." and "height=...". Note that "[^ \t\r\n]*" in the regex also matches zero characters,
+      // i.e. a lone "width=" is a valid (and highlighted) parameter.
+      pos = TryMatchSizeParam(text, pos, "width=", info, firstParamSlot + 1, fragments);
+      pos = TryMatchSizeParam(text, pos, "height=", info, firstParamSlot + 2, fragments);
+      return pos;
+    }
+
+
+    private int TryMatchSizeParam(TextSegment text, int pos, string sizePrefix, CommandInfo info, int paramSlot, List<FormattedFragment> fragments)
+    {
+      if (pos >= text.Length || !IsSpaceOrTab(text[pos])) {
+        return pos;
+      }
+      int paramStart = SkipSpacesAndTabs(text, pos);
+      if (!text.ContainsAt(sizePrefix, paramStart)) {
+        return pos;
+      }
+      int paramEnd = SkipNonWhitespace(text, paramStart + sizePrefix.Length);
+      AddParam(text, fragments, info, paramSlot, paramStart, paramEnd - paramStart);
+      return paramEnd;
+    }
+
+
+    // Matches cRegexForOptionalFileWithOptionalQuotes, i.e. an optional whitespace-introduced file
+    // parameter. Returns the position after the parameter (or "pos" if the whole part is absent).
+    private int MatchOptionalFileParam(TextSegment text, int pos, CommandInfo info, int paramSlot, List<FormattedFragment> fragments)
+    {
+      if (pos >= text.Length || !IsSpaceOrTab(text[pos])) {
+        return pos;
+      }
+      return MatchFileParamAt(text, SkipSpacesAndTabs(text, pos), info, paramSlot, fragments);
+    }
+
+
+    // The file itself is either quoted (possibly containing spaces) or a run of non-whitespace characters.
+    private int MatchFileParamAt(TextSegment text, int fileStart, CommandInfo info, int paramSlot, List<FormattedFragment> fragments)
+    {
+      int quoteEnd = TryScanQuotedInLine(text, fileStart);
+      int fileEnd = quoteEnd >= 0 ? quoteEnd : SkipNonWhitespace(text, fileStart);
+      AddParam(text, fragments, info, paramSlot, fileStart, fileEnd - fileStart);
+      return fileEnd;
+    }
+
+
+    // Skips the lazy "{.*?}" part used by "\startuml". Returns the position after the
+    // closing brace, or "pos" if there is no (complete) braces part.
+    private static int TrySkipLazyBracesOption(TextSegment text, int pos)
+    {
+      if (pos < text.Length && text[pos] == '{') {
+        int endOfLine = FindEndOfLine(text, pos);
+        int closingBrace = text.IndexOf('}', pos + 1, endOfLine - (pos + 1) < 0 ? 0 : endOfLine - (pos + 1));
+        if (closingBrace >= 0) {
+          return closingBrace + 1;
+        }
+      }
+      return pos;
+    }
+
+
+    // Scans the parameter name of "\ref"-style commands: a sequence of word characters, "::" and "."
+    // (the latter only if not followed by certain characters, so that an ordinary sentence-ending point
+    // after the name is not swallowed). Returns the end of the name (== "pos" if there is none).
+    private static int ScanRefParamName(TextSegment text, int pos)
+    {
+      int idx = pos;
+      while (idx < text.Length) {
+        char c = text[idx];
+        if (IsWordChar(c)) {
+          ++idx;
+        }
+        else if (c == ':' && idx + 1 < text.Length && text[idx + 1] == ':') {
+          idx += 2;
+        }
+        else if (c == '.' && idx + 1 < text.Length && !IsSpaceOrTab(text[idx + 1]) && !IsNewline(text[idx + 1]) && text[idx + 1] != ':') {
+          ++idx;
+        }
+        else {
+          break;
+        }
+      }
+      return idx;
+    }
+
+
+    // Scans the optional output format of the "\image" command. Returns the index after the format,
+    // or -1 if there is none.
+    private static int TryScanImageFormat(TextSegment text, int pos)
+    {
+      foreach (string format in cImageOutputFormats) {
+        if (text.ContainsAt(format, pos)
+            && !(pos + format.Length < text.Length && IsWordChar(text[pos + format.Length]))) { // "\b" after the format
+          return pos + format.Length;
+        }
+      }
+      return -1;
+    }
+
+
+    //-----------------------------------------------------------------------------------
+    // Low level scanning helpers
+
+    private static bool IsSpaceOrTab(char c)
+    {
+      return c == ' ' || c == '\t';
+    }
+
+    private static bool IsNewline(char c)
+    {
+      return c == '\n' || c == '\r';
+    }
+
+    // Mirrors "\w" of the regexes.
+    private static bool IsWordChar(char c)
+    {
+      return char.IsLetterOrDigit(c) || c == '_';
+    }
+
+    // Mirrors cWhitespaceAfterwards, i.e. "(?:$|[ \t\n\r])" at the given position.
+    private static bool IsWhitespaceNewlineOrEnd(TextSegment text, int pos)
+    {
+      return pos >= text.Length || IsSpaceOrTab(text[pos]) || IsNewline(text[pos]);
+    }
+
+    private static bool IsNewlineOrEnd(TextSegment text, int pos)
+    {
+      return pos >= text.Length || IsNewline(text[pos]);
+    }
+
+    // Mirrors "\b" of the regexes at the given position (i.e. between the characters at pos-1 and pos).
+    private static bool IsAtWordBoundary(TextSegment text, int pos)
+    {
+      bool wordCharBefore = pos > 0 && IsWordChar(text[pos - 1]);
+      bool wordCharAfter = pos < text.Length && IsWordChar(text[pos]);
+      return wordCharBefore != wordCharAfter;
+    }
+
+    private static int SkipSpacesAndTabs(TextSegment text, int pos)
+    {
+      while (pos < text.Length && IsSpaceOrTab(text[pos])) {
+        ++pos;
+      }
+      return pos;
+    }
+
+    // Skips over "[^ \t\n\r]*", returning the position after the run.
+    private static int SkipNonWhitespace(TextSegment text, int pos)
+    {
+      while (pos < text.Length && !IsSpaceOrTab(text[pos]) && !IsNewline(text[pos])) {
+        ++pos;
+      }
+      return pos;
+    }
+
+    // Returns the index of the first newline character at or after "pos", or the text length if there is none.
+    private static int FindEndOfLine(TextSegment text, int pos)
+    {
+      while (pos < text.Length && !IsNewline(text[pos])) {
+        ++pos;
+      }
+      return pos;
+    }
+
+    // If a quoted string ("\"[^\r\n]*?\"" in the regexes, i.e. terminated in the same line) starts at "pos",
+    // returns the index after the closing quote. Otherwise, returns -1.
+    private static int TryScanQuotedInLine(TextSegment text, int pos)
+    {
+      if (pos >= text.Length || text[pos] != '"') {
+        return -1;
+      }
+      int idx = pos + 1;
+      while (idx < text.Length && !IsNewline(text[idx])) {
+        if (text[idx] == '"') {
+          return idx + 1;
+        }
+        ++idx;
+      }
+      return -1;
+    }
+
+
+    // Checks whether a command with one of the "AtLineStart" rules may start at "prefixPos".
+    // This mirrors cCommentStart of CommentParser, but checked backwards: Before the command, there may
+    // come whitespace, a run of "*", and more whitespace; before that there must be the start of a line
+    // ("^" in multiline mode) or one of the comment start markers ("///", "//!", "//", "/*", "/*!", "/**").
+    private static bool IsAtCommentLineStart(TextSegment text, int prefixPos)
+    {
+      int idx = prefixPos;
+      while (idx > 0 && IsSpaceOrTab(text[idx - 1])) {
+        --idx;
+      }
+      int numStars = 0;
+      while (idx > 0 && text[idx - 1] == '*') {
+        --idx;
+        ++numStars;
+      }
+      int numWhitespaceBeforeStars = 0;
+      while (idx > 0 && IsSpaceOrTab(text[idx - 1])) {
+        --idx;
+        ++numWhitespaceBeforeStars;
+      }
+
+      if (idx == 0 || text[idx - 1] == '\n') {
+        // Start of the text, or start of a line (note: "^" of a multiline regex matches only after "\n").
+        return true;
+      }
+
+      char prevChar = text[idx - 1];
+      if (prevChar == '/' && idx >= 2 && text[idx - 2] == '/') {
+        return true; // "//" or "///"
+      }
+      else if (prevChar == '*' && idx >= 2 && text[idx - 2] == '/') {
+        return true; // "/*" (further "*", as in "/**", are part of the skipped star run)
+      }
+      else if (prevChar == '!' && idx >= 3 && text[idx - 3] == '/' && (text[idx - 2] == '/' || text[idx - 2] == '*')) {
+        return true; // "//!" or "/*!"
+      }
+      else if (prevChar == '/' && numStars >= 1 && numWhitespaceBeforeStars == 0) {
+        // The skipped star run directly follows a "/". So the first star of the run together with the "/"
+        // forms the "/*" comment start marker (e.g. "/*\brief" or "/**\brief").
+        return true;
+      }
+
+      return false;
+    }
+
+
+    //-----------------------------------------------------------------------------------
+    // Construction of the output fragments
+
+    // Note: The emitted fragments are in snapshot coordinates (TextSegment.OffsetInSnapshot gets added here).
+    private static List<FormattedFragment> NewFragmentsWithCommand(TextSegment text, int prefixPos, int cmdEnd, CommandInfo info)
+    {
+      Debug.Assert(cmdEnd > prefixPos);
+      // Capacity: One entry for the command itself plus at most one per parameter slot.
+      var fragments = new List<FormattedFragment>(info.Classifications.Length);
+      fragments.Add(new FormattedFragment(text.OffsetInSnapshot + prefixPos, cmdEnd - prefixPos, info.Classifications[0]));
+      return fragments;
+    }
+
+    private static FormattedFragmentGroup CommandOnlyGroup(TextSegment text, int prefixPos, int cmdEnd, CommandInfo info)
+    {
+      return new FormattedFragmentGroup(NewFragmentsWithCommand(text, prefixPos, cmdEnd, info));
+    }
+
+    // Adds a parameter fragment in snapshot coordinates. Mirroring the old regex loop, parameters of zero
+    // length are not added (they correspond to unsuccessful or empty capture groups).
+    private static void AddParam(TextSegment text, List<FormattedFragment> fragments, CommandInfo info, int paramSlot, int startIndex, int length)
+    {
+      Debug.Assert(paramSlot < info.Classifications.Length);
+      if (length > 0) {
+        fragments.Add(new FormattedFragment(text.OffsetInSnapshot + startIndex, length, info.Classifications[paramSlot]));
+      }
+    }
+
+
+    //-----------------------------------------------------------------------------------
+    // Parameter parsing rules
+
+    /// <summary>
+    /// One value for every BuildRegex_* creator of CommentParser that the lexer understands.
+    /// "AtLineStart" rules additionally require that the command appears at the start of a comment line
+    /// (cCommentStart in the regexes), "InLine" rules that no word character comes directly before the
+    /// command prefix ("\B" in the regexes).
+    /// </summary>
+    private enum ParamRule
+    {
+      AtLineStart_NoParam,
+      CodeCommand,
+      Anywhere_NoParam_WhitespaceAfterwards,
+      Anywhere_NoParam,
+      FormulaEnvironmentStart,
+      Language,
+      AtLineStart_1ParamAsWord,
+      AtLineStart_1ParamTillEnd,
+      AtLineStart_1OptionalParamTillEnd,
+      AtLineStart_1ParamAsWord_1OptionalParamTillEnd,
+      AtLineStart_1QuotedParam_1OptionalParamTillEnd,
+      AtLineStart_1ParamAsWord_1OptionalParamAsWord_1OptionalParamTillEnd,
+      InLine_1ParamAsWord,
+      InLine_1ParamAsWordOrQuoted,
+      InLine_1ParamAsWord_1OptionalQuotedParam,
+      OptionalCaptionAndSize,
+      StartUmlCommand,
+      File_OptionalCaptionAndSize,
+      ImageCommand,
+    }
+
+
+    private static bool RequiresCommentLineStart(ParamRule rule)
+    {
+      switch (rule) {
+        case ParamRule.AtLineStart_NoParam:
+        case ParamRule.AtLineStart_1ParamAsWord:
+        case ParamRule.AtLineStart_1ParamTillEnd:
+        case ParamRule.AtLineStart_1OptionalParamTillEnd:
+        case ParamRule.AtLineStart_1ParamAsWord_1OptionalParamTillEnd:
+        case ParamRule.AtLineStart_1QuotedParam_1OptionalParamTillEnd:
+        case ParamRule.AtLineStart_1ParamAsWord_1OptionalParamAsWord_1OptionalParamTillEnd:
+          return true;
+        default:
+          return false;
+      }
+    }
+
+    private static bool ForbidsWordCharBeforePrefix(ParamRule rule)
+    {
+      switch (rule) {
+        case ParamRule.InLine_1ParamAsWord:
+        case ParamRule.InLine_1ParamAsWord_1OptionalQuotedParam:
+          return true;
+        default:
+          return false;
+      }
+    }
+
+    // Number of capture groups (including the one for the command itself) of the regex that corresponds
+    // to the given rule. Used to check that enough classifications are configured.
+    private static int GetNumCaptureGroups(ParamRule rule)
+    {
+      switch (rule) {
+        case ParamRule.AtLineStart_NoParam:
+        case ParamRule.CodeCommand:
+        case ParamRule.Anywhere_NoParam_WhitespaceAfterwards:
+        case ParamRule.Anywhere_NoParam:
+        case ParamRule.FormulaEnvironmentStart:
+        case ParamRule.Language:
+          return 1;
+        case ParamRule.AtLineStart_1ParamAsWord:
+        case ParamRule.AtLineStart_1ParamTillEnd:
+        case ParamRule.AtLineStart_1OptionalParamTillEnd:
+        case ParamRule.InLine_1ParamAsWord:
+        case ParamRule.InLine_1ParamAsWordOrQuoted:
+          return 2;
+        case ParamRule.AtLineStart_1ParamAsWord_1OptionalParamTillEnd:
+        case ParamRule.AtLineStart_1QuotedParam_1OptionalParamTillEnd:
+        case ParamRule.InLine_1ParamAsWord_1OptionalQuotedParam:
+          return 3;
+        case ParamRule.AtLineStart_1ParamAsWord_1OptionalParamAsWord_1OptionalParamTillEnd:
+        case ParamRule.OptionalCaptionAndSize:
+        case ParamRule.StartUmlCommand:
+          return 4;
+        case ParamRule.File_OptionalCaptionAndSize:
+          return 5;
+        case ParamRule.ImageCommand:
+          return 6;
+        default:
+          Debug.Assert(false); // Missing case?
+          return int.MaxValue;
+      }
+    }
+
+
+    private static readonly Dictionary<RegexCreatorDelegate, ParamRule> cRegexCreatorToParamRule
+      = new Dictionary<RegexCreatorDelegate, ParamRule> {
+        { CommentParser.BuildRegex_KeywordAtLineStart_NoParam, ParamRule.AtLineStart_NoParam },
+        { CommentParser.BuildRegex_CodeCommand, ParamRule.CodeCommand },
+        { CommentParser.BuildRegex_KeywordAnywhere_WhitespaceAfterwardsRequiredButNoParam, ParamRule.Anywhere_NoParam_WhitespaceAfterwards },
+        { CommentParser.BuildRegex_KeywordAnywhere_NoWhitespaceAfterwardsRequired_NoParam, ParamRule.Anywhere_NoParam },
+        { CommentParser.BuildRegex_FormulaEnvironmentStart, ParamRule.FormulaEnvironmentStart },
+        { CommentParser.BuildRegex_Language, ParamRule.Language },
+        { CommentParser.BuildRegex_KeywordAtLineStart_1RequiredParamAsWord, ParamRule.AtLineStart_1ParamAsWord },
+        { CommentParser.BuildRegex_KeywordAtLineStart_1RequiredParamTillEnd, ParamRule.AtLineStart_1ParamTillEnd },
+        { CommentParser.BuildRegex_KeywordAtLineStart_1OptionalParamTillEnd, ParamRule.AtLineStart_1OptionalParamTillEnd },
+        { CommentParser.BuildRegex_KeywordAtLineStart_1RequiredParamAsWord_1OptionalParamTillEnd, ParamRule.AtLineStart_1ParamAsWord_1OptionalParamTillEnd },
+        { CommentParser.BuildRegex_KeywordAtLineStart_1RequiredQuotedParam_1OptionalParamTillEnd, ParamRule.AtLineStart_1QuotedParam_1OptionalParamTillEnd },
+        { CommentParser.BuildRegex_KeywordAtLineStart_1RequiredParamAsWord_1OptionalParamAsWord_1OptionalParamTillEnd, ParamRule.AtLineStart_1ParamAsWord_1OptionalParamAsWord_1OptionalParamTillEnd },
+        { CommentParser.BuildRegex_KeywordSomewhereInLine_1RequiredParamAsWord, ParamRule.InLine_1ParamAsWord },
+        { CommentParser.BuildRegex_KeywordSomewhereInLine_1RequiredParamAsWordOrQuoted, ParamRule.InLine_1ParamAsWordOrQuoted },
+        { CommentParser.BuildRegex_KeywordSomewhereInLine_1RequiredParamAsWord_1OptionalQuotedParam, ParamRule.InLine_1ParamAsWord_1OptionalQuotedParam },
+        { CommentParser.BuildRegex_1OptionalCaption_1OptionalSizeIndication, ParamRule.OptionalCaptionAndSize },
+        { CommentParser.BuildRegex_StartUmlCommandWithBracesOptions, ParamRule.StartUmlCommand },
+        { CommentParser.BuildRegex_1File_1OptionalCaption_1OptionalSizeIndication, ParamRule.File_OptionalCaptionAndSize },
+        { CommentParser.BuildRegex_ImageCommand, ParamRule.ImageCommand },
+      };
+
+
+    /// <summary>
+    /// All information required to match one specific Doxygen command and its parameters.
+    /// </summary>
+    private class CommandInfo
+    {
+      public string Command { get; private set; } // Without the "\" or "@"
+      public ParamRule Rule { get; private set; }
+      public ClassificationEnum[] Classifications { get; private set; } // Same meaning as in DoxygenCommandGroup
+
+      public CommandInfo(string command, ParamRule rule, ClassificationEnum[] classifications)
+      {
+        Command = command;
+        Rule = rule;
+        Classifications = classifications;
+      }
+    }
+
+
+    /// <summary>
+    /// One node of the prefix trie of all known commands. A node with a non-null Command terminates
+    /// that command; it can nevertheless have children (e.g. "param" and "param[in]").
+    /// </summary>
+    private class CommandTrieNode
+    {
+      public Dictionary<char, CommandTrieNode> Children { get; } = new Dictionary<char, CommandTrieNode>();
+      public CommandInfo Command { get; set; }
+    }
+
+
+    private CommentLexer(CommandTrieNode commandTrieRoot)
+    {
+      mCommandTrieRoot = commandTrieRoot;
+    }
+
+
+    // Root of the prefix trie of all known commands (without the "\" or "@" prefix).
+    private readonly CommandTrieNode mCommandTrieRoot;
+
+    private static readonly HashSet<string> cCodeFileExtensions = new HashSet<string>(CommentParser.cCodeFileExtensions);
+
+    // The output formats supported by the "\image" command.
+    private static readonly string[] cImageOutputFormats = { "html", "latex", "docbook", "rtf", "xml" };
+  }
+}
@@ -1,9 +1,11 @@
-﻿using Microsoft.VisualStudio.Text;
+﻿using Microsoft.VisualStudio.Shell;
+using Microsoft.VisualStudio.Text;
 using System;
 using System.Collections.Generic;
 using System.Diagnostics;
 using System.Linq;
 using System.Text.RegularExpressions;
+using System.Threading.Tasks;
 
 
 namespace VSDoxyHighlighter
@@ -22,11 +24,21 @@ namespace VSDoxyHighlighter
     public int EndIndex => Fragments[Fragments.Count - 1].EndIndex;
     public int Length => EndIndex - StartIndex + 1;
 
-    public FormattedFragmentGroup(IList<FormattedFragment> fragments) 
+    public FormattedFragmentGroup(IList<FormattedFragment> fragments)
     {
       Debug.Assert(fragments != null && fragments.Count() > 0);
       Fragments = fragments;
     }
+
+    /// <summary>
+    /// Creates a group consisting of a single fragment. Allocates only an exactly sized array instead of a
+    /// whole List; relevant because e.g. every markdown fragment gets its own group, i.e. this runs for
+    /// every line of every visible file.
+    /// </summary>
+    public FormattedFragmentGroup(FormattedFragment singleFragment)
+    {
+      Fragments = new FormattedFragment[] { singleFragment };
+    }
   }
 
 
@@ -92,6 +104,84 @@ namespace VSDoxyHighlighter
   }
 
 
+  /// <summary>
+  /// A read-only view of the leading part of a string, together with the absolute position of that string
+  /// in the text buffer snapshot. Used by the parsing code so that trailing characters can be cut off
+  /// without creating a copy via Substring(), and so that the found fragments can be emitted directly in
+  /// snapshot coordinates. All indices are relative to the start of the underlying string; characters at
+  /// or behind "Length" do not exist as far as users of the view are concerned.
+  /// </summary>
+  public struct TextSegment
+  {
+    /// <summary>
+    /// Number of characters of the view. Can be smaller than the length of the underlying string
+    /// (namely when trailing characters were cut off).
+    /// </summary>
+    public int Length { get; private set; }
+
+    /// <summary>
+    /// Absolute index of the first character of the view in the text buffer snapshot. Gets added to all
+    /// fragment indices that the parsing code produces. 0 outside of Visual Studio (e.g. in the tests).
+    /// </summary>
+    public int OffsetInSnapshot { get; private set; }
+
+    public TextSegment(string text, int length, int offsetInSnapshot)
+    {
+      Debug.Assert(text != null);
+      Debug.Assert(0 <= length && length <= text.Length);
+      Debug.Assert(offsetInSnapshot >= 0);
+
+      mText = text;
+      Length = length;
+      OffsetInSnapshot = offsetInSnapshot;
+    }
+
+    public char this[int idx] {
+      get {
+        Debug.Assert(idx < Length);
+        return mText[idx];
+      }
+    }
+
+    /// <summary>
+    /// Same as string.IndexOf(), but never finds characters at or behind "Length".
+    /// </summary>
+    public int IndexOf(char value, int startIndex)
+    {
+      return mText.IndexOf(value, startIndex, Length - startIndex);
+    }
+
+    public int IndexOf(char value, int startIndex, int count)
+    {
+      Debug.Assert(startIndex + count <= Length);
+      return mText.IndexOf(value, startIndex, count);
+    }
+
+    public int LastIndexOf(char value, int startIndex, int count)
+    {
+      Debug.Assert(startIndex < Length);
+      return mText.LastIndexOf(value, startIndex, count);
+    }
+
+    /// <summary>
+    /// Returns true if "value" appears at the position "startIndex" (ordinal comparison).
+    /// </summary>
+    public bool ContainsAt(string value, int startIndex)
+    {
+      return startIndex + value.Length <= Length
+        && string.CompareOrdinal(mText, startIndex, value, 0, value.Length) == 0;
+    }
+
+    public string Substring(int startIndex, int length)
+    {
+      Debug.Assert(startIndex + length <= Length);
+      return mText.Substring(startIndex, length);
+    }
+
+    private readonly string mText;
+  }
+
+
   /// <summary>
   /// Provides facilities to parse some piece of comment text for doxygen commands, markdown, etc.
   /// This implements the main logic to find the fragments that should be formatted. It
@@ -134,36 +224,135 @@ namespace VSDoxyHighlighter
     /// FormattedFragment.startIndex==0 means the first character in the input "text".</returns>
     public IEnumerable<FormattedFragmentGroup> Parse(string text)
     {
-      text = text.TrimEnd();
-      if (text.EndsWith("*/")) {
-        // Strip terminating "*/" so that it is not highlighted in commands such as
-        //     /** @ingroup foo */
-        // I.e. in commands whose parameter stretches till the end of the line.
-        // Removing it beforehand is easier than adapting the regex.
-        text = text.Substring(0, text.Length - 2);
+      return Parse(text, offsetInSnapshot: 0);
+    }
+
+
+    /// <summary>
+    /// Same as <see cref="Parse(string)"/>, except that <paramref name="offsetInSnapshot"/> gets added to
+    /// the indices of all returned fragments. By passing the absolute position of "text" in the text buffer,
+    /// the fragments are emitted directly in snapshot coordinates, without a separate translation pass over
+    /// all fragments afterwards.
+    /// </summary>
+    public IEnumerable<FormattedFragmentGroup> Parse(string text, int offsetInSnapshot)
+    {
+      long startTimestamp = PerformanceMetrics.StartTiming();
+      try {
+        return ParseWithInterning(text, offsetInSnapshot);
+      }
+      finally {
+        PerformanceMetrics.RecordParse(startTimestamp, text.Length);
       }
+    }
 
-      var allFragmentGroups = new List<FormattedFragmentGroup>();
-      foreach (FragmentMatcher matcher in mMatchers) {
-        var foundMatches = matcher.re.Matches(text);
-        foreach (Match m in foundMatches) {
-          if (1 < m.Groups.Count && m.Groups.Count <= matcher.classifications.Length + 1) {
-            var fragments = new List<FormattedFragment>();
-            for (int idx = 0; idx < m.Groups.Count - 1; ++idx) {
-              Group group = m.Groups[idx + 1];
-              if (group.Success && group.Captures.Count == 1 && group.Length > 0) {
-                ClassificationEnum classificationsOfGroups = matcher.classifications[idx];
-                fragments.Add(new FormattedFragment(group.Index, group.Length, classificationsOfGroups));
-              }
-            }
 
-            if (fragments.Count > 0) {
-              allFragmentGroups.Add(new FormattedFragmentGroup(fragments));
-            }
+    private IEnumerable<FormattedFragmentGroup> ParseWithInterning(string text, int offsetInSnapshot)
+    {
+      // Fast pre-scan: Every single thing we can possibly highlight requires one of these characters.
+      // Doxygen commands (including customized ones; compare cCmdPrefix) start with "\" or "@", inline code
+      // needs a backtick, and the markdown emphasis styles need "*", "_" or "~". The overwhelming majority
+      // of comment text is plain prose without any of them, so this single vectorizable scan skips the
+      // whole matching pipeline (and even the interning lookup, which would hash the text) most of the time.
+      if (text.IndexOfAny(cPotentialMatchTriggerChars) < 0) {
+        return Array.Empty<FormattedFragmentGroup>();
+      }
+
+      // Many comment lines appear verbatim in a multitude of files: Think of the copyright banner at the top
+      // of every file, or of doc comments generated by macros. Each CommentClassifier maintains its own cache
+      // (keyed by the span in its buffer), so with many open documents the identical text got parsed over and
+      // over. Hence, intern the parse results process-wide, keyed by the comment text itself: On a hit, the
+      // matchers do not need to run at all; only the fragment positions need to be adapted to where the text
+      // happens to be located in the requesting buffer (and not even that if the location is the same, which
+      // happens e.g. when a line is re-parsed after the VS cpp colorer invalidated the classifier's cache).
+      int internGeneration;
+      InternedParseResult interned;
+      bool found;
+      lock (mInternedParseResults) {
+        internGeneration = mInternGeneration;
+        found = mInternedParseResults.TryGetValue(text, out interned);
+        if (found) {
+          ++NumParseResultInternHits;
+        }
+      }
+      if (found) {
+        if (interned.BaseOffset == offsetInSnapshot || interned.Groups.Count == 0) {
+          return interned.Groups;
+        }
+        return ShiftFragmentGroups(interned.Groups, offsetInSnapshot - interned.BaseOffset);
+      }
+
+      IList<FormattedFragmentGroup> result = ParseUncached(text, offsetInSnapshot);
+
+      lock (mInternedParseResults) {
+        // Do not intern the result if the matcher configuration changed while we were parsing: The result
+        // might have been produced by a mixture of old and new matchers (compare OnDoxygenCommandsGotUpdated)
+        // and must not outlive the invalidation of the classifier caches.
+        if (internGeneration == mInternGeneration && !mInternedParseResults.ContainsKey(text)) {
+          int approximateBytes = ApproximateInternedBytes(text, result);
+          if (mInternedBytes + approximateBytes > cMaxInternedBytes) {
+            // Crude but simple eviction: Throw everything away and let the store refill with whatever is
+            // parsed from now on, i.e. with the currently hot texts. (A fancier LRU policy is not worth the
+            // bookkeeping here; the store refills within a few seconds of scrolling.)
+            mInternedParseResults.Clear();
+            mInternedBytes = 0;
+            ++NumParseResultInternStoreResets;
+          }
+          if (approximateBytes <= cMaxInternedBytes) {
+            mInternedParseResults[text] = new InternedParseResult { Groups = result, BaseOffset = offsetInSnapshot };
+            mInternedBytes += approximateBytes;
           }
         }
       }
 
+      return result;
+    }
+
+
+    // Number of times a call to Parse() could be served from the interned results of a previous call with
+    // the same text, and number of times the interning store overflowed its memory budget. Inspect in the
+    // debugger, or compare the instrumentation output.
+    public static long NumParseResultInternHits { get; private set; } = 0;
+    public static long NumParseResultInternStoreResets { get; private set; } = 0;
+
+
+    private IList<FormattedFragmentGroup> ParseUncached(string text, int offsetInSnapshot)
+    {
+      // Ignore trailing whitespace, and strip a terminating "*/" so that it is not highlighted in commands
+      // such as
+      //     /** @ingroup foo */
+      // I.e. in commands whose parameter stretches till the end of the line. Removing it beforehand is
+      // easier than adapting the regex. Note that we only shrink the considered length instead of calling
+      // TrimEnd() and Substring(), since these create a copy of the whole (potentially large) text.
+      int parseLength = text.Length;
+      while (parseLength > 0 && char.IsWhiteSpace(text[parseLength - 1])) {
+        --parseLength;
+      }
+      if (parseLength >= 2 && text[parseLength - 2] == '*' && text[parseLength - 1] == '/') {
+        parseLength -= 2;
+      }
+
+      // Scratch buffer for the groups found by the individual matching steps; reused between calls to not
+      // allocate a new list for every single line. Thread-static rather than an ordinary member, because
+      // Parse() runs concurrently on the UI thread and on thread pool threads (background parsing).
+      // Note that only the buffer itself is reused; the groups stored in it are created fresh for every
+      // call and escape into the result (and from there into the caches of the callers).
+      List<FormattedFragmentGroup> allFragmentGroups = tScratchFragmentGroups;
+      if (allFragmentGroups == null) {
+        allFragmentGroups = tScratchFragmentGroups = new List<FormattedFragmentGroup>();
+      }
+      allFragmentGroups.Clear();
+
+      if (parseLength >= cMinCharsForParallelParse) {
+        // Giant comment blocks (e.g. license or architecture banners with thousands of lines) are handed to
+        // Parse() as one single string. All matching steps are essentially linear in the text length, but a
+        // few ten thousand characters still take a noticeable amount of time, especially on the UI thread.
+        // Hence, split such blocks into partitions of whole lines and parse the partitions on multiple cores.
+        ParseLargeTextInParallel(text, parseLength, offsetInSnapshot, allFragmentGroups);
+      }
+      else {
+        MatchAllFragments(text, parseLength, offsetInSnapshot, allFragmentGroups);
+      }
+
       // In case of overlapping fragment groups, let the group win which starts first. This seems like a sensible thing to do.
       // Especially consider markdown nested in e.g. titles. For example, consider the comment:
       //    @par Some @b text and `backtics`
@@ -174,22 +363,294 @@ namespace VSDoxyHighlighter
       // for example, applying backtics in page titles causes the html tag "<tt>" to actually appear in the list of pages rather than
       // the formatted text.
       //
-      // Using OrderBy() rather than Sort() to get a stable sort: Of two groups that start at the same position, let that one win
-      // which was matched by the earlier regex. At the time of writing this, it should not actually be possible that two regex
-      // return matches that start at the same position, but who knows what the future holds.
+      // This used to be implemented via LINQ OrderBy() plus a SortedSet with a comparer that treats
+      // overlapping groups as equal. That allocated an iterator, the set, its tree nodes and the comparer on
+      // every call, for every line of every visible file. Instead, we now sort a reusable scratch array
+      // in-place and remove the overlapping groups with a single sweep: Since the groups are processed in
+      // ascending start order and the retained groups do not overlap each other, a group can only ever
+      // overlap the most recently retained one.
       //
-      // Also, NOT passing "sorted" directly into the constructed of SortedSet because apparently the constructor does not iterate
-      // over the input IEnumerable in the correct order.
-      var sorted = allFragmentGroups.OrderBy(fragment => fragment.StartIndex);
-      var filtered = new SortedSet<FormattedFragmentGroup>(new NonOverlappingCommandGroupsComparer());
-      foreach (var fragmentGroup in sorted) { // Add the fragments in the correct order, to let the first one win in case of overlaps
-        filtered.Add(fragmentGroup);
+      // The sort must be stable: Of two groups that start at the same position, let that one win which was
+      // found by the earlier matching step. At the time of writing this, it should not actually be possible
+      // that two matchers return matches that start at the same position, but who knows what the future
+      // holds. List.Sort() is unstable, hence each group is tagged with its position in the original order
+      // which serves as tie-breaker.
+      if (allFragmentGroups.Count == 0) {
+        return Array.Empty<FormattedFragmentGroup>();
+      }
+
+      List<GroupWithOrder> sortScratch = tScratchGroupsWithOrder;
+      if (sortScratch == null) {
+        sortScratch = tScratchGroupsWithOrder = new List<GroupWithOrder>();
+      }
+      sortScratch.Clear();
+      for (int idx = 0; idx < allFragmentGroups.Count; ++idx) {
+        sortScratch.Add(new GroupWithOrder { group = allFragmentGroups[idx], orderOfDetection = idx });
+      }
+      sortScratch.Sort(cGroupComparer);
+
+      var filtered = new List<FormattedFragmentGroup>(sortScratch.Count);
+      int endIndexOfLastRetainedGroup = -1;
+      foreach (GroupWithOrder entry in sortScratch) {
+        if (entry.group.StartIndex > endIndexOfLastRetainedGroup) {
+          filtered.Add(entry.group);
+          endIndexOfLastRetainedGroup = entry.group.EndIndex;
+        }
       }
 
+      // Do not keep references to the found groups alive longer than necessary (the scratch buffers live as
+      // long as the thread).
+      allFragmentGroups.Clear();
+      sortScratch.Clear();
+
       return filtered;
     }
 
 
+    /// <summary>
+    /// Runs all matching steps (lexer, remaining regexes, markdown scanner) over the first
+    /// <paramref name="parseLength"/> characters of <paramref name="text"/> and appends the found groups
+    /// to <paramref name="outGroups"/>. The groups are neither sorted nor filtered for overlaps; that
+    /// happens afterwards in Parse(). Must be callable concurrently from multiple threads for the same
+    /// CommentParser instance (it is, since the matchers are only read and the regexes are thread-safe).
+    /// </summary>
+    private void MatchAllFragments(string text, int parseLength, int offsetInSnapshot, List<FormattedFragmentGroup> outGroups)
+    {
+      var textSegment = new TextSegment(text, parseLength, offsetInSnapshot);
+
+      // Find all Doxygen commands with a single pass over the text. This is much faster than running
+      // the regex of every single command group over the whole text.
+      mCommandLexer.FindAllCommandGroups(textSegment, outGroups);
+
+      // Run the remaining regex based matchers: Inline code, and all command groups that the
+      // lexer does not understand. Note that the Match() overload with an explicit length behaves as if
+      // matching on the corresponding substring (also regarding anchors and lookbehinds), except that the
+      // text is not copied and the match indices refer to the original string. NextMatch() keeps the
+      // bounds of the original Match() call.
+      foreach (FragmentMatcher matcher in mMatchers) {
+        try {
+          Match m = matcher.re.Match(text, 0, parseLength);
+          while (m.Success) {
+            if (1 < m.Groups.Count && m.Groups.Count <= matcher.classifications.Length + 1) {
+              var fragments = new List<FormattedFragment>(m.Groups.Count - 1);
+              for (int idx = 0; idx < m.Groups.Count - 1; ++idx) {
+                Group group = m.Groups[idx + 1];
+                if (group.Success && group.Captures.Count == 1 && group.Length > 0) {
+                  ClassificationEnum classificationsOfGroups = matcher.classifications[idx];
+                  fragments.Add(new FormattedFragment(offsetInSnapshot + group.Index, group.Length, classificationsOfGroups));
+                }
+              }
+
+              if (fragments.Count > 0) {
+                outGroups.Add(new FormattedFragmentGroup(fragments));
+              }
+            }
+            m = m.NextMatch();
+          }
+        }
+        catch (RegexMatchTimeoutException) {
+          // The regex ran into cRegexTimeout on a pathological input. Degrade gracefully: The matches of
+          // this one matcher are missing from the result, everything else still gets highlighted. The
+          // counter makes such incidents visible in the performance summary and via ETW.
+          PerformanceMetrics.RecordRegexTimeout();
+        }
+      }
+
+      // Find the markdown emphasis fragments ("*italic*", "**bold**", etc.) with the hand-rolled linear-time
+      // scanner rather than with regexes. The previously used regexes were subject to catastrophic backtracking:
+      // The lazy "any character" loop in the middle of the pattern, combined with the lookaheads, caused the
+      // .NET backtracking engine to take quadratic (or worse) time on pathological inputs. Such inputs do occur
+      // in practice, e.g. a base64 blob or a long table row in a comment contains many "*" or "_" characters
+      // without ever forming a valid emphasis. With enough of them on a single line, the regexes ran into
+      // cRegexTimeout and the whole comment lost its highlighting. The scanner matches exactly the same strings
+      // as the regexes did (verified by differential fuzzing), but runs in O(n) and thus needs no timeout.
+      // (mMarkdownKinds is empty if the user disabled the markdown highlighting in the options.)
+      foreach (MarkdownEmphasisKind emphasisKind in mMarkdownKinds) {
+        MarkdownScanner.FindAllFragments(
+          text, parseLength, offsetInSnapshot, emphasisKind.delimiter, emphasisKind.classification, outGroups);
+      }
+    }
+
+
+    /// <summary>
+    /// Splits the given (large) text into partitions of whole lines, runs MatchAllFragments() over the
+    /// partitions on multiple cores and appends the results, in the order of the partitions, to
+    /// <paramref name="outGroups"/>. The result is exactly the same as a single MatchAllFragments() call
+    /// over the whole text, for the following reasons:
+    /// - All matching steps treat "\n" as a hard barrier, with one exception discussed below. Since every
+    ///   partition except the last ends directly after a "\n" (and the last one at parseLength), no match
+    ///   can cross a partition boundary, and no matching step can "see" a difference between the whole text
+    ///   and a partition: "^" matches at the start of a partition exactly because there is a "\n" before it,
+    ///   the markdown prefix and suffix character classes never need to look across a "\n", and "$" resp.
+    ///   the end of the text coincide with a "\n" resp. with parseLength in both cases.
+    /// - The exception is the lexer rule for commands taking a quoted parameter ("\qualifier"): The closing
+    ///   quote of the parameter may be on a later line. SelectSeamSafePartitionBoundaries() therefore never
+    ///   places a boundary where it could cut such a parameter in two (see there).
+    /// - The overlap filtering in Parse() breaks ties between groups with the same start index by the order
+    ///   of detection. Two groups from different partitions cannot start at the same index, and within one
+    ///   partition the detection order is the same as in a serial parse. So appending the partition results
+    ///   in order preserves the serial tie-break behavior.
+    /// (Additionally verified by differential fuzzing against a serial parse on large random inputs.)
+    /// </summary>
+    private void ParseLargeTextInParallel(string text, int parseLength, int offsetInSnapshot, List<FormattedFragmentGroup> outGroups)
+    {
+      List<int> boundaries = SelectSeamSafePartitionBoundaries(text, parseLength);
+      if (boundaries.Count == 0) {
+        // No suitable seam found (e.g. one gigantic line). Fall back to the ordinary serial parse.
+        MatchAllFragments(text, parseLength, offsetInSnapshot, outGroups);
+        return;
+      }
+
+      int numPartitions = boundaries.Count + 1;
+      var groupsPerPartition = new List<FormattedFragmentGroup>[numPartitions];
+
+      Parallel.For(0, numPartitions, partitionIdx => {
+        int partitionStart = (partitionIdx == 0) ? 0 : boundaries[partitionIdx - 1];
+        int partitionEnd = (partitionIdx == numPartitions - 1) ? parseLength : boundaries[partitionIdx];
+
+        // Copying the partition into its own string is necessary because Match() with an explicit start
+        // index unfortunately does not behave as if matching on the corresponding substring ("^" would
+        // not match at the start index). The copy is cheap compared to the matching work saved.
+        string partitionText = text.Substring(partitionStart, partitionEnd - partitionStart);
+
+        // Deliberately not using the thread-static scratch buffer here: The worker threads come from the
+        // thread pool and might themselves be in the middle of a (background) Parse() call that already
+        // uses the scratch buffer of their thread.
+        var partitionGroups = new List<FormattedFragmentGroup>();
+        MatchAllFragments(partitionText, partitionText.Length, offsetInSnapshot + partitionStart, partitionGroups);
+        groupsPerPartition[partitionIdx] = partitionGroups;
+      });
+
+      foreach (List<FormattedFragmentGroup> partitionGroups in groupsPerPartition) {
+        outGroups.AddRange(partitionGroups);
+      }
+    }
+
+
+    /// <summary>
+    /// Returns the indices at which a large text of length <paramref name="parseLength"/> gets split into
+    /// partitions for the parallel parse. Every returned index is the start of a line (i.e. comes directly
+    /// after a "\n") and is "seam safe": The only construct that can span multiple lines is the quoted
+    /// parameter of commands like "\qualifier" (the lexer searches for the closing quote without a line
+    /// limit). A partition boundary must not be placed inside such a parameter, since the first partition
+    /// would then miss the closing quote and not match the command, while the serial parse would. We use a
+    /// conservative criterion: A boundary is risky if the last quote before it sits on a line that contains
+    /// a "\" or "@" somewhere before the quote, i.e. that might contain a command to which the quote
+    /// belongs. Risky boundaries are moved to subsequent line starts; if none is safe, the seam is skipped,
+    /// merging the two partitions. Returns an empty list if no boundary could be placed at all.
+    /// </summary>
+    private static List<int> SelectSeamSafePartitionBoundaries(string text, int parseLength)
+    {
+      // Positions of all quotes, for the binary search of "last quote before the boundary" below.
+      var quotePositions = new List<int>();
+      for (int idx = 0; idx < parseLength; ++idx) {
+        if (text[idx] == '"') {
+          quotePositions.Add(idx);
+        }
+      }
+
+      int numDesiredPartitions = Math.Min(Environment.ProcessorCount, parseLength / cMinPartitionSizeInChars);
+      var boundaries = new List<int>();
+      if (numDesiredPartitions < 2) {
+        return boundaries;
+      }
+
+      int targetPartitionSize = parseLength / numDesiredPartitions;
+      for (int partitionIdx = 1; partitionIdx < numDesiredPartitions; ++partitionIdx) {
+        int desiredBoundary = partitionIdx * targetPartitionSize;
+        int minBoundary = (boundaries.Count > 0) ? boundaries[boundaries.Count - 1] + 1 : 1;
+        if (desiredBoundary < minBoundary) {
+          continue;
+        }
+
+        // Move the boundary forward to the next line start, and from there over further line starts until
+        // it is seam safe. The number of attempts is bounded so that a pathological text (e.g. a "\" and a
+        // quote on every line) cannot degrade this loop to a quadratic scan over the whole text.
+        int boundary = text.IndexOf('\n', desiredBoundary - 1);
+        int numAttempts = 0;
+        while (boundary >= 0 && boundary + 1 < parseLength && numAttempts < cMaxSeamShiftAttempts) {
+          if (IsSeamSafeBoundary(text, boundary + 1, quotePositions)) {
+            break;
+          }
+          boundary = text.IndexOf('\n', boundary + 1);
+          ++numAttempts;
+        }
+
+        if (boundary >= 0 && boundary + 1 < parseLength && numAttempts < cMaxSeamShiftAttempts) {
+          boundaries.Add(boundary + 1);
+        }
+      }
+
+      return boundaries;
+    }
+
+
+    /// <summary>
+    /// Returns a copy of the given fragment groups with all fragment positions shifted by
+    /// <paramref name="delta"/>. Used to adapt an interned parse result to the position of the same text in
+    /// a different place (typically: the same comment line in a different buffer).
+    /// </summary>
+    private static IList<FormattedFragmentGroup> ShiftFragmentGroups(IList<FormattedFragmentGroup> groups, int delta)
+    {
+      var shifted = new List<FormattedFragmentGroup>(groups.Count);
+      foreach (FormattedFragmentGroup group in groups) {
+        if (group.Fragments.Count == 1) {
+          FormattedFragment f = group.Fragments[0];
+          shifted.Add(new FormattedFragmentGroup(new FormattedFragment(f.StartIndex + delta, f.Length, f.Classification)));
+        }
+        else {
+          var fragments = new List<FormattedFragment>(group.Fragments.Count);
+          foreach (FormattedFragment f in group.Fragments) {
+            fragments.Add(new FormattedFragment(f.StartIndex + delta, f.Length, f.Classification));
+          }
+          shifted.Add(new FormattedFragmentGroup(fragments));
+        }
+      }
+      return shifted;
+    }
+
+
+    // Rough estimate of the memory consumption of one interned parse result: The text serving as key, the
+    // dictionary slot, and the fragment lists. In the same spirit as the estimate for the cache entries in
+    // CommentClassifier; exact numbers do not matter, the estimate only keeps the store bounded.
+    private static int ApproximateInternedBytes(string text, IList<FormattedFragmentGroup> groups)
+    {
+      int bytes = 64 + text.Length * sizeof(char);
+      foreach (FormattedFragmentGroup group in groups) {
+        bytes += 48 + group.Fragments.Count * 24;
+      }
+      return bytes;
+    }
+
+
+    /// <summary>
+    /// Checks whether the line start at index <paramref name="lineStart"/> can safely serve as a partition
+    /// boundary for the parallel parse. See SelectSeamSafePartitionBoundaries() for the criterion.
+    /// </summary>
+    private static bool IsSeamSafeBoundary(string text, int lineStart, List<int> quotePositions)
+    {
+      Debug.Assert(lineStart > 0 && text[lineStart - 1] == '\n');
+
+      // Binary search for the last quote strictly before the boundary. (A quote directly at the boundary
+      // belongs entirely to the second partition and is irrelevant here.)
+      int searchResult = quotePositions.BinarySearch(lineStart);
+      int idxOfLastQuoteBefore = (searchResult >= 0) ? searchResult - 1 : ~searchResult - 1;
+      if (idxOfLastQuoteBefore < 0) {
+        return true;
+      }
+
+      // If the line containing that quote contains a "\" or "@" before the quote, the quote might be the
+      // opening quote of a still unterminated command parameter stretching across the boundary.
+      int quotePos = quotePositions[idxOfLastQuoteBefore];
+      for (int idx = quotePos - 1; idx >= 0 && text[idx] != '\n'; --idx) {
+        if (text[idx] == '\\' || text[idx] == '@') {
+          return false;
+        }
+      }
+      return true;
+    }
+
+
     /// <summary>
     /// Assuming that <paramref name="cmdWithSlashOrAt"/> contains a Doxygen command (including the "/" or "@"),
     /// returns the corresponding classification.
@@ -200,12 +661,12 @@ namespace VSDoxyHighlighter
     {
       Debug.Assert(cmdWithSlashOrAt.StartsWith("\\") || cmdWithSlashOrAt.StartsWith("@"));
 
-      var parsed = Parse(cmdWithSlashOrAt);
-      if (parsed.Count() == 1) {
-        FormattedFragmentGroup group = parsed.First();
-        if (group.Fragments.Count == 1) {
-          return group.Fragments[0].Classification;
-        }
+      // Note: The lookup table gets rebuilt together with the matchers whenever the commands change.
+      // Using it instead of running the whole Parse() machinery on the single command matters for
+      // performance: This function gets called for every command e.g. while initializing the
+      // autocomplete box, which shows a few hundred commands.
+      if (mClassificationForCommand.TryGetValue(cmdWithSlashOrAt.Substring(1), out ClassificationEnum classification)) {
+        return classification;
       }
 
       Debug.Assert(false); // Unknown Doxygen command?
@@ -228,98 +689,129 @@ namespace VSDoxyHighlighter
 
     private void OnDoxygenCommandsGotUpdated(object sender, EventArgs e)
     {
-      InitMatchers();
-      ParsingMethodChanged?.Invoke(this, EventArgs.Empty);
+      // Rebuild the matchers on a background thread: Building the lexer trie and especially constructing the
+      // fallback regexes (RegexOptions.Compiled) for customized commands is expensive, and this runs every time
+      // the user clicks "OK" in the options. Doing it synchronously on the UI thread froze VS noticeably.
+      // The generation counter discards an outdated rebuild if the commands change again in the meantime.
+      int rebuildGeneration = ++mMatcherRebuildGeneration;
+      var commandGroups = mDoxygenCommands.CommandGroups;
+      bool enableMarkdown = mDoxygenCommands.Options.EnableMarkdownHighlighting;
+
+      _ = ThreadHelper.JoinableTaskFactory.RunAsync(async () => {
+        var built = await Task.Run(() => BuildAllMatchers(commandGroups, enableMarkdown));
+
+        await ThreadHelper.JoinableTaskFactory.SwitchToMainThreadAsync();
+        if (mDisposed || rebuildGeneration != mMatcherRebuildGeneration) {
+          return;
+        }
+
+        // Swap in the newly built matchers. The assignments themselves are atomic reference assignments. A parse
+        // that is already running on a background thread might see a mixture of old and new matchers, but its
+        // result gets discarded anyway because ParsingMethodChanged causes the classifiers to invalidate their
+        // caches (and with it any pending background parse).
+        (mCommandLexer, mMatchers, mClassificationForCommand, mMarkdownKinds) = built;
+
+        // All interned parse results were produced by the old matchers. Bumping the generation under the
+        // lock also prevents a parse that is still running with the old matchers from re-inserting a stale
+        // result afterwards.
+        lock (mInternedParseResults) {
+          ++mInternGeneration;
+          mInternedParseResults.Clear();
+          mInternedBytes = 0;
+        }
+
+        ParsingMethodChanged?.Invoke(this, EventArgs.Empty);
+      });
     }
 
 
-    private void InitMatchers() 
+    private void InitMatchers()
     {
-      mMatchers = BuildMatchers(mDoxygenCommands.CommandGroups);
+      (mCommandLexer, mMatchers, mClassificationForCommand, mMarkdownKinds)
+        = BuildAllMatchers(mDoxygenCommands.CommandGroups, mDoxygenCommands.Options.EnableMarkdownHighlighting);
     }
 
 
-    private static List<FragmentMatcher> BuildMatchers(List<DoxygenCommandGroup> doxygenCommands)
+    private static (CommentLexer lexer, List<FragmentMatcher> matchers,
+                    Dictionary<string, ClassificationEnum> classificationLookup, MarkdownEmphasisKind[] markdownKinds)
+        BuildAllMatchers(List<DoxygenCommandGroup> commandGroups, bool enableMarkdown)
     {
-      var matchers = new List<FragmentMatcher>();
+      // The lexer finds all Doxygen commands of the groups it understands in a single pass over the text.
+      // All other groups (which cannot happen with the default commands, but might in the future with e.g.
+      // custom user commands) get matched by the original regexes as fallback.
+      var groupsNotSupportedByLexer = new List<DoxygenCommandGroup>();
+      CommentLexer lexer = CommentLexer.Create(commandGroups, groupsNotSupportedByLexer);
+      List<FragmentMatcher> matchers = BuildMatchers(groupsNotSupportedByLexer, enableMarkdown);
+      var classificationLookup = BuildClassificationLookup(commandGroups);
+      // Specialize the matcher set to the configuration: With disabled markdown highlighting, neither the
+      // emphasis scanner nor the inline code regex run at all (instead of matching and throwing away).
+      MarkdownEmphasisKind[] markdownKinds = enableMarkdown ? cMarkdownEmphasisKinds : Array.Empty<MarkdownEmphasisKind>();
+      return (lexer, matchers, classificationLookup, markdownKinds);
+    }
+
+
+    /// <summary>
+    /// Builds the lookup table used by GetClassificationForCommand(). The first classification of each
+    /// command group is the classification of the command keyword itself (the remaining ones are for
+    /// the parameters of the command).
+    /// </summary>
+    private static Dictionary<string, ClassificationEnum> BuildClassificationLookup(List<DoxygenCommandGroup> doxygenCommands)
+    {
+      var lookup = new Dictionary<string, ClassificationEnum>();
+      foreach (DoxygenCommandGroup cmdGroup in doxygenCommands) {
+        Debug.Assert(cmdGroup.Classifications.Length >= 1);
+        foreach (string cmd in cmdGroup.Commands) {
+          Debug.Assert(!lookup.ContainsKey(cmd));
+          lookup[cmd] = cmdGroup.Classifications[0];
+        }
+      }
+      return lookup;
+    }
+
 
+    private static List<FragmentMatcher> BuildMatchers(List<DoxygenCommandGroup> doxygenCommands, bool enableMarkdown)
+    {
       // NOTE: The order in which the regexes are created and added here should not matter.
 
-      // `inline code`
-      matchers.Add(new FragmentMatcher
-      {
-        re = new Regex(@"(`.*?`)", cOptions, cRegexTimeout),
-        classifications = new ClassificationEnum[] { ClassificationEnum.InlineCode }
-      });
+      // The fixed matchers currently consist only of the inline code pattern, which counts as markdown.
+      var matchers = enableMarkdown ? new List<FragmentMatcher>(cFixedMatchers) : new List<FragmentMatcher>();
 
-      // Add all Doxygen commands
+      // Add all Doxygen command groups that are not handled by the CommentLexer. With the default configuration
+      // this list is empty; only customized commands with an unknown RegexCreatorDelegate end up here. So in the
+      // default configuration, no regex at all needs to be constructed when the matchers get (re)built.
       foreach (DoxygenCommandGroup cmdGroup in doxygenCommands) {
         matchers.Add(new FragmentMatcher {
-          re = new Regex(cmdGroup.RegexCreator(cmdGroup.Commands), cOptions),
+          re = new Regex(cmdGroup.RegexCreator(cmdGroup.Commands), cOptions, cRegexTimeout),
           classifications = cmdGroup.Classifications
         });
       }
 
-      // *italic*
-      matchers.Add(new FragmentMatcher
-      {
-        // https://regex101.com/r/ekhlTW/1
-        // (1)  Stuff allowed to precede the first "*". According to the doxygen documentation:
-        //      Only the following is allowed: a space, newline, or one the following characters <{([,:;
-        // (2a) Match the actual starting "*"
-        // (2b) After the "*", some characters are forbidden. Another "*" is forbidden, so that we can detect **bold** text.
-        //      Space and tab are forbidden to reduce the number of false positives, especially until we implement reliable
-        //      classification of code vs comment (in "* str*" the "str" is not formatted because of the space).
-        //      We also forbid a ")" to rule out constructs in the code such as: int * (*)(const char*)
-        // (2c) Match any character multiple times, but not those which are preceded by whitespace or "*".
-        // (2d) Before the terminating "*", some characters must NOT appear.
-        //      The "*" is ruled out so that we can detect **bold** text with the other regex below.
-        //      "/" is forbidden since "/*" would be a comment start.
-        //      Otherwise, the doxygen documentation states, that the following is NOT allowed:
-        //      space, newline, or one the following characters ({[<=+-\@
-        // (2e) Match the actual terminating "*"
-        // (3)  After the terminating "*", not everything is allowed. According to the doxgen documentation,
-        //      only non-alphanumeric characters are allowed. We also forbid "*" for proper support of **bold** text,
-        //      similar for "~" and "_". Also, "/" is not allowed to not match the C-style comment terminator "*/".
-        //      We also forbid "<" and ">" to rule out some false positives in C++ templates (until we implemented detection
-        //      of whether we are actually in a comment or in code).
-        // 
-        //                        1           2a     2b               2c                   2d               2e            3
-        //                __________________  __ ____________ _________________ __________________________ __ ____________________________
-        re = new Regex(@"(?:^|[ \t<{\(\[,:;])(\*(?![\* \t\)])(?:.(?![ \t]\*))*?[^\*\/ \t\n\r\({\[<=\+\-\\@]\*)(?:\r?$|[^a-zA-Z0-9_\*\/~<>])", cOptions, cRegexTimeout),
-        classifications = new ClassificationEnum[] { ClassificationEnum.EmphasisMinor }
-      });
-
-      // **bold**
-      matchers.Add(new FragmentMatcher
-      {
-        re = new Regex(@"(?:^|[ \t<{\(\[,:;])(\*\*(?![\* \t\)])(?:.(?![ \t]\*))*?[^\*\/ \t\n\r\({\[<=\+\-\\@]\*\*)(?:\r?$|[^a-zA-Z0-9_\*\/~<>])", cOptions, cRegexTimeout),
-        classifications = new ClassificationEnum[] { ClassificationEnum.EmphasisMajor }
-      });
+      return matchers;
+    }
 
-      // _italic_
-      matchers.Add(new FragmentMatcher
-      {
-        re = new Regex(@"(?:^|[ \t<{\(\[,:;])(_(?![_ \t\)])(?:.(?![ \t]_))*?[^_\/ \t\n\r\({\[<=\+\-\\@]_)(?:\r?$|[^a-zA-Z0-9_\*\/~<>])", cOptions, cRegexTimeout),
-        classifications = new ClassificationEnum[] { ClassificationEnum.EmphasisMinor }
-      });
 
-      // __bold__
-      matchers.Add(new FragmentMatcher
-      {
-        re = new Regex(@"(?:^|[ \t<{\(\[,:;])(__(?![_ \t\)])(?:.(?![ \t]_))*?[^_\/ \t\n\r\({\[<=\+\-\\@]__)(?:\r?$|[^a-zA-Z0-9_\*\/~<>])", cOptions, cRegexTimeout),
-        classifications = new ClassificationEnum[] { ClassificationEnum.EmphasisMajor }
-      });
+    /// <summary>
+    /// Creates the matchers for inline code. These are independent of the (configurable) Doxygen commands,
+    /// i.e. the patterns are fixed at build time. They therefore live in a static (cFixedMatchers) and get
+    /// created only once per process: Especially with RegexOptions.Compiled, the construction of a Regex is
+    /// expensive, and previously it was redone for all of them on package load and on every change of the options,
+    /// which showed up in the measured extension load time. (Source-generated regexes, which would bake the
+    /// engines directly into the assembly, do not exist on .NET Framework; a process-wide static is the closest
+    /// equivalent.) Sharing the Regex instances is safe since Regex is thread-safe and stateless.
+    /// Note: The markdown emphasis patterns (*italic*, etc.) are handled by the MarkdownScanner, not by regexes.
+    /// </summary>
+    private static FragmentMatcher[] CreateFixedMatchers()
+    {
+      var matchers = new List<FragmentMatcher>();
 
-      // ~~strikethrough~~
+      // `inline code`
       matchers.Add(new FragmentMatcher
       {
-        re = new Regex(@"(?:^|[ \t<{\(\[,:;])(~~(?![~ \t\)])(?:.(?![ \t]~))*?[^~\/ \t\n\r\({\[<=\+\-\\@]~~)(?:\r?$|[^a-zA-Z0-9_\*\/~<>])", cOptions, cRegexTimeout),
-        classifications = new ClassificationEnum[] { ClassificationEnum.Strikethrough }
+        re = new Regex(@"(`.*?`)", cOptions, cRegexTimeout),
+        classifications = new ClassificationEnum[] { ClassificationEnum.InlineCode }
       });
 
-
-      return matchers;
+      return matchers.ToArray();
     }
 
 
@@ -564,23 +1056,27 @@ namespace VSDoxyHighlighter
     }
 
     /// <summary>
-    /// Comparer that sorts formatted fragments by their position in the text. 
-    /// Overlapping fragments are treated as equal, so that only one can win in the end.
+    /// A found fragment group together with the position at which it was found during the matching, used
+    /// for the stable in-place sort in Parse().
     /// </summary>
-    private class NonOverlappingCommandGroupsComparer : IComparer<FormattedFragmentGroup>
+    private struct GroupWithOrder
     {
-      public int Compare(FormattedFragmentGroup lhs, FormattedFragmentGroup rhs)
+      public FormattedFragmentGroup group;
+      public int orderOfDetection;
+    }
+
+    /// <summary>
+    /// Comparer that sorts the found groups by their position in the text. Groups starting at the same
+    /// position keep their relative order of detection (making the unstable List.Sort() effectively stable).
+    /// </summary>
+    private class GroupStartIndexComparer : IComparer<GroupWithOrder>
+    {
+      public int Compare(GroupWithOrder lhs, GroupWithOrder rhs)
       {
-        if (lhs.EndIndex < rhs.StartIndex) {
-          return -1;
-        }
-        else if (lhs.StartIndex > rhs.EndIndex) {
-          return 1;
-        }
-        else {
-          // Fragments overlap, treat them as equal.
-          return 0;
+        if (lhs.group.StartIndex != rhs.group.StartIndex) {
+          return lhs.group.StartIndex.CompareTo(rhs.group.StartIndex);
         }
+        return lhs.orderOfDetection.CompareTo(rhs.orderOfDetection);
       }
     }
 
@@ -597,15 +1093,294 @@ namespace VSDoxyHighlighter
       public ClassificationEnum[] classifications { get; set; }
     };
 
+    /// <summary>
+    /// Represents one markdown emphasis style that the MarkdownScanner should find.
+    /// </summary>
+    private struct MarkdownEmphasisKind
+    {
+      public string delimiter { get; set; }
+      public ClassificationEnum classification { get; set; }
+    };
+
     private readonly DoxygenCommands mDoxygenCommands;
 
+    // Finds all Doxygen commands of the known command groups in a single pass over the text.
+    private CommentLexer mCommandLexer;
+
+    // Regex based matchers for everything that neither the CommentLexer nor the MarkdownScanner
+    // handles (inline code, and command groups with an unknown RegexCreatorDelegate).
     private List<FragmentMatcher> mMatchers;
+
+    // Maps every known Doxygen command (without the leading "\" or "@") to the classification of
+    // the command keyword. Used for the O(1) lookup in GetClassificationForCommand().
+    private Dictionary<string, ClassificationEnum> mClassificationForCommand;
+
+    // The markdown emphasis styles that the MarkdownScanner should look for; either all of them
+    // (cMarkdownEmphasisKinds) or none, if the user disabled the markdown highlighting.
+    private MarkdownEmphasisKind[] mMarkdownKinds;
+
+    // See the pre-scan at the start of Parse(): A text without any of these characters cannot contain
+    // anything we highlight, no matter the configuration.
+    private static readonly char[] cPotentialMatchTriggerChars = { '\\', '@', '`', '*', '_', '~' };
+
     private bool mDisposed = false;
 
+    // Used to discard an outdated background rebuild of the matchers if the commands change again before
+    // the rebuild finished. Only touched on the UI thread.
+    private int mMatcherRebuildGeneration = 0;
+
+    // Reusable per-thread scratch buffers of Parse(), so that the steady state of parsing a line does not
+    // allocate them anew every time. See the comments in Parse().
+    [ThreadStatic] private static List<FormattedFragmentGroup> tScratchFragmentGroups;
+    [ThreadStatic] private static List<GroupWithOrder> tScratchGroupsWithOrder;
+
+    private static readonly GroupStartIndexComparer cGroupComparer = new GroupStartIndexComparer();
+
+    // Threshold above which Parse() splits the text into partitions that get parsed on multiple cores.
+    // Ordinary comments (a few lines up to a few screens) stay far below it, so they do not pay the
+    // partitioning overhead; only monster blocks such as multi-thousand-line license banners exceed it.
+    private const int cMinCharsForParallelParse = 32 * 1024;
+    // Minimum size of a single partition; limits the number of partitions for texts that are just barely
+    // above cMinCharsForParallelParse, so that the per-partition overhead stays negligible.
+    private const int cMinPartitionSizeInChars = 16 * 1024;
+    // See SelectSeamSafePartitionBoundaries().
+    private const int cMaxSeamShiftAttempts = 100;
+
+    private struct InternedParseResult
+    {
+      public IList<FormattedFragmentGroup> Groups;
+      // The offsetInSnapshot with which the interned result was originally parsed. A request for the same
+      // text at a different position gets a shifted copy.
+      public int BaseOffset;
+    }
+
+    // Process-wide store of parse results, keyed by the parsed text; see the comment in Parse(). Also serves
+    // as its own lock, since Parse() runs concurrently on the UI thread and on thread pool threads.
+    private readonly Dictionary<string, InternedParseResult> mInternedParseResults = new Dictionary<string, InternedParseResult>();
+    // Guarded by the mInternedParseResults lock. Incremented whenever the matchers get swapped out, so that
+    // results produced by outdated matchers are never interned.
+    private int mInternGeneration = 0;
+    private int mInternedBytes = 0;
+    // Memory budget of the interning store. Deliberately a fixed value rather than part of the configurable
+    // cache budget of the classifiers: The store is shared by the whole process, and its content is cheap to
+    // recompute (in contrast to the classifier caches, it does not depend on the VS cpp colorer).
+    private const int cMaxInternedBytes = 16 * 1024 * 1024;
+
     private const RegexOptions cOptions = RegexOptions.Compiled | RegexOptions.Multiline;
 
     // In my tests, each individual regex always used less than 100ms.
     // The max. time I was able to measure for a VERY long line was ~60ms.
     private static readonly TimeSpan cRegexTimeout = TimeSpan.FromMilliseconds(100.0);
+
+    // The matchers whose patterns do not depend on the configuration. Created only once per process; see
+    // CreateFixedMatchers() for the reasoning. Note: Must be declared after cRegexTimeout, because static
+    // field initializers run in declaration order.
+    private static readonly FragmentMatcher[] cFixedMatchers = CreateFixedMatchers();
+
+    // The markdown emphasis styles, in the same order in which the corresponding regexes used to be tried.
+    // The order matters because of the stable sort in Parse(): Of two groups starting at the same index, the
+    // one found by the earlier emphasis style wins.
+    private static readonly MarkdownEmphasisKind[] cMarkdownEmphasisKinds = new MarkdownEmphasisKind[] {
+      new MarkdownEmphasisKind { delimiter = "*", classification = ClassificationEnum.EmphasisMinor },
+      new MarkdownEmphasisKind { delimiter = "**", classification = ClassificationEnum.EmphasisMajor },
+      new MarkdownEmphasisKind { delimiter = "_", classification = ClassificationEnum.EmphasisMinor },
+      new MarkdownEmphasisKind { delimiter = "__", classification = ClassificationEnum.EmphasisMajor },
+      new MarkdownEmphasisKind { delimiter = "~~", classification = ClassificationEnum.Strikethrough },
+    };
+  }
+
+
+  /// <summary>
+  /// Hand-rolled linear-time scanner for the markdown emphasis styles: *italic*, **bold**, _italic_,
+  /// __bold__ and ~~strikethrough~~.
+  ///
+  /// The emphasis styles used to be found via regexes, one per style, of the shape (here for "*italic*",
+  /// https://regex101.com/r/ekhlTW/1):
+  ///
+  ///                      1           2a     2b               2c                   2d               2e            3
+  ///                __________________ __ ____________ _________________ __________________________ __ ____________________________
+  ///                (?:^|[ \t<{\(\[,:;])(\*(?![\* \t\)])(?:.(?![ \t]\*))*?[^\*\/ \t\n\r\({\[<=\+\-\\@]\*)(?:\r?$|[^a-zA-Z0-9_\*\/~<>])
+  ///
+  /// (1)  Stuff allowed to precede the first "*". According to the doxygen documentation:
+  ///      Only the following is allowed: a space, newline, or one the following characters <{([,:;
+  /// (2a) Match the actual starting "*"
+  /// (2b) After the "*", some characters are forbidden. Another "*" is forbidden, so that we can detect **bold** text.
+  ///      Space and tab are forbidden to reduce the number of false positives, especially until we implement reliable
+  ///      classification of code vs comment (in "* str*" the "str" is not formatted because of the space).
+  ///      We also forbid a ")" to rule out constructs in the code such as: int * (*)(const char*)
+  /// (2c) Match any character multiple times, but not those which are preceded by whitespace or "*".
+  /// (2d) Before the terminating "*", some characters must NOT appear.
+  ///      The "*" is ruled out so that we can detect **bold** text with the "**" style.
+  ///      "/" is forbidden since "/*" would be a comment start.
+  ///      Otherwise, the doxygen documentation states, that the following is NOT allowed:
+  ///      space, newline, or one the following characters ({[<=+-\@
+  /// (2e) Match the actual terminating "*"
+  /// (3)  After the terminating "*", not everything is allowed. According to the doxgen documentation,
+  ///      only non-alphanumeric characters are allowed. We also forbid "*" for proper support of **bold** text,
+  ///      similar for "~" and "_". Also, "/" is not allowed to not match the C-style comment terminator "*/".
+  ///      We also forbid "<" and ">" to rule out some false positives in C++ templates (until we implemented detection
+  ///      of whether we are actually in a comment or in code).
+  ///
+  /// The other styles differ only in the delimiter: For "**bold**", (2a) and (2e) become "\*\*" while the
+  /// lookaheads in (2b) and (2c) keep the single "\*"; for "_italic_" and "__bold__" every "\*" in (2a)-(2e)
+  /// becomes "_"; for "~~strikethrough~~" it becomes "~", with "~~" in (2a) and (2e). (3) is identical for all.
+  ///
+  /// The problem with the regexes: The lazy loop (2c) together with the lookaheads makes them backtrack
+  /// heavily on inputs that contain many delimiter characters without valid emphasis (e.g. base64 blobs,
+  /// ASCII art or long table rows in comments), resulting in super-linear runtime and ultimately a hit of
+  /// the regex timeout, which made the whole comment lose its highlighting. This scanner accepts exactly
+  /// the same strings (verified by differential fuzzing against the original regexes) but makes at most one
+  /// pass over every character per candidate start position without ever backtracking behind it, i.e. it
+  /// runs in O(n).
+  /// </summary>
+  internal static class MarkdownScanner
+  {
+    /// <summary>
+    /// Finds all fragments of the emphasis style given by <paramref name="delimiter"/> (e.g. "*" or "~~") in
+    /// "text", in the same way the original regex with RegexOptions.Multiline would have found them via
+    /// successive Match()/NextMatch() calls on the first <paramref name="parseLength"/> characters. Every
+    /// found fragment is appended to <paramref name="outGroups"/> as a group with a single fragment, where
+    /// <paramref name="offsetInSnapshot"/> gets added to the fragment's index (compare
+    /// <see cref="CommentParser.Parse(string, int)"/>).
+    /// </summary>
+    public static void FindAllFragments(
+        string text,
+        int parseLength,
+        int offsetInSnapshot,
+        string delimiter,
+        ClassificationEnum classification,
+        List<FormattedFragmentGroup> outGroups)
+    {
+      char delimiterChar = delimiter[0];
+      int delimiterLength = delimiter.Length;
+
+      int idx = 0;
+      while (idx < parseLength) {
+        // Mimics the alternation (1) of the regex, including the order in which the regex engine tries the
+        // alternatives at a given position: First the zero-width "^" (which, due to RegexOptions.Multiline,
+        // matches at the start of every line), then the character class that consumes one character.
+        if (idx == 0 || text[idx - 1] == '\n') {
+          if (TryMatchEmphasisAt(text, parseLength, idx, delimiterChar, delimiterLength,
+                                 out int fragmentLength, out int matchEnd)) {
+            outGroups.Add(new FormattedFragmentGroup(
+              new FormattedFragment(offsetInSnapshot + idx, fragmentLength, classification)));
+            idx = matchEnd;
+            continue;
+          }
+        }
+
+        char prefixChar = text[idx];
+        if (prefixChar == ' ' || prefixChar == '\t' || prefixChar == '<' || prefixChar == '{'
+            || prefixChar == '(' || prefixChar == '[' || prefixChar == ',' || prefixChar == ':'
+            || prefixChar == ';') {
+          if (TryMatchEmphasisAt(text, parseLength, idx + 1, delimiterChar, delimiterLength,
+                                 out int fragmentLength, out int matchEnd)) {
+            outGroups.Add(new FormattedFragmentGroup(
+              new FormattedFragment(offsetInSnapshot + idx + 1, fragmentLength, classification)));
+            idx = matchEnd;
+            continue;
+          }
+        }
+
+        ++idx;
+      }
+    }
+
+
+    /// <summary>
+    /// Attempts to match the parts (2a)-(3) of the pattern with the emphasized fragment starting at
+    /// <paramref name="fragmentStart"/>, considering only the first <paramref name="end"/> characters of
+    /// "text". On success, "fragmentLength" is the length of the emphasized fragment (corresponding to the
+    /// capturing group of the regex, i.e. including the delimiters but excluding (1) and (3)), and
+    /// "matchEnd" is the index just behind the whole match (i.e. including a character consumed by (3)),
+    /// which is where the scan for the next match should resume.
+    /// </summary>
+    private static bool TryMatchEmphasisAt(
+        string text, int end, int fragmentStart, char delimiterChar, int delimiterLength,
+        out int fragmentLength, out int matchEnd)
+    {
+      fragmentLength = 0;
+      matchEnd = 0;
+
+      // (2a): The opening delimiter.
+      if (fragmentStart + delimiterLength > end) {
+        return false;
+      }
+      for (int i = 0; i < delimiterLength; ++i) {
+        if (text[fragmentStart + i] != delimiterChar) {
+          return false;
+        }
+      }
+
+      // (2b): Negative lookahead after the opening delimiter. Note that it trivially succeeds at the end of
+      // the parsed range, because there is no character left that the lookahead could match.
+      int contentStart = fragmentStart + delimiterLength;
+      if (contentStart < end) {
+        char c = text[contentStart];
+        if (c == delimiterChar || c == ' ' || c == '\t' || c == ')') {
+          return false;
+        }
+      }
+
+      // The loop (2c) is lazy, i.e. the regex engine first tries to match (2d)+(2e)+(3) before extending the
+      // loop by another character. We do the same: "contentEnd" is the candidate position of the single
+      // character matched by (2d).
+      for (int contentEnd = contentStart; contentEnd < end; ++contentEnd) {
+        char c = text[contentEnd];
+
+        // (2d): The character immediately before the terminating delimiter.
+        if (c != delimiterChar && c != '/' && c != ' ' && c != '\t' && c != '\n' && c != '\r'
+            && c != '(' && c != '{' && c != '[' && c != '<' && c != '=' && c != '+' && c != '-'
+            && c != '\\' && c != '@'
+            && contentEnd + delimiterLength < end) {
+          // (2e): The terminating delimiter.
+          bool closingDelimiterFound = true;
+          for (int i = 1; i <= delimiterLength; ++i) {
+            if (text[contentEnd + i] != delimiterChar) {
+              closingDelimiterFound = false;
+              break;
+            }
+          }
+
+          if (closingDelimiterFound) {
+            // (3): "(?:\r?$|[^a-zA-Z0-9_\*\/~<>])". The "$" matches (zero-width) at the end of the parsed
+            // range and before every "\n" (due to RegexOptions.Multiline). A "\r" is not in the forbidden
+            // character class, so in every case where the first alternative consumes a "\r", the second
+            // alternative would consume it, too; hence we need to distinguish only "zero-width match"
+            // (nothing consumed) and "one allowed character" (consumed, so the next match attempt starts
+            // after it).
+            int suffixIdx = contentEnd + delimiterLength + 1;
+            if (suffixIdx == end || text[suffixIdx] == '\n') {
+              fragmentLength = suffixIdx - fragmentStart;
+              matchEnd = suffixIdx;
+              return true;
+            }
+            char suffixChar = text[suffixIdx];
+            if (!(('a' <= suffixChar && suffixChar <= 'z') || ('A' <= suffixChar && suffixChar <= 'Z')
+                  || ('0' <= suffixChar && suffixChar <= '9') || suffixChar == '_' || suffixChar == '*'
+                  || suffixChar == '/' || suffixChar == '~' || suffixChar == '<' || suffixChar == '>')) {
+              fragmentLength = suffixIdx - fragmentStart;
+              matchEnd = suffixIdx + 1;
+              return true;
+            }
+          }
+        }
+
+        // No terminating delimiter here, so text[contentEnd] must be consumable by the lazy loop (2c):
+        // The "." does not match a "\n" (no RegexOptions.Singleline), and the negative lookahead
+        // "(?![ \t]x)" (with "x" being the single delimiter character, also for the two-character
+        // delimiters) must not match behind it.
+        if (c == '\n') {
+          return false;
+        }
+        if (contentEnd + 2 < end
+            && (text[contentEnd + 1] == ' ' || text[contentEnd + 1] == '\t')
+            && text[contentEnd + 2] == delimiterChar) {
+          return false;
+        }
+      }
+
+      return false;
+    }
   }
 }
@@ -83,6 +83,12 @@ namespace VSDoxyHighlighter
     /// </summary>
     public List<DoxygenCommandGroup> CommandGroups { get; private set; }
 
+    /// <summary>
+    /// The options the commands were built from. Gives the CommentParser access to the settings that
+    /// influence the matcher construction, without a second subscription to the settings events.
+    /// </summary>
+    public IGeneralOptions Options { get { return mGeneralOptions; } }
+
 
     public void Dispose()
     {
@@ -121,6 +127,11 @@ namespace VSDoxyHighlighter
     private void OnSettingsChanged(object sender, EventArgs e)
     {
       InitCommands();
+      // The cached quick info descriptions embed the classifications of the commands, which might have
+      // changed. Invalidate before firing the event, so that no listener can get served a stale description.
+      AllDoxygenHelpPageCommands.InvalidateDescriptionCache();
+      // Same for the precomputed completion items of the autocomplete, which reference the help page commands.
+      CommentCommandCompletionSource.InvalidateSharedCommandItems();
       CommandsGotUpdated?.Invoke(this, EventArgs.Empty);
     }
 
@@ -1,228 +1,135 @@
-// This file was automatically generated by the Python script
-// ParseDoxygenCommandHelpPage.py on 2024-05-09 12:19:53.
+using System;
+using System.IO;
+using System.Reflection;
+using System.Text;
 
 namespace VSDoxyHighlighter
 {
+  /// <summary>
+  /// Exposes the Doxygen commands that the Python script ParseDoxygenCommandHelpPage.py extracted from
+  /// the official help page https://www.doxygen.nl/manual/commands.html
+  ///
+  /// The script emits the data as the compact binary file "DoxygenCommandsGeneratedFromHelpPage.bin",
+  /// which is embedded into the extension's assembly as a resource. (The script used to emit a huge C#
+  /// source file with all the data as static initializers instead.) When this class is first touched,
+  /// only the index part of the resource gets read: the command names, parameters, hyperlinks, and the
+  /// offsets of the descriptions within the resource. The descriptions themselves make up the bulk of
+  /// the data (hundreds of KB of help text), but they are required only if the user actually views the
+  /// description of a specific command in a quick info tooltip or in the autocomplete box. Hence, each
+  /// description gets deserialized lazily when it is accessed the first time; compare the Description
+  /// property of DoxygenHelpPageCommand. That keeps the package cold-start cheap and the help texts of
+  /// never-viewed commands out of the managed heap entirely.
+  /// </summary>
   class DoxygenCommandsGeneratedFromHelpPage
   {
-    public static readonly DoxygenHelpPageCommand[] cCommands = {
-      new DoxygenHelpPageCommand("addtogroup",             "<name> [(title)]",                                                                "https://www.doxygen.nl/manual/commands.html#cmdaddtogroup",             new (object, string, string)[]{ (null, "Defines a group just like ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\defgroup", "https://www.doxygen.nl/manual/commands.html#cmddefgroup"), (null, ", but in contrast to that command using the same <name> more than once will not result in a warning, but rather one group with a merged documentation and the first title found in any of the commands.\n\nThe title is optional, so this command can also be used to add a number of entities to an existing group using ", ""), (ClassificationEnum.InlineCode, "@{", ""), (null, " and ", ""), (ClassificationEnum.InlineCode, "@}", ""), (null, " like this:\n\n", ""), (ClassificationEnum.InlineCode, "     /*! \\addtogroup mygrp\n      *  Additional documentation for group 'mygrp'\n      *  @{\n      */\n   \n     /*!\n      *  A function\n      */\n     void func1()\n     {\n     }\n   \n     /*! Another function */\n     void func2()\n     {\n     }\n   \n     /*! @} */\n\n", ""), (null, "See also: page ", ""), (null, "Grouping", "https://www.doxygen.nl/manual/grouping.html"), (null, ", commands ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\defgroup", "https://www.doxygen.nl/manual/commands.html#cmddefgroup"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\ingroup", "https://www.doxygen.nl/manual/commands.html#cmdingroup"), (null, ", and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\weakgroup", "https://www.doxygen.nl/manual/commands.html#cmdweakgroup"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("callgraph",              "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdcallgraph",              new (object, string, string)[]{ (null, "When this command is put in a comment block of a function or method and ", ""), (null, "HAVE_DOT", "https://www.doxygen.nl/manual/config.html#cfg_have_dot"), (null, " is set to ", ""), (ClassificationEnum.InlineCode, "YES", ""), (null, ", then doxygen will generate a call graph for that function (provided the implementation of the function or method calls other documented functions). The call graph will be generated regardless of the value of ", ""), (null, "CALL_GRAPH", "https://www.doxygen.nl/manual/config.html#cfg_call_graph"), (null, ".\n\n", ""), (ClassificationEnum.Note, "Note:", ""), (null, " The completeness (and correctness) of the call graph depends on the doxygen code parser which is not perfect.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\callergraph", "https://www.doxygen.nl/manual/commands.html#cmdcallergraph"), (null, ", command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\hidecallgraph", "https://www.doxygen.nl/manual/commands.html#cmdhidecallgraph"), (null, ", command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\hidecallergraph", "https://www.doxygen.nl/manual/commands.html#cmdhidecallergraph"), (null, " and option ", ""), (null, "CALL_GRAPH", "https://www.doxygen.nl/manual/config.html#cfg_call_graph"), }),
-      new DoxygenHelpPageCommand("hidecallgraph",          "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdhidecallgraph",          new (object, string, string)[]{ (null, "When this command is put in a comment block of a function or method and then doxygen will not generate a call graph for that function. The call graph will not be generated regardless of the value of ", ""), (null, "CALL_GRAPH", "https://www.doxygen.nl/manual/config.html#cfg_call_graph"), (null, ".\n\n", ""), (ClassificationEnum.Note, "Note:", ""), (null, " The completeness (and correctness) of the call graph depends on the doxygen code parser which is not perfect.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\callergraph", "https://www.doxygen.nl/manual/commands.html#cmdcallergraph"), (null, ", command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\callgraph", "https://www.doxygen.nl/manual/commands.html#cmdcallgraph"), (null, ", command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\hidecallergraph", "https://www.doxygen.nl/manual/commands.html#cmdhidecallergraph"), (null, " and option ", ""), (null, "CALL_GRAPH", "https://www.doxygen.nl/manual/config.html#cfg_call_graph"), }),
-      new DoxygenHelpPageCommand("callergraph",            "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdcallergraph",            new (object, string, string)[]{ (null, "When this command is put in a comment block of a function or method and ", ""), (null, "HAVE_DOT", "https://www.doxygen.nl/manual/config.html#cfg_have_dot"), (null, " is set to ", ""), (ClassificationEnum.InlineCode, "YES", ""), (null, ", then doxygen will generate a caller graph for that function (provided the implementation of the function or method is called by other documented functions). The caller graph will be generated regardless of the value of ", ""), (null, "CALLER_GRAPH", "https://www.doxygen.nl/manual/config.html#cfg_caller_graph"), (null, ".\n\n", ""), (ClassificationEnum.Note, "Note:", ""), (null, " The completeness (and correctness) of the caller graph depends on the doxygen code parser which is not perfect.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\callgraph", "https://www.doxygen.nl/manual/commands.html#cmdcallgraph"), (null, ", command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\hidecallgraph", "https://www.doxygen.nl/manual/commands.html#cmdhidecallgraph"), (null, ", command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\hidecallergraph", "https://www.doxygen.nl/manual/commands.html#cmdhidecallergraph"), (null, " and option ", ""), (null, "CALLER_GRAPH", "https://www.doxygen.nl/manual/config.html#cfg_caller_graph"), }),
-      new DoxygenHelpPageCommand("hidecallergraph",        "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdhidecallergraph",        new (object, string, string)[]{ (null, "When this command is put in a comment block of a function or method and then doxygen will not generate a caller graph for that function. The caller graph will not be generated regardless of the value of ", ""), (null, "CALLER_GRAPH", "https://www.doxygen.nl/manual/config.html#cfg_caller_graph"), (null, ".\n\n", ""), (ClassificationEnum.Note, "Note:", ""), (null, " The completeness (and correctness) of the caller graph depends on the doxygen code parser which is not perfect.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\callergraph", "https://www.doxygen.nl/manual/commands.html#cmdcallergraph"), (null, ", command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\callgraph", "https://www.doxygen.nl/manual/commands.html#cmdcallgraph"), (null, ", command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\hidecallgraph", "https://www.doxygen.nl/manual/commands.html#cmdhidecallgraph"), (null, " and option ", ""), (null, "CALLER_GRAPH", "https://www.doxygen.nl/manual/config.html#cfg_caller_graph"), }),
-      new DoxygenHelpPageCommand("showrefby",              "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdshowrefby",              new (object, string, string)[]{ (null, "When this command is put in a comment block of a function, method or variable, then doxygen will generate an overview for that function, method, variable of the, documented, functions and methods that call / use it. The overview will be generated regardless of the value of ", ""), (null, "REFERENCED_BY_RELATION", "https://www.doxygen.nl/manual/config.html#cfg_referenced_by_relation"), (null, ".\n\n", ""), (ClassificationEnum.Note, "Note:", ""), (null, " The completeness (and correctness) of the overview depends on the doxygen code parser which is not perfect.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\showrefs", "https://www.doxygen.nl/manual/commands.html#cmdshowrefs"), (null, ", command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\hiderefby", "https://www.doxygen.nl/manual/commands.html#cmdhiderefby"), (null, ", command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\hiderefs", "https://www.doxygen.nl/manual/commands.html#cmdhiderefs"), (null, " and option ", ""), (null, "REFERENCED_BY_RELATION", "https://www.doxygen.nl/manual/config.html#cfg_referenced_by_relation"), }),
-      new DoxygenHelpPageCommand("hiderefby",              "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdhiderefby",              new (object, string, string)[]{ (null, "When this command is put in a comment block of a function, method or variable then doxygen will not generate an overview for that function, method or variable of the functions and methods that call / use it. The overview will not be generated regardless of the value of ", ""), (null, "REFERENCED_BY_RELATION", "https://www.doxygen.nl/manual/config.html#cfg_referenced_by_relation"), (null, ".\n\n", ""), (ClassificationEnum.Note, "Note:", ""), (null, " The completeness (and correctness) of the overview depends on the doxygen code parser which is not perfect.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\showrefs", "https://www.doxygen.nl/manual/commands.html#cmdshowrefs"), (null, ", command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\showrefby", "https://www.doxygen.nl/manual/commands.html#cmdshowrefby"), (null, ", command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\hiderefs", "https://www.doxygen.nl/manual/commands.html#cmdhiderefs"), (null, " and option ", ""), (null, "REFERENCED_BY_RELATION", "https://www.doxygen.nl/manual/config.html#cfg_referenced_by_relation"), }),
-      new DoxygenHelpPageCommand("showrefs",               "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdshowrefs",               new (object, string, string)[]{ (null, "When this command is put in a comment block of a function or method, then doxygen will generate an overview for that function or method of the functions and methods that call it. The overview will be generated regardless of the value of ", ""), (null, "REFERENCES_RELATION", "https://www.doxygen.nl/manual/config.html#cfg_references_relation"), (null, ".\n\n", ""), (ClassificationEnum.Note, "Note:", ""), (null, " The completeness (and correctness) of the overview depends on the doxygen code parser which is not perfect.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\showrefby", "https://www.doxygen.nl/manual/commands.html#cmdshowrefby"), (null, ", command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\hiderefby", "https://www.doxygen.nl/manual/commands.html#cmdhiderefby"), (null, ", command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\hiderefs", "https://www.doxygen.nl/manual/commands.html#cmdhiderefs"), (null, " and option ", ""), (null, "REFERENCES_RELATION", "https://www.doxygen.nl/manual/config.html#cfg_references_relation"), }),
-      new DoxygenHelpPageCommand("hiderefs",               "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdhiderefs",               new (object, string, string)[]{ (null, "When this command is put in a comment block of a function or method and then doxygen will not generate an overview for that function or method of the functions and methods that call it. The overview will not be generated regardless of the value of ", ""), (null, "REFERENCES_RELATION", "https://www.doxygen.nl/manual/config.html#cfg_references_relation"), (null, ".\n\n", ""), (ClassificationEnum.Note, "Note:", ""), (null, " The completeness (and correctness) of the overview depends on the doxygen code parser which is not perfect.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\showrefs", "https://www.doxygen.nl/manual/commands.html#cmdshowrefs"), (null, ", command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\showrefby", "https://www.doxygen.nl/manual/commands.html#cmdshowrefby"), (null, ", command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\hiderefby", "https://www.doxygen.nl/manual/commands.html#cmdhiderefby"), (null, " and option ", ""), (null, "REFERENCES_RELATION", "https://www.doxygen.nl/manual/config.html#cfg_references_relation"), }),
-      new DoxygenHelpPageCommand("showinlinesource",       "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdshowinlinesource",       new (object, string, string)[]{ (null, "When this command is put in a comment block of a function, multi-line macro, enum or a list initialized variable then doxygen will generate the inline source for that member. The inline source will be generated regardless of the value of ", ""), (null, "INLINE_SOURCES", "https://www.doxygen.nl/manual/config.html#cfg_inline_sources"), (null, ".\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\hideinlinesource", "https://www.doxygen.nl/manual/commands.html#cmdhideinlinesource"), (null, ", option ", ""), (null, "INLINE_SOURCES", "https://www.doxygen.nl/manual/config.html#cfg_inline_sources"), }),
-      new DoxygenHelpPageCommand("hideinlinesource",       "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdhideinlinesource",       new (object, string, string)[]{ (null, "When this command is put in a comment block of a function, multi-line macro, enum or a list initialized variable then doxygen will not generate the inline source for that member. The inline source will not be generated regardless of the value of ", ""), (null, "INLINE_SOURCES", "https://www.doxygen.nl/manual/config.html#cfg_inline_sources"), (null, ".\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\showinlinesource", "https://www.doxygen.nl/manual/commands.html#cmdshowinlinesource"), (null, ", option ", ""), (null, "INLINE_SOURCES", "https://www.doxygen.nl/manual/config.html#cfg_inline_sources"), }),
-      new DoxygenHelpPageCommand("includegraph",           "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdincludegraph",           new (object, string, string)[]{ (null, "When this command is put in a comment block of a file then doxygen will generate an include graph for that file. The include graph will be generated regardless of the value of ", ""), (null, "INCLUDE_GRAPH", "https://www.doxygen.nl/manual/config.html#cfg_include_graph"), (null, ".\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\hideincludegraph", "https://www.doxygen.nl/manual/commands.html#cmdhideincludegraph"), (null, ", command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\includedbygraph", "https://www.doxygen.nl/manual/commands.html#cmdincludedbygraph"), (null, ", command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\hideincludedbygraph", "https://www.doxygen.nl/manual/commands.html#cmdhideincludedbygraph"), (null, " and option ", ""), (null, "INCLUDE_GRAPH", "https://www.doxygen.nl/manual/config.html#cfg_include_graph"), }),
-      new DoxygenHelpPageCommand("hideincludegraph",       "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdhideincludegraph",       new (object, string, string)[]{ (null, "When this command is put in a comment block of a file then doxygen will not generate an include graph for that file. The include graph will not be generated regardless of the value of ", ""), (null, "INCLUDE_GRAPH", "https://www.doxygen.nl/manual/config.html#cfg_include_graph"), (null, ".\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\includegraph", "https://www.doxygen.nl/manual/commands.html#cmdincludegraph"), (null, ", command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\includedbygraph", "https://www.doxygen.nl/manual/commands.html#cmdincludedbygraph"), (null, ", command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\hideincludedbygraph", "https://www.doxygen.nl/manual/commands.html#cmdhideincludedbygraph"), (null, " and option ", ""), (null, "INCLUDE_GRAPH", "https://www.doxygen.nl/manual/config.html#cfg_include_graph"), }),
-      new DoxygenHelpPageCommand("includedbygraph",        "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdincludedbygraph",        new (object, string, string)[]{ (null, "When this command is put in a comment block of an include file then doxygen will generate an included by graph for that include file. The included by graph will be generated regardless of the value of ", ""), (null, "INCLUDED_BY_GRAPH", "https://www.doxygen.nl/manual/config.html#cfg_included_by_graph"), (null, ".\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\hideincludedbygraph", "https://www.doxygen.nl/manual/commands.html#cmdhideincludedbygraph"), (null, ", command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\ncludegraph", "https://www.doxygen.nl/manual/commands.html#cmdincludegraph"), (null, ", command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\hideincludegraph", "https://www.doxygen.nl/manual/commands.html#cmdhideincludegraph"), (null, " and option ", ""), (null, "INCLUDED_BY_GRAPH", "https://www.doxygen.nl/manual/config.html#cfg_included_by_graph"), }),
-      new DoxygenHelpPageCommand("hideincludedbygraph",    "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdhideincludedbygraph",    new (object, string, string)[]{ (null, "When this command is put in a comment block of an include file then doxygen will not generate an included by graph for that include file. The included by graph will not be generated regardless of the value of ", ""), (null, "INCLUDED_BY_GRAPH", "https://www.doxygen.nl/manual/config.html#cfg_included_by_graph"), (null, ".\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\includedbygraph", "https://www.doxygen.nl/manual/commands.html#cmdincludedbygraph"), (null, ", command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\ncludegraph", "https://www.doxygen.nl/manual/commands.html#cmdincludegraph"), (null, ", command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\hideincludegraph", "https://www.doxygen.nl/manual/commands.html#cmdhideincludegraph"), (null, " and option ", ""), (null, "INCLUDED_BY_GRAPH", "https://www.doxygen.nl/manual/config.html#cfg_included_by_graph"), }),
-      new DoxygenHelpPageCommand("directorygraph",         "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmddirectorygraph",         new (object, string, string)[]{ (null, "When this command is put in a comment block of a directory (see section ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\dir", "https://www.doxygen.nl/manual/commands.html#cmddir"), (null, ") then doxygen will generate a directory graph for that directory. The directory graph will be generated regardless of the value of ", ""), (null, "DIRECTORY_GRAPH", "https://www.doxygen.nl/manual/config.html#cfg_directory_graph"), (null, ".\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\hidedirectorygraph", "https://www.doxygen.nl/manual/commands.html#cmdhidedirectorygraph"), (null, ", option ", ""), (null, "DIRECTORY_GRAPH", "https://www.doxygen.nl/manual/config.html#cfg_directory_graph"), }),
-      new DoxygenHelpPageCommand("hidedirectorygraph",     "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdhidedirectorygraph",     new (object, string, string)[]{ (null, "When this command is put in a comment block of a directory (see section ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\dir", "https://www.doxygen.nl/manual/commands.html#cmddir"), (null, ") then doxygen will not generate a directory graph for that directory. The directory graph will not be generated regardless of the value of ", ""), (null, "DIRECTORY_GRAPH", "https://www.doxygen.nl/manual/config.html#cfg_directory_graph"), (null, ".\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\directorygraph", "https://www.doxygen.nl/manual/commands.html#cmddirectorygraph"), (null, ", option ", ""), (null, "DIRECTORY_GRAPH", "https://www.doxygen.nl/manual/config.html#cfg_directory_graph"), }),
-      new DoxygenHelpPageCommand("collaborationgraph",     "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdcollaborationgraph",     new (object, string, string)[]{ (null, "When this command is put in a comment block of a class then doxygen will generate a collaboration graph for that class. The collaboration graph will be generated regardless of the value of ", ""), (null, "COLLABORATION_GRAPH", "https://www.doxygen.nl/manual/config.html#cfg_collaboration_graph"), (null, ".\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\hidecollaborationgraph", "https://www.doxygen.nl/manual/commands.html#cmdhidecollaborationgraph"), (null, ", option ", ""), (null, "COLLABORATION_GRAPH", "https://www.doxygen.nl/manual/config.html#cfg_collaboration_graph"), }),
-      new DoxygenHelpPageCommand("hidecollaborationgraph", "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdhidecollaborationgraph", new (object, string, string)[]{ (null, "When this command is put in a comment block of a class then doxygen will not generate a collaboration graph for that class. The collaboration graph will not be generated regardless of the value of ", ""), (null, "COLLABORATION_GRAPH", "https://www.doxygen.nl/manual/config.html#cfg_collaboration_graph"), (null, ".\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\collaborationgraph", "https://www.doxygen.nl/manual/commands.html#cmdcollaborationgraph"), (null, ", option ", ""), (null, "COLLABORATION_GRAPH", "https://www.doxygen.nl/manual/config.html#cfg_collaboration_graph"), }),
-      new DoxygenHelpPageCommand("inheritancegraph",       "['{option}']",                                                                    "https://www.doxygen.nl/manual/commands.html#cmdinheritancegraph",       new (object, string, string)[]{ (null, "When this command is put in a comment block of a class then doxygen will generate an inheritance graph for that class conforming the ", ""), (ClassificationEnum.InlineCode, "option", ""), (null, ". The inheritance graph will be generated, conforming the ", ""), (ClassificationEnum.InlineCode, "option", ""), (null, ", regardless of the value of ", ""), (null, "CLASS_GRAPH", "https://www.doxygen.nl/manual/config.html#cfg_class_graph"), (null, ". The possible values of ", ""), (ClassificationEnum.InlineCode, "option", ""), (null, " are the same values as can be used with ", ""), (null, "CLASS_GRAPH", "https://www.doxygen.nl/manual/config.html#cfg_class_graph"), (null, ". In case no ", ""), (ClassificationEnum.InlineCode, "option", ""), (null, " is specified the value ", ""), (ClassificationEnum.InlineCode, "YES", ""), (null, " is assumed.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\hideinheritancegraph", "https://www.doxygen.nl/manual/commands.html#cmdhideinheritancegraph"), (null, ", option ", ""), (null, "CLASS_GRAPH", "https://www.doxygen.nl/manual/config.html#cfg_class_graph"), }),
-      new DoxygenHelpPageCommand("hideinheritancegraph",   "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdhideinheritancegraph",   new (object, string, string)[]{ (null, "When this command is put in a comment block of a class then doxygen will not generate an inheritance graph for that class. The inheritance graph will not be generated regardless of the value of ", ""), (null, "CLASS_GRAPH", "https://www.doxygen.nl/manual/config.html#cfg_class_graph"), (null, ".\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\inheritancegraph", "https://www.doxygen.nl/manual/commands.html#cmdinheritancegraph"), (null, ", option ", ""), (null, "CLASS_GRAPH", "https://www.doxygen.nl/manual/config.html#cfg_class_graph"), }),
-      new DoxygenHelpPageCommand("groupgraph",             "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdgroupgraph",             new (object, string, string)[]{ (null, "When this command is put in a comment block of a ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\defgroup", "https://www.doxygen.nl/manual/commands.html#cmddefgroup"), (null, " command then doxygen will generate a group dependency graph for that group. The group graph will be generated regardless of the value of ", ""), (null, "GROUP_GRAPHS", "https://www.doxygen.nl/manual/config.html#cfg_group_graphs"), (null, ".\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\hidegroupgraph", "https://www.doxygen.nl/manual/commands.html#cmdhidegroupgraph"), (null, ", option ", ""), (null, "GROUP_GRAPHS", "https://www.doxygen.nl/manual/config.html#cfg_group_graphs"), }),
-      new DoxygenHelpPageCommand("hidegroupgraph",         "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdhidegroupgraph",         new (object, string, string)[]{ (null, "When this command is put in a comment block of a ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\defgroup", "https://www.doxygen.nl/manual/commands.html#cmddefgroup"), (null, " command then doxygen will not generate a group dependency graph for that group. The group graph will not be generated regardless of the value of ", ""), (null, "GROUP_GRAPHS", "https://www.doxygen.nl/manual/config.html#cfg_group_graphs"), (null, ".\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\groupgraph", "https://www.doxygen.nl/manual/commands.html#cmdgroupgraph"), (null, ", option ", ""), (null, "GROUP_GRAPHS", "https://www.doxygen.nl/manual/config.html#cfg_group_graphs"), }),
-      new DoxygenHelpPageCommand("qualifier",              "<label> | \"(text)\"",                                                            "https://www.doxygen.nl/manual/commands.html#cmdqualifier",              new (object, string, string)[]{ (null, "With this command it is possible to add custom qualifier labels to members and classes. These labels will be shown in the output in the same way as the automatically generated labels such as \"static\", \"inline\", and \"final\".\n\nFor instance to indicate that a function is only meant for testing purposes one could add ", ""), (ClassificationEnum.InlineCode, "\\qualifier test", ""), }),
-      new DoxygenHelpPageCommand("category",               "<name> [<header-file>] [<header-name>]",                                          "https://www.doxygen.nl/manual/commands.html#cmdcategory",               new (object, string, string)[]{ (null, "For Objective-C only: Indicates that a comment block contains documentation for a class category with name <name>. The arguments are equal to the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\class", "https://www.doxygen.nl/manual/commands.html#cmdclass"), (null, " command.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\class", "https://www.doxygen.nl/manual/commands.html#cmdclass"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("class",                  "<name> [<header-file>] [<header-name>]",                                          "https://www.doxygen.nl/manual/commands.html#cmdclass",                  new (object, string, string)[]{ (null, "Indicates that a comment block contains documentation for a class with name <name>. Optionally a header file and a header name can be specified. If the header-file is specified, a link to a verbatim copy of the header will be included in the HTML documentation. The <header-name> argument can be used to overwrite the name of the link that is used in the class documentation to something other than <header-file>. This can be useful if the include name is not located on the default include path (like <X11/X.h>). With the <header-name> argument you can also specify how the include statement should look like, by adding either quotes or sharp brackets around the name. Sharp brackets are used if just the name is given. Note that the last two arguments can also be specified using the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\headerfile", "https://www.doxygen.nl/manual/commands.html#cmdheaderfile"), (null, " command.\n\nExample: ", ""), (ClassificationEnum.InlineCode, "\n   /* A dummy class */\n    \n   class Test\n   {\n   };\n    \n   /*! \\class Test class.h \"inc/class.h\"\n    *  \\brief This is a test class.\n    *\n    * Some details about the Test class.\n    */\n\n", ""), (null, "  \nClick ", ""), (null, "here", "https://www.doxygen.nl/manual/examples/class/html/class_test.html"), (null, " for the corresponding HTML documentation that is generated by doxygen.", ""), }),
-      new DoxygenHelpPageCommand("concept",                "<name>",                                                                          "https://www.doxygen.nl/manual/commands.html#cmdconcept",                new (object, string, string)[]{ (null, "Indicates that a comment block contains documentation for a C++20 concept with name <name>. See also the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\headerfile", "https://www.doxygen.nl/manual/commands.html#cmdheaderfile"), (null, " command to specify the header a user should be included to use the concept.", ""), }),
-      new DoxygenHelpPageCommand("def",                    "<name>",                                                                          "https://www.doxygen.nl/manual/commands.html#cmddef",                    new (object, string, string)[]{ (null, "Indicates that a comment block contains documentation for a ", ""), (ClassificationEnum.InlineCode, "#define", ""), (null, " macro.\n\nExample: ", ""), (ClassificationEnum.InlineCode, "\n   /*! \\file define.h\n       \\brief testing defines\n    \n       This is to test the documentation of defines.\n   */\n    \n   /*!\n     \\def MAX(x,y)\n     Computes the maximum of \\a x and \\a y.\n   */\n    \n   /*! \n      \\brief Computes the absolute value of its argument \\a x.\n      \\param x input value.\n      \\returns absolute value of \\a x.\n   */\n   #define ABS(x) (((x)>0)?(x):-(x))\n   #define MAX(x,y) ((x)>(y)?(x):(y))\n   #define MIN(x,y) ((x)>(y)?(y):(x)) \n           /*!< Computes the minimum of \\a x and \\a y. */\n\n", ""), (null, "  \nClick ", ""), (null, "here", "https://www.doxygen.nl/manual/examples/define/html/define_8h.html"), (null, " for the corresponding HTML documentation that is generated by doxygen.", ""), }),
-      new DoxygenHelpPageCommand("defgroup",               "<name> (group title)",                                                            "https://www.doxygen.nl/manual/commands.html#cmddefgroup",               new (object, string, string)[]{ (null, "Indicates that a comment block contains documentation for a ", ""), (null, "topics", "https://www.doxygen.nl/manual/grouping.html#topics"), (null, " of classes, modules, concepts, files or namespaces. This can be used to categorize symbols, and document those categories. You can also use groups as members of other groups, thus building a hierarchy of groups.\n\nThe <name> argument should be a single-word identifier.\n\nSee also: page ", ""), (null, "Grouping", "https://www.doxygen.nl/manual/grouping.html"), (null, ", commands ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\ingroup", "https://www.doxygen.nl/manual/commands.html#cmdingroup"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\addtogroup", "https://www.doxygen.nl/manual/commands.html#cmdaddtogroup"), (null, ", and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\weakgroup", "https://www.doxygen.nl/manual/commands.html#cmdweakgroup"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("dir",                    "[<path fragment>]",                                                               "https://www.doxygen.nl/manual/commands.html#cmddir",                    new (object, string, string)[]{ (null, "Indicates that a comment block contains documentation for a directory. The \"path fragment\" argument should include the directory name and enough of the path to be unique with respect to the other directories in the project. The ", ""), (null, "STRIP_FROM_PATH", "https://www.doxygen.nl/manual/config.html#cfg_strip_from_path"), (null, " option determines what is stripped from the full path before it appears in the output.", ""), }),
-      new DoxygenHelpPageCommand("enum",                   "<name>",                                                                          "https://www.doxygen.nl/manual/commands.html#cmdenum",                   new (object, string, string)[]{ (null, "Indicates that a comment block contains documentation for an enumeration, with name <name>. If the enum is a member of a class and the documentation block is located outside the class definition, the scope of the class should be specified as well. If a comment block is located directly in front of an enum declaration, the ", ""), (ClassificationEnum.InlineCode, "\\enum", ""), (null, " comment may be omitted.\n\nNote: The type of an anonymous enum cannot be documented, but the values of an anonymous enum can.\n\nExample: ", ""), (ClassificationEnum.InlineCode, "\n   class Enum_Test\n   {\n    public:\n    enum TEnum { Val1, Val2 };\n    \n       /*! Another enum, with inline docs */\n    enum AnotherEnum \n       { \n         V1, /*!< value 1 */\n         V2  /*!< value 2 */\n       };\n   };\n    \n   /*! \\class Enum_Test\n    * The class description.\n    */\n    \n   /*! \\enum Enum_Test::TEnum\n    * A description of the enum type.\n    */\n    \n   /*! \\var Enum_Test::TEnum Enum_Test::Val1\n    * The description of the first enum value.\n    */\n\n", ""), (null, "  \nClick ", ""), (null, "here", "https://www.doxygen.nl/manual/examples/enum/html/class_enum___test.html"), (null, " for the corresponding HTML documentation that is generated by doxygen.", ""), }),
-      new DoxygenHelpPageCommand("example",                "['{lineno}'] <file-name>",                                                        "https://www.doxygen.nl/manual/commands.html#cmdexample",                new (object, string, string)[]{ (null, "Indicates that a comment block contains documentation for a source code example. The name of the source file is <file-name>. The contents of this file will be included in the documentation, just after the documentation contained in the comment block. You can add option ", ""), (ClassificationEnum.InlineCode, "{lineno}", ""), (null, " to enable line numbers for the example if desired. All examples are placed in a list. The source code is scanned for documented members and classes. If any are found, the names are cross-referenced with the documentation. Source files or directories can be specified using the ", ""), (null, "EXAMPLE_PATH", "https://www.doxygen.nl/manual/config.html#cfg_example_path"), (null, " tag of doxygen's configuration file.\n\nIf <file-name> itself is not unique for the set of example files specified by the ", ""), (null, "EXAMPLE_PATH", "https://www.doxygen.nl/manual/config.html#cfg_example_path"), (null, " tag, you can include part of the absolute path to disambiguate it.\n\nIf more than one source file is needed for the example, the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\include", "https://www.doxygen.nl/manual/commands.html#cmdinclude"), (null, " command can be used.\n\nExample: ", ""), (ClassificationEnum.InlineCode, "\n   /** A Example_Test class.\n    *  More details about this class.\n    */\n    \n   class Example_Test\n   {\n    public:\n       /** An example member function.\n        *  More details about this function.\n        */\n    void example();\n   };\n    \n   void Example_Test::example() {}\n    \n   /** \\example example_test.cpp\n    * This is an example of how to use the Example_Test class.\n    * More details about this example.\n    */\n\n", ""), (null, " Where the example file ", ""), (ClassificationEnum.InlineCode, "example_test.cpp", ""), (null, " looks as follows: ", ""), (ClassificationEnum.InlineCode, "\n   void main()\n   {\n     Example_Test t;\n     t.example();\n   }\n\n", ""), (null, "  \nClick ", ""), (null, "here", "https://www.doxygen.nl/manual/examples/example/html/examples.html"), (null, " for the corresponding HTML documentation that is generated by doxygen.\n\n", ""), (null, "See also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\include", "https://www.doxygen.nl/manual/commands.html#cmdinclude"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("endinternal",            "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdendinternal",            new (object, string, string)[]{ (null, "This command ends a documentation fragment that was started with a ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\internal", "https://www.doxygen.nl/manual/commands.html#cmdinternal"), (null, " command. The text between ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\internal", "https://www.doxygen.nl/manual/commands.html#cmdinternal"), (null, " and ", ""), (ClassificationEnum.InlineCode, "\\endinternal", ""), (null, " will only be visible if ", ""), (null, "INTERNAL_DOCS", "https://www.doxygen.nl/manual/config.html#cfg_internal_docs"), (null, " is set to ", ""), (ClassificationEnum.InlineCode, "YES", ""), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("extends",                "<name>",                                                                          "https://www.doxygen.nl/manual/commands.html#cmdextends",                new (object, string, string)[]{ (null, "This command can be used to manually indicate an inheritance relation, when the programming language does not support this concept natively (e.g. C).\n\nThe file ", ""), (ClassificationEnum.InlineCode, "manual.c", ""), (null, " in the example directory shows how to use this command (see also ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\memberof", "https://www.doxygen.nl/manual/commands.html#cmdmemberof"), (null, " for the complete file).\n\n", ""), (null, "Click ", ""), (null, "here", "https://www.doxygen.nl/manual/examples/manual/html/struct_car.html"), (null, " for the corresponding HTML documentation that is generated by doxygen.\n\n", ""), (null, "See also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\implements", "https://www.doxygen.nl/manual/commands.html#cmdimplements"), (null, " and command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\memberof", "https://www.doxygen.nl/manual/commands.html#cmdmemberof"), }),
-      new DoxygenHelpPageCommand("file",                   "[<name>]",                                                                        "https://www.doxygen.nl/manual/commands.html#cmdfile",                   new (object, string, string)[]{ (null, "Indicates that a comment block contains documentation for a source or header file with name <name>. The file name may include (part of) the path if the file-name alone is not unique. If the file name is omitted (i.e. the line after ", ""), (ClassificationEnum.InlineCode, "\\file", ""), (null, " is left blank) then the documentation block that contains the ", ""), (ClassificationEnum.InlineCode, "\\file", ""), (null, " command will belong to the file it is located in.\n\nImportant: The documentation of \nglobal functions, variables, typedefs, and enums will only be included \nin the output if the file they are in is documented as well or if ", ""), (null, "EXTRACT_ALL", "https://www.doxygen.nl/manual/config.html#cfg_extract_all"), (null, " is set to ", ""), (ClassificationEnum.InlineCode, "YES", ""), (null, ".\n\nExample: ", ""), (ClassificationEnum.InlineCode, "\n   /** \\file file.h\n    * A brief file description.\n    * A more elaborated file description.\n    */\n    \n   /**\n    * A global integer value.\n    * More details about this value.\n    */\n   extern int globalValue;\n\n", ""), (null, "  \nClick ", ""), (null, "here", "https://www.doxygen.nl/manual/examples/file/html/file_8h.html"), (null, " for the corresponding HTML documentation that is generated by doxygen.\n\n", ""), (ClassificationEnum.Note, "Note:", ""), (null, " In the above example ", ""), (null, "JAVADOC_AUTOBRIEF", "https://www.doxygen.nl/manual/config.html#cfg_javadoc_autobrief"), (null, " has been set to ", ""), (ClassificationEnum.InlineCode, "YES", ""), (null, " in the configuration file.", ""), }),
-      new DoxygenHelpPageCommand("fileinfo",               "['{'option'}']",                                                                  "https://www.doxygen.nl/manual/commands.html#cmdfileinfo",               new (object, string, string)[]{ (null, "Shows (part) of the file name in which this command is placed. The ", ""), (ClassificationEnum.InlineCode, "option", ""), (null, " can be ", ""), (ClassificationEnum.InlineCode, "name", ""), (null, ", ", ""), (ClassificationEnum.InlineCode, "extension", ""), (null, ", ", ""), (ClassificationEnum.InlineCode, "filename", ""), (null, ", ", ""), (ClassificationEnum.InlineCode, "directory", ""), (null, " or, ", ""), (ClassificationEnum.InlineCode, "full", ""), (null, ", with\n    • ", ""), (ClassificationEnum.InlineCode, "name", ""), (null, " the name of the file without extension\n    • ", ""), (ClassificationEnum.InlineCode, "extension", ""), (null, " the extension of the file\n    • ", ""), (ClassificationEnum.InlineCode, "filename", ""), (null, " the filename i.e. ", ""), (ClassificationEnum.InlineCode, "name", ""), (null, " plus ", ""), (ClassificationEnum.InlineCode, "extension", ""), (null, "\n    • ", ""), (ClassificationEnum.InlineCode, "directory", ""), (null, " the directory of the given file\n    • ", ""), (ClassificationEnum.InlineCode, "full", ""), (null, " the full path and filename of the given file.\n\nIn case no option is specified the ", ""), (ClassificationEnum.InlineCode, "filename", ""), (null, " is used unless ", ""), (null, "FULL_PATH_NAMES", "https://www.doxygen.nl/manual/config.html#cfg_full_path_names"), (null, " is set to ", ""), (ClassificationEnum.InlineCode, "YES", ""), (null, " in which case ", ""), (ClassificationEnum.InlineCode, "full", ""), (null, " is used.\n\n", ""), (ClassificationEnum.Note, "Note:", ""), (null, " the command \\fileinfo cannot be used as argument to the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\file", "https://www.doxygen.nl/manual/commands.html#cmdfile"), (null, " command\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\lineinfo", "https://www.doxygen.nl/manual/commands.html#cmdlineinfo"), }),
-      new DoxygenHelpPageCommand("lineinfo",               "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdlineinfo",               new (object, string, string)[]{ (null, "Shows the line number inside the file at which this command is placed.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\fileinfo", "https://www.doxygen.nl/manual/commands.html#cmdfileinfo"), }),
-      new DoxygenHelpPageCommand("fn",                     "(function declaration)",                                                          "https://www.doxygen.nl/manual/commands.html#cmdfn",                     new (object, string, string)[]{ (null, "Indicates that a comment block contains documentation for a function (either global or as a member of a class). This command is ", ""), (ClassificationEnum.EmphasisMinor, "only", ""), (null, " needed if a comment block is ", ""), (ClassificationEnum.EmphasisMinor, "not", ""), (null, " placed in front (or behind) the function declaration or definition.\n\nIf your comment block ", ""), (ClassificationEnum.EmphasisMinor, "is", ""), (null, " in front of the function declaration or definition this command can (and to avoid redundancy should) be omitted.\n\nA full function declaration including arguments should be specified after the ", ""), (ClassificationEnum.InlineCode, "\\fn", ""), (null, " command on a ", ""), (ClassificationEnum.EmphasisMinor, "single", ""), (null, " line, since the argument ends at the end of the line!\n\nThis command is equivalent to ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\var", "https://www.doxygen.nl/manual/commands.html#cmdvar"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\typedef", "https://www.doxygen.nl/manual/commands.html#cmdtypedef"), (null, ", and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\property", "https://www.doxygen.nl/manual/commands.html#cmdproperty"), (null, ".\n\n", ""), (ClassificationEnum.Warning, "Warning:", ""), (null, " Do not use this command if it is not absolutely needed, since it will lead to duplication of information and thus to errors.\n\nExample: ", ""), (ClassificationEnum.InlineCode, "\n   class Fn_Test\n   {\n    public:\n    const char *member(char,int) throw(std::out_of_range);\n   };\n    \n   const char *Fn_Test::member(char c,int n) throw(std::out_of_range) {}\n    \n   /*! \\class Fn_Test\n    * \\brief Fn_Test class.\n    *\n    * Details about Fn_Test.\n    */\n    \n   /*! \\fn const char *Fn_Test::member(char c,int n) \n    *  \\brief A member function.\n    *  \\param c a character.\n    *  \\param n an integer.\n    *  \\exception std::out_of_range parameter is out of range.\n    *  \\return a character pointer.\n    */\n\n", ""), (null, "  \nClick ", ""), (null, "here", "https://www.doxygen.nl/manual/examples/func/html/class_fn___test.html"), (null, " for the corresponding HTML documentation that is generated by doxygen.\n\n", ""), (null, "See also: commands ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\var", "https://www.doxygen.nl/manual/commands.html#cmdvar"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\property", "https://www.doxygen.nl/manual/commands.html#cmdproperty"), (null, ", and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\typedef", "https://www.doxygen.nl/manual/commands.html#cmdtypedef"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("headerfile",             "<header-file> [<header-name>]",                                                   "https://www.doxygen.nl/manual/commands.html#cmdheaderfile",             new (object, string, string)[]{ (null, "Intended to be used for class, struct, or union documentation, where the documentation is in front of the definition. The arguments of this command are the same as the second and third argument of ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\class", "https://www.doxygen.nl/manual/commands.html#cmdclass"), (null, ". The <header-file> name refers to the file that should be included by the application to obtain the definition of the class, struct, or union. The <header-name> argument can be used to overwrite the name of the link that is used in the class documentation to something other than <header-file>. This can be useful if the include name is not located on the default include path (like <X11/X.h>).\n\nWith the <header-name> argument you can also specify how the include statement should look like, by adding either double quotes or sharp brackets around the name. By default sharp brackets are used if just the name is given.\n\nIf a pair of double quotes is given for either the <header-file> or <header-name> argument, the current file (in which the command was found) will be used but with quotes. So for a comment block with a ", ""), (ClassificationEnum.InlineCode, "\\headerfile", ""), (null, " command inside a file ", ""), (ClassificationEnum.InlineCode, "test.h", ""), (null, ", the following three commands are equivalent:\n", ""), (ClassificationEnum.InlineCode, "\n     \\headerfile test.h \"test.h\"\n     \\headerfile test.h \"\"\n     \\headerfile \"\" \n\n", ""), (null, "To get sharp brackets you do not need to specify anything, but if you want to be explicit you could use any of the following:\n", ""), (ClassificationEnum.InlineCode, "\n     \\headerfile test.h <test.h>\n     \\headerfile test.h <>\n     \\headerfile <> \n\n", ""), (null, "To globally reverse the default include representation to local includes you can set ", ""), (null, "FORCE_LOCAL_INCLUDES", "https://www.doxygen.nl/manual/config.html#cfg_force_local_includes"), (null, " to ", ""), (ClassificationEnum.InlineCode, "YES", ""), (null, ".\n\nTo disable the include information altogether set ", ""), (null, "SHOW_HEADERFILE", "https://www.doxygen.nl/manual/config.html#cfg_show_headerfile"), (null, " to ", ""), (ClassificationEnum.InlineCode, "NO", ""), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("hideinitializer",        "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdhideinitializer",        new (object, string, string)[]{ (null, "By default the value of a define and the initializer of a variable are displayed unless they are longer than 30 lines. By putting this command in a comment block of a define or variable, the initializer is always hidden. The maximum number of initialization lines can be changed by means of the configuration parameter ", ""), (null, "MAX_INITIALIZER_LINES", "https://www.doxygen.nl/manual/config.html#cfg_max_initializer_lines"), (null, ", the default value is 30.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\showinitializer", "https://www.doxygen.nl/manual/commands.html#cmdshowinitializer"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("idlexcept",              "<name>",                                                                          "https://www.doxygen.nl/manual/commands.html#cmdidlexcept",              new (object, string, string)[]{ (null, "Indicates that a comment block contains documentation for a IDL exception with name <name>.", ""), }),
-      new DoxygenHelpPageCommand("implements",             "<name>",                                                                          "https://www.doxygen.nl/manual/commands.html#cmdimplements",             new (object, string, string)[]{ (null, "This command can be used to manually indicate an inheritance relation, when the programming language does not support this concept natively (e.g. C).\n\nThe file ", ""), (ClassificationEnum.InlineCode, "manual.c", ""), (null, " in the example directory shows how to use this command (see also ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\memberof", "https://www.doxygen.nl/manual/commands.html#cmdmemberof"), (null, " for the complete file).\n\n", ""), (null, "Click ", ""), (null, "here", "https://www.doxygen.nl/manual/examples/manual/html/struct_car.html"), (null, " for the corresponding HTML documentation that is generated by doxygen.\n\n", ""), (null, "See also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\extends", "https://www.doxygen.nl/manual/commands.html#cmdextends"), (null, " and command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\memberof", "https://www.doxygen.nl/manual/commands.html#cmdmemberof"), }),
-      new DoxygenHelpPageCommand("ingroup",                "(<groupname> [<groupname>]*)",                                                    "https://www.doxygen.nl/manual/commands.html#cmdingroup",                new (object, string, string)[]{ (null, "If the ", ""), (ClassificationEnum.InlineCode, "\\ingroup", ""), (null, " command is placed in a comment block of a compound entity (like class, file or namespace), then it will be added to the group(s) identified by the ", ""), (ClassificationEnum.InlineCode, "<groupname>", ""), (null, "(s). In case of members (like variable, functions, typedefs and enums) the member will be added only to one group (to avoid ambiguous linking targets in case a member is not documented in the context of its class, namespace or file, but only visible as part of a group).\n\nSee also: page ", ""), (null, "Grouping", "https://www.doxygen.nl/manual/grouping.html"), (null, ", commands ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\defgroup", "https://www.doxygen.nl/manual/commands.html#cmddefgroup"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\addtogroup", "https://www.doxygen.nl/manual/commands.html#cmdaddtogroup"), (null, ", and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\weakgroup", "https://www.doxygen.nl/manual/commands.html#cmdweakgroup"), }),
-      new DoxygenHelpPageCommand("interface",              "<name> [<header-file>] [<header-name>]",                                          "https://www.doxygen.nl/manual/commands.html#cmdinterface",              new (object, string, string)[]{ (null, "Indicates that a comment block contains documentation for an interface with name <name>. The arguments are equal to the arguments of the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\class", "https://www.doxygen.nl/manual/commands.html#cmdclass"), (null, " command.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\class", "https://www.doxygen.nl/manual/commands.html#cmdclass"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("internal",               "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdinternal",               new (object, string, string)[]{ (null, "This command starts a documentation fragment that is meant for internal use only. The fragment naturally ends at the end of the comment block. You can also force the internal section to end earlier by using the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endinternal", "https://www.doxygen.nl/manual/commands.html#cmdendinternal"), (null, " command.\n\nIf the ", ""), (ClassificationEnum.InlineCode, "\\internal", ""), (null, " command is put inside a section (see for example ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\section", "https://www.doxygen.nl/manual/commands.html#cmdsection"), (null, ") all subsections after the command are considered to be internal as well. Only a new section at the same level will end the fragment that is considered internal.\n\nYou can use ", ""), (null, "INTERNAL_DOCS", "https://www.doxygen.nl/manual/config.html#cfg_internal_docs"), (null, " in the configuration file to show (", ""), (ClassificationEnum.InlineCode, "YES", ""), (null, ") or hide (", ""), (ClassificationEnum.InlineCode, "NO", ""), (null, ") the internal documentation.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endinternal", "https://www.doxygen.nl/manual/commands.html#cmdendinternal"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("mainpage",               "[(title)]",                                                                       "https://www.doxygen.nl/manual/commands.html#cmdmainpage",               new (object, string, string)[]{ (null, "If the ", ""), (ClassificationEnum.InlineCode, "\\mainpage", ""), (null, " command is placed in a comment block the block is used to customize the index page (in HTML) or the first chapter (in LaTeX).\n\nThe title argument is optional and replaces the default title that doxygen normally generates. If you do not want any title you can specify ", ""), (ClassificationEnum.InlineCode, "notitle", ""), (null, " as the argument of ", ""), (ClassificationEnum.InlineCode, "\\mainpage", ""), (null, ".\n\nHere is an example:\n", ""), (ClassificationEnum.InlineCode, "\n   /*! \\mainpage My Personal Index Page\n    *\n    * \\section intro_sec Introduction\n    *\n    * This is the introduction.\n    *\n    * \\section install_sec Installation\n    *\n    * \\subsection step1 Step 1: Opening the box\n    *\n    * etc...\n    */\n\n", ""), (null, "You can refer to the main page using: ", ""), (ClassificationEnum.InlineCode, "\\ref index", ""), (null, ".\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\section", "https://www.doxygen.nl/manual/commands.html#cmdsection"), (null, ", command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\subsection", "https://www.doxygen.nl/manual/commands.html#cmdsubsection"), (null, ", and command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\page", "https://www.doxygen.nl/manual/commands.html#cmdpage"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("memberof",               "<name>",                                                                          "https://www.doxygen.nl/manual/commands.html#cmdmemberof",               new (object, string, string)[]{ (null, "This command makes a function a member of a class in a similar way as ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\relates", "https://www.doxygen.nl/manual/commands.html#cmdrelates"), (null, " does, only with this command the function is represented as a real member of the class. This can be useful when the programming language does not support the concept of member functions natively (e.g. C).\n\nIt is also possible to use this command together with ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\public", "https://www.doxygen.nl/manual/commands.html#cmdpublic"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\protected", "https://www.doxygen.nl/manual/commands.html#cmdprotected"), (null, " or ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\private", "https://www.doxygen.nl/manual/commands.html#cmdprivate"), (null, ".\n\nExample: The file ", ""), (ClassificationEnum.InlineCode, "manual.c", ""), (null, " in the example directory shows how to use this command: ", ""), (ClassificationEnum.InlineCode, "\n   /**\n    * \\file manual.c\n    */\n    \n   typedef struct Object Object;   //!< Object type\n   typedef struct Vehicle Vehicle; //!< Vehicle type\n   typedef struct Car Car;         //!< Car type\n   typedef struct Truck Truck;     //!< Truck type\n    \n   /*!\n    * Base object class.\n    */\n   struct Object\n   {\n    int ref;    //!< \\private Reference count.\n   };\n    \n    \n   /*!\n    * Increments object reference count by one.\n    * \\public \\memberof Object\n    */\n   static Object * objRef(Object *obj);\n    \n    \n   /*!\n    * Decrements object reference count by one.\n    * \\public \\memberof Object\n    */\n   static Object * objUnref(Object *obj);\n    \n    \n   /*!\n    * Vehicle class.\n    * \\extends Object\n    */\n   struct Vehicle\n   {\n     Object base;    //!< \\protected Base class.\n   };\n    \n    \n   /*!\n    * Starts the vehicle.\n    * \\public \\memberof Vehicle\n    */\n   void vehicleStart(Vehicle *obj);\n    \n    \n   /*!\n    * Stops the vehicle.\n    * \\public \\memberof Vehicle\n    */\n   void vehicleStop(Vehicle *obj);\n    \n    \n   /*!\n    * Car class.\n    * \\extends Vehicle\n    */\n   struct Car\n   {\n     Vehicle base;    //!< \\protected Base class.\n   };\n    \n    \n   /*!\n    * Truck class.\n    * \\extends Vehicle\n    */\n   struct Truck\n   {\n     Vehicle base;    //!< \\protected Base class.\n   };\n    \n    \n   /*!\n    * Main function.\n    *\n    * Ref vehicleStart(), objRef(), objUnref().\n    */\n   int main(void)\n   {\n     Car c;\n     vehicleStart((Vehicle*) &c);\n   }\n    \n\n", ""), (null, "  \nClick ", ""), (null, "here", "https://www.doxygen.nl/manual/examples/manual/html/struct_car.html"), (null, " for the corresponding HTML documentation that is generated by doxygen.\n\n", ""), (null, "See also: commands ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\extends", "https://www.doxygen.nl/manual/commands.html#cmdextends"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\implements", "https://www.doxygen.nl/manual/commands.html#cmdimplements"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\public", "https://www.doxygen.nl/manual/commands.html#cmdpublic"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\protected", "https://www.doxygen.nl/manual/commands.html#cmdprotected"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\private", "https://www.doxygen.nl/manual/commands.html#cmdprivate"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("module",                 "<name>",                                                                          "https://www.doxygen.nl/manual/commands.html#cmdmodule",                 new (object, string, string)[]{ (null, "Indicates that a comment block contains documentation for a C++20 module with name <name>.", ""), }),
-      new DoxygenHelpPageCommand("name",                   "[(header)]",                                                                      "https://www.doxygen.nl/manual/commands.html#cmdname",                   new (object, string, string)[]{ (null, "This command turns a comment block into a header definition of a member group. The comment block should be followed by a ", ""), (ClassificationEnum.InlineCode, "@{", ""), (null, " ... ", ""), (ClassificationEnum.InlineCode, "@}", ""), (null, " block containing the members of the group.\n\nSee section ", ""), (null, "Member Groups", "https://www.doxygen.nl/manual/grouping.html#memgroup"), (null, " for an example.", ""), }),
-      new DoxygenHelpPageCommand("namespace",              "<name>",                                                                          "https://www.doxygen.nl/manual/commands.html#cmdnamespace",              new (object, string, string)[]{ (null, "Indicates that a comment block contains documentation for a namespace with name <name>.", ""), }),
-      new DoxygenHelpPageCommand("nosubgrouping",          "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdnosubgrouping",          new (object, string, string)[]{ (null, "This command can be put in the documentation of a class. It can be used in combination with member grouping to avoid that doxygen puts a member group as a subgroup of a Public/Protected/Private/... section.\n\nSee also: commands ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\publicsection", "https://www.doxygen.nl/manual/commands.html#cmdpublicsection"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\protectedsection", "https://www.doxygen.nl/manual/commands.html#cmdprotectedsection"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\privatesection", "https://www.doxygen.nl/manual/commands.html#cmdprivatesection"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("overload",               "[(function declaration)]",                                                        "https://www.doxygen.nl/manual/commands.html#cmdoverload",               new (object, string, string)[]{ (null, "This command can be used to generate the following standard text for an overloaded member function:\n\n", ""), (ClassificationEnum.InlineCode, "   ‍This is an overloaded member function, provided for convenience. It \n   differs from the above function only in what argument(s) it accepts. \n\n", ""), (null, "\nIf the documentation for the overloaded member function is not located in front of the function declaration or definition, the optional argument should be used to specify the correct declaration of the overloaded function. Of course when the ", ""), (ClassificationEnum.InlineCode, "\\overload", ""), (null, " command is directly in front of the overloaded member function and the optional argument is used this should also be the correct declaration of the overloaded function.\n\nAny other documentation that is inside the documentation block will by appended after the generated message.\n\nNote 1: You are responsible that \nthere is indeed an earlier documented member that is overloaded by this \none. To prevent that document reorders the documentation you should set ", ""), (null, "SORT_MEMBER_DOCS", "https://www.doxygen.nl/manual/config.html#cfg_sort_member_docs"), (null, " to ", ""), (ClassificationEnum.InlineCode, "NO", ""), (null, " in this case. \n\nNote 2: Only one ", ""), (ClassificationEnum.InlineCode, "\\overload", ""), (null, " command can be present in a comment block. \n\nExample: ", ""), (ClassificationEnum.InlineCode, "\n   class Overload_Test \n   {\n    public:\n    void drawRect(int,int,int,int);\n    void drawRect(const Rect &r);\n   };\n    \n   void Overload_Test::drawRect(int x,int y,int w,int h) {}\n   void Overload_Test::drawRect(const Rect &r) {}\n    \n   /*! \\class Overload_Test\n    *  \\brief A short description.\n    *   \n    *  More text.\n    */\n    \n   /*! \\fn void Overload_Test::drawRect(int x,int y,int w,int h)\n    * This command draws a rectangle with a left upper corner at ( \\a x , \\a y ),\n    * width \\a w and height \\a h. \n    */\n    \n   /*!\n    * \\overload void Overload_Test::drawRect(const Rect &r)\n    */\n    \n\n", ""), (null, "  \nClick ", ""), (null, "here", "https://www.doxygen.nl/manual/examples/overload/html/class_overload___test.html"), (null, " for the corresponding HTML documentation that is generated by doxygen.", ""), }),
-      new DoxygenHelpPageCommand("package",                "<name>",                                                                          "https://www.doxygen.nl/manual/commands.html#cmdpackage",                new (object, string, string)[]{ (null, "Indicates that a comment block contains documentation for a Java package with name <name>.", ""), }),
-      new DoxygenHelpPageCommand("page",                   "<name> (title)",                                                                  "https://www.doxygen.nl/manual/commands.html#cmdpage",                   new (object, string, string)[]{ (null, "Indicates that a comment block contains a piece of documentation that is not directly related to one specific class, file or member. The HTML generator creates a page containing the documentation. The LaTeX generator starts a new section in the chapter 'Page documentation'.\n\nExample: ", ""), (ClassificationEnum.InlineCode, "\n   /*! \\page page1 A documentation page\n     \\tableofcontents\n     Leading text.\n     \\section sec An example section\n     This page contains the subsections \\ref subsection1 and \\ref subsection2.\n     For more info see page \\ref page2.\n     \\subsection subsection1 The first subsection\n     Text.\n     \\subsection subsection2 The second subsection\n     More text.\n   */\n    \n   /*! \\page page2 Another page\n     Even more info.\n   */\n\n", ""), (null, "  \nClick ", ""), (null, "here", "https://www.doxygen.nl/manual/examples/page/html/page1.html"), (null, " for the corresponding HTML documentation that is generated by doxygen.\n\n", ""), (null, "Note: The <name> argument consists of a combination of letters and number digits. If you wish to use upper case letters (e.g. ", ""), (ClassificationEnum.InlineCode, "MYPAGE1", ""), (null, "), or mixed case letters (e.g. ", ""), (ClassificationEnum.InlineCode, "MyPage1", ""), (null, ") in the <name> argument, you should set ", ""), (null, "CASE_SENSE_NAMES", "https://www.doxygen.nl/manual/config.html#cfg_case_sense_names"), (null, " to ", ""), (ClassificationEnum.InlineCode, "YES", ""), (null, ".\n However, this is advisable only if your file system is case sensitive. \nOtherwise (and for better portability) you should use all lower case \nletters (e.g. ", ""), (ClassificationEnum.InlineCode, "mypage1", ""), (null, ") for <name> in all references to the page.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\section", "https://www.doxygen.nl/manual/commands.html#cmdsection"), (null, ", command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\subsection", "https://www.doxygen.nl/manual/commands.html#cmdsubsection"), (null, ", and command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\ref", "https://www.doxygen.nl/manual/commands.html#cmdref"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("private",                "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdprivate",                new (object, string, string)[]{ (null, "Indicates that the member documented by the comment block is private, i.e., should only be accessed by other members in the same class.\n\nNote that doxygen automatically detects the protection level of members in object-oriented languages. This command is intended for use only when the language does not support the concept of protection level natively (e.g. C, PHP 4).\n\nFor starting a section of private members, in a way similar to the \"private:\" class marker in C++, use ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\privatesection", "https://www.doxygen.nl/manual/commands.html#cmdprivatesection"), (null, ".\n\nSee also: commands ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\memberof", "https://www.doxygen.nl/manual/commands.html#cmdmemberof"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\public", "https://www.doxygen.nl/manual/commands.html#cmdpublic"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\protected", "https://www.doxygen.nl/manual/commands.html#cmdprotected"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\privatesection", "https://www.doxygen.nl/manual/commands.html#cmdprivatesection"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("privatesection",         "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdprivatesection",         new (object, string, string)[]{ (null, "Starting a section of private members, in a way similar to the \"private:\" class marker in C++. Indicates that the member documented by the comment block is private, i.e., should only be accessed by other members in the same class.\n\nSee also: commands ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\memberof", "https://www.doxygen.nl/manual/commands.html#cmdmemberof"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\public", "https://www.doxygen.nl/manual/commands.html#cmdpublic"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\protected", "https://www.doxygen.nl/manual/commands.html#cmdprotected"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\private", "https://www.doxygen.nl/manual/commands.html#cmdprivate"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("property",               "(qualified property name)",                                                       "https://www.doxygen.nl/manual/commands.html#cmdproperty",               new (object, string, string)[]{ (null, "Indicates that a comment block contains documentation for a property (either global or as a member of a class). This command is equivalent to ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\fn", "https://www.doxygen.nl/manual/commands.html#cmdfn"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\typedef", "https://www.doxygen.nl/manual/commands.html#cmdtypedef"), (null, ", and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\var", "https://www.doxygen.nl/manual/commands.html#cmdvar"), (null, ".\n\nSee also: commands ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\fn", "https://www.doxygen.nl/manual/commands.html#cmdfn"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\typedef", "https://www.doxygen.nl/manual/commands.html#cmdtypedef"), (null, ", and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\var", "https://www.doxygen.nl/manual/commands.html#cmdvar"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("protected",              "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdprotected",              new (object, string, string)[]{ (null, "Indicates that the member documented by the comment block is protected, i.e., should only be accessed by other members in the same or derived classes.\n\nNote that doxygen automatically detects the protection level of members in object-oriented languages. This command is intended for use only when the language does not support the concept of protection level natively (e.g. C, PHP 4).\n\nFor starting a section of protected members, in a way similar to the \"protected:\" class marker in C++, use ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\protectedsection", "https://www.doxygen.nl/manual/commands.html#cmdprotectedsection"), (null, ".\n\nSee also: commands ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\memberof", "https://www.doxygen.nl/manual/commands.html#cmdmemberof"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\public", "https://www.doxygen.nl/manual/commands.html#cmdpublic"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\private", "https://www.doxygen.nl/manual/commands.html#cmdprivate"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\protectedsection", "https://www.doxygen.nl/manual/commands.html#cmdprotectedsection"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("protectedsection",       "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdprotectedsection",       new (object, string, string)[]{ (null, "Starting a section of protected members, in a way similar to the \"protected:\" class marker in C++. Indicates that the member documented by the comment block is protected, i.e., should only be accessed by other members in the same or derived classes.\n\nSee also: commands ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\memberof", "https://www.doxygen.nl/manual/commands.html#cmdmemberof"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\public", "https://www.doxygen.nl/manual/commands.html#cmdpublic"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\private", "https://www.doxygen.nl/manual/commands.html#cmdprivate"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\protected", "https://www.doxygen.nl/manual/commands.html#cmdprotected"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("protocol",               "<name> [<header-file>] [<header-name>]",                                          "https://www.doxygen.nl/manual/commands.html#cmdprotocol",               new (object, string, string)[]{ (null, "Indicates that a comment block contains documentation for a protocol in Objective-C with name <name>. The arguments are equal to the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\class", "https://www.doxygen.nl/manual/commands.html#cmdclass"), (null, " command.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\class", "https://www.doxygen.nl/manual/commands.html#cmdclass"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("public",                 "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdpublic",                 new (object, string, string)[]{ (null, "Indicates that the member documented by the comment block is public, i.e., can be accessed by any other class or function.\n\nNote that doxygen automatically detects the protection level of members in object-oriented languages. This command is intended for use only when the language does not support the concept of protection level natively (e.g. C, PHP 4).\n\nFor starting a section of public members, in a way similar to the \"public:\" class marker in C++, use ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\publicsection", "https://www.doxygen.nl/manual/commands.html#cmdpublicsection"), (null, ".\n\nSee also: commands ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\memberof", "https://www.doxygen.nl/manual/commands.html#cmdmemberof"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\protected", "https://www.doxygen.nl/manual/commands.html#cmdprotected"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\private", "https://www.doxygen.nl/manual/commands.html#cmdprivate"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\publicsection", "https://www.doxygen.nl/manual/commands.html#cmdpublicsection"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("publicsection",          "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdpublicsection",          new (object, string, string)[]{ (null, "Starting a section of public members, in a way similar to the \"public:\" class marker in C++. Indicates that the member documented by the comment block is public, i.e., can be accessed by any other class or function.\n\nSee also: commands ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\memberof", "https://www.doxygen.nl/manual/commands.html#cmdmemberof"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\protected", "https://www.doxygen.nl/manual/commands.html#cmdprotected"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\private", "https://www.doxygen.nl/manual/commands.html#cmdprivate"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\public", "https://www.doxygen.nl/manual/commands.html#cmdpublic"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("pure",                   "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdpure",                   new (object, string, string)[]{ (null, "Indicates that the member documented by the comment block is pure virtual, i.e., it is abstract and has no implementation associated with it.\n\nThis command is intended for use only when the language does not support the concept of pure virtual methods natively (e.g. C, PHP 4).", ""), }),
-      new DoxygenHelpPageCommand("relates",                "<name>",                                                                          "https://www.doxygen.nl/manual/commands.html#cmdrelates",                new (object, string, string)[]{ (null, "This command can be used in the documentation of a non-member function <name>. It puts the function inside the 'related function' section of the class documentation. This command is useful for documenting non-friend functions that are nevertheless strongly coupled to a certain class. It prevents the need of having to document a file, but only works for functions.\n\nExample: ", ""), (ClassificationEnum.InlineCode, "\n   /*! \n    * A String class.\n    */ \n    \n   class String\n   {\n    friend int strcmp(const String &,const String &);\n   };\n    \n   /*! \n    * Compares two strings.\n    */\n    \n   int strcmp(const String &s1,const String &s2)\n   {\n   }\n    \n   /*! \\relates String\n    * A string debug function.\n    */\n   void stringDebug()\n   {\n   }\n\n", ""), (null, "  \nClick ", ""), (null, "here", "https://www.doxygen.nl/manual/examples/relates/html/class_string.html"), (null, " for the corresponding HTML documentation that is generated by doxygen.", ""), }),
-      new DoxygenHelpPageCommand("related",                "<name>",                                                                          "https://www.doxygen.nl/manual/commands.html#cmdrelated",                new (object, string, string)[]{ (null, "Equivalent to ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\relates", "https://www.doxygen.nl/manual/commands.html#cmdrelates"), }),
-      new DoxygenHelpPageCommand("relatesalso",            "<name>",                                                                          "https://www.doxygen.nl/manual/commands.html#cmdrelatesalso",            new (object, string, string)[]{ (null, "This command can be used in the documentation of a non-member function <name>. It puts the function both inside the 'related function' section of the class documentation as well as leaving it at its normal file documentation location. This command is useful for documenting non-friend functions that are nevertheless strongly coupled to a certain class. It only works for functions.", ""), }),
-      new DoxygenHelpPageCommand("relatedalso",            "<name>",                                                                          "https://www.doxygen.nl/manual/commands.html#cmdrelatedalso",            new (object, string, string)[]{ (null, "Equivalent to ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\relatesalso", "https://www.doxygen.nl/manual/commands.html#cmdrelatesalso"), }),
-      new DoxygenHelpPageCommand("showinitializer",        "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdshowinitializer",        new (object, string, string)[]{ (null, "By default the value of a define and the initializer of a variable are only displayed if they are less than 30 lines long. By putting this command in a comment block of a define or variable, the initializer is shown unconditionally. The maximum number of initialization lines can be changed by means of the configuration parameter ", ""), (null, "MAX_INITIALIZER_LINES", "https://www.doxygen.nl/manual/config.html#cfg_max_initializer_lines"), (null, ", the default value is 30.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\hideinitializer", "https://www.doxygen.nl/manual/commands.html#cmdhideinitializer"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("static",                 "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdstatic",                 new (object, string, string)[]{ (null, "Indicates that the member documented by the comment block is static, i.e., it works on a class, instead of on an instance of the class.\n\nThis command is intended for use only when the language does not support the concept of static methods natively (e.g. C).", ""), }),
-      new DoxygenHelpPageCommand("struct",                 "<name> [<header-file>] [<header-name>]",                                          "https://www.doxygen.nl/manual/commands.html#cmdstruct",                 new (object, string, string)[]{ (null, "Indicates that a comment block contains documentation for a struct with name <name>. The arguments are equal to the arguments of the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\class", "https://www.doxygen.nl/manual/commands.html#cmdclass"), (null, " command.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\class", "https://www.doxygen.nl/manual/commands.html#cmdclass"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("typedef",                "(typedef declaration)",                                                           "https://www.doxygen.nl/manual/commands.html#cmdtypedef",                new (object, string, string)[]{ (null, "Indicates that a comment block contains documentation for a typedef (either global or as a member of a class). This command is equivalent to ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\fn", "https://www.doxygen.nl/manual/commands.html#cmdfn"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\property", "https://www.doxygen.nl/manual/commands.html#cmdproperty"), (null, ", and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\var", "https://www.doxygen.nl/manual/commands.html#cmdvar"), (null, ".\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\fn", "https://www.doxygen.nl/manual/commands.html#cmdfn"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\property", "https://www.doxygen.nl/manual/commands.html#cmdproperty"), (null, ", and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\var", "https://www.doxygen.nl/manual/commands.html#cmdvar"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("union",                  "<name> [<header-file>] [<header-name>]",                                          "https://www.doxygen.nl/manual/commands.html#cmdunion",                  new (object, string, string)[]{ (null, "Indicates that a comment block contains documentation for a union with name <name>. The arguments are equal to the arguments of the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\class", "https://www.doxygen.nl/manual/commands.html#cmdclass"), (null, " command.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\class", "https://www.doxygen.nl/manual/commands.html#cmdclass"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("var",                    "(variable declaration)",                                                          "https://www.doxygen.nl/manual/commands.html#cmdvar",                    new (object, string, string)[]{ (null, "Indicates that a comment block contains documentation for a variable or enum value (either global or as a member of a class). This command is equivalent to ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\fn", "https://www.doxygen.nl/manual/commands.html#cmdfn"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\property", "https://www.doxygen.nl/manual/commands.html#cmdproperty"), (null, ", and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\typedef", "https://www.doxygen.nl/manual/commands.html#cmdtypedef"), (null, ".\n\nNote that for PHP one can also specify the type of the variable. The syntax is similar as for the ", ""), (ClassificationEnum.InlineCode, "phpDocumentor", ""), (null, " but the description has to start at the next line, i.e.\n", ""), (ClassificationEnum.InlineCode, "\n   @var  datatype $varname\n   Description\n\n", ""), (null, "See also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\fn", "https://www.doxygen.nl/manual/commands.html#cmdfn"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\property", "https://www.doxygen.nl/manual/commands.html#cmdproperty"), (null, ", and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\typedef", "https://www.doxygen.nl/manual/commands.html#cmdtypedef"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("vhdlflow",               "[(title for the flow chart)]",                                                    "https://www.doxygen.nl/manual/commands.html#cmdvhdlflow",               new (object, string, string)[]{ (null, "This is a VHDL specific command, which can be put in the documentation of a process to produce a flow chart of the logic in the process. Optionally a title for the flow chart can be given.\n\n", ""), (ClassificationEnum.Note, "Note:", ""), (null, " Currently the flow chart will only appear in the HTML output.", ""), }),
-      new DoxygenHelpPageCommand("weakgroup",              "<name> [(title)]",                                                                "https://www.doxygen.nl/manual/commands.html#cmdweakgroup",              new (object, string, string)[]{ (null, "Can be used exactly like ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\addtogroup", "https://www.doxygen.nl/manual/commands.html#cmdaddtogroup"), (null, ", but has a lower priority when it comes to resolving conflicting grouping definitions.\n\nSee also: page ", ""), (null, "Grouping", "https://www.doxygen.nl/manual/grouping.html"), (null, " and command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\addtogroup", "https://www.doxygen.nl/manual/commands.html#cmdaddtogroup"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("attention",              "{ attention text }",                                                              "https://www.doxygen.nl/manual/commands.html#cmdattention",              new (object, string, string)[]{ (null, "Starts a paragraph where a message that needs attention may be entered. The paragraph will be indented. The text of the paragraph has no special internal structure. All visual enhancement commands may be used inside the paragraph. Multiple adjacent ", ""), (ClassificationEnum.InlineCode, "\\attention", ""), (null, " commands will be joined into a single paragraph. The ", ""), (ClassificationEnum.InlineCode, "\\attention", ""), (null, " command ends when a blank line or some other sectioning command is encountered.", ""), }),
-      new DoxygenHelpPageCommand("author",                 "{ list of authors }",                                                             "https://www.doxygen.nl/manual/commands.html#cmdauthor",                 new (object, string, string)[]{ (null, "Starts a paragraph where one or more author names may be entered. The paragraph will be indented. The text of the paragraph has no special internal structure. All visual enhancement commands may be used inside the paragraph. Multiple adjacent ", ""), (ClassificationEnum.InlineCode, "\\author", ""), (null, " commands will be joined into a single paragraph. Each author description will start a new line. Alternatively, one ", ""), (ClassificationEnum.InlineCode, "\\author", ""), (null, " command may mention several authors. The ", ""), (ClassificationEnum.InlineCode, "\\author", ""), (null, " command ends when a blank line or some other sectioning command is encountered.\n\nExample: ", ""), (ClassificationEnum.InlineCode, "\n   /*! \n    *  \\brief     Pretty nice class.\n    *  \\details   This class is used to demonstrate a number of section commands.\n    *  \\author    John Doe\n    *  \\author    Jan Doe\n    *  \\version   4.1a\n    *  \\date      1990-2011\n    *  \\pre       First initialize the system.\n    *  \\bug       Not all memory is freed when deleting an object of this class.\n    *  \\warning   Improper use can crash your application\n    *  \\copyright GNU Public License.\n    */\n   class SomeNiceClass {};\n\n", ""), (null, "  \nClick ", ""), (null, "here", "https://www.doxygen.nl/manual/examples/author/html/class_some_nice_class.html"), (null, " for the corresponding HTML documentation that is generated by doxygen.", ""), }),
-      new DoxygenHelpPageCommand("authors",                "{ list of authors }",                                                             "https://www.doxygen.nl/manual/commands.html#cmdauthors",                new (object, string, string)[]{ (null, "Equivalent to ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\author", "https://www.doxygen.nl/manual/commands.html#cmdauthor"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("brief",                  "{ brief description }",                                                           "https://www.doxygen.nl/manual/commands.html#cmdbrief",                  new (object, string, string)[]{ (null, "Starts a paragraph that serves as a brief description. For classes and files the brief description will be used in lists and at the start of the documentation page. For class and file members, the brief description will be placed at the declaration of the member and prepended to the detailed description. A brief description may span several lines (although it is advised to keep it brief!). A brief description ends when a blank line or another sectioning command is encountered. If multiple ", ""), (ClassificationEnum.InlineCode, "\\brief", ""), (null, " commands are present they will be joined. See section ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\author", "https://www.doxygen.nl/manual/commands.html#cmdauthor"), (null, " for an example.\n\nSynonymous to ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\short", "https://www.doxygen.nl/manual/commands.html#cmdshort"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("bug",                    "{ bug description }",                                                             "https://www.doxygen.nl/manual/commands.html#cmdbug",                    new (object, string, string)[]{ (null, "Starts a paragraph where one or more bugs may be reported. The paragraph will be indented. The text of the paragraph has no special internal structure. All visual enhancement commands may be used inside the paragraph. Multiple adjacent ", ""), (ClassificationEnum.InlineCode, "\\bug", ""), (null, " commands will be joined into a single paragraph. Each bug description will start on a new line. Alternatively, one ", ""), (ClassificationEnum.InlineCode, "\\bug", ""), (null, " command may mention several bugs. The ", ""), (ClassificationEnum.InlineCode, "\\bug", ""), (null, " command ends when a blank line or some other sectioning command is encountered. See section ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\author", "https://www.doxygen.nl/manual/commands.html#cmdauthor"), (null, " for an example.\n\nThe description will also add an item to a separate Bug list and the two instances of the description will be cross-referenced. Each item in the Bug list will be preceded by a header that indicates the origin of the item.\n\nThe Bug list and the corresponding entries can be disabled by setting the ", ""), (null, "GENERATE_BUGLIST", "https://www.doxygen.nl/manual/config.html#cfg_generate_buglist"), (null, " to ", ""), (ClassificationEnum.InlineCode, "NO", ""), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("cond",                   "[(section-label)]",                                                               "https://www.doxygen.nl/manual/commands.html#cmdcond",                   new (object, string, string)[]{ (null, "Starts a conditional section that ends with a corresponding ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endcond", "https://www.doxygen.nl/manual/commands.html#cmdendcond"), (null, " command, which is typically found in another comment block. The main purpose of this pair of commands is to (conditionally) exclude part of a file from processing (in older version of doxygen this could only be achieved using C preprocessor commands).\n\nThe section between ", ""), (ClassificationEnum.InlineCode, "\\cond", ""), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endcond", "https://www.doxygen.nl/manual/commands.html#cmdendcond"), (null, " can be included by adding its section label to the ", ""), (null, "ENABLED_SECTIONS", "https://www.doxygen.nl/manual/config.html#cfg_enabled_sections"), (null, " configuration option. If the section label is omitted, the section will be excluded from processing unconditionally. The section label can be a logical expression build of section labels, round brackets, && (AND), || (OR) and ! (NOT). If you use an expression you need to wrap it in round brackets, i.e ", ""), (ClassificationEnum.InlineCode, "\\cond (!LABEL1 && LABEL2)", ""), (null, ".\n\nFor conditional sections within a comment block one should use a ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\if", "https://www.doxygen.nl/manual/commands.html#cmdif"), (null, " ... ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endif", "https://www.doxygen.nl/manual/commands.html#cmdendif"), (null, " block. When using ", ""), (ClassificationEnum.InlineCode, "\\cond", ""), (null, " and the condition is not satisfied the current comment block is ended and everything until the matching ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endcond", "https://www.doxygen.nl/manual/commands.html#cmdendcond"), (null, " is removed and a new command block is started there.\n\nConditional sections can be nested. In this case a nested section will only be shown if it and its containing section are included.\n\nHere is an example showing the commands in action:\n\n", ""), (ClassificationEnum.InlineCode, "   /** An interface */\n   class Intf\n   {\n     public:\n       /** A method */\n       virtual void func() = 0;\n   \n       /// @cond TEST\n   \n       /** A method used for testing */\n       virtual void test() = 0;\n   \n       /// @endcond\n   };\n   \n   /// @cond DEV\n   /*\n    *  The implementation of the interface\n    */\n   class Implementation : public Intf\n   {\n     public:\n       void func();\n   \n       /// @cond TEST\n       void test();\n       /// @endcond\n   \n       /// @cond\n       /** This method is obsolete and does\n        *  not show up in the documentation.\n        */\n       void obsolete();\n       /// @endcond\n   };\n   \n   /// @endcond\n\n", ""), (null, "The output will be different depending on whether or not ", ""), (null, "ENABLED_SECTIONS", "https://www.doxygen.nl/manual/config.html#cfg_enabled_sections"), (null, " contains ", ""), (ClassificationEnum.InlineCode, "TEST", ""), (null, ", or ", ""), (ClassificationEnum.InlineCode, "DEV", ""), (null, "\n\nSee also: commands ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\if", "https://www.doxygen.nl/manual/commands.html#cmdif"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\ifnot", "https://www.doxygen.nl/manual/commands.html#cmdifnot"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\else", "https://www.doxygen.nl/manual/commands.html#cmdelse"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\elseif", "https://www.doxygen.nl/manual/commands.html#cmdelseif"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endif", "https://www.doxygen.nl/manual/commands.html#cmdendif"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endcond", "https://www.doxygen.nl/manual/commands.html#cmdendcond"), (null, ", and ", ""), (null, "ENABLED_SECTIONS", "https://www.doxygen.nl/manual/config.html#cfg_enabled_sections"), (null, ".\n\n", ""), (ClassificationEnum.Note, "Note:", ""), (null, " Due to the moment of parsing the ", ""), (ClassificationEnum.InlineCode, "\\cond", ""), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endcond", "https://www.doxygen.nl/manual/commands.html#cmdendcond"), (null, " commands cannot be used in ", ""), (null, "ALIASES", "https://www.doxygen.nl/manual/config.html#cfg_aliases"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("copyright",              "{ copyright description }",                                                       "https://www.doxygen.nl/manual/commands.html#cmdcopyright",              new (object, string, string)[]{ (null, "Starts a paragraph where the copyright of an entity can be described. This paragraph will be indented. The text of the paragraph has no special internal structure. See section ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\author", "https://www.doxygen.nl/manual/commands.html#cmdauthor"), (null, " for an example.", ""), }),
-      new DoxygenHelpPageCommand("date",                   "{ date description }",                                                            "https://www.doxygen.nl/manual/commands.html#cmddate",                   new (object, string, string)[]{ (null, "Starts a paragraph where one or more dates may be entered. The paragraph will be indented. The text of the paragraph has no special internal structure. All visual enhancement commands may be used inside the paragraph. Multiple adjacent ", ""), (ClassificationEnum.InlineCode, "\\date", ""), (null, " commands will be joined into a single paragraph. Each date description will start on a new line. Alternatively, one ", ""), (ClassificationEnum.InlineCode, "\\date", ""), (null, " command may mention several dates. The ", ""), (ClassificationEnum.InlineCode, "\\date", ""), (null, " command ends when a blank line or some other sectioning command is encountered. See section ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\author", "https://www.doxygen.nl/manual/commands.html#cmdauthor"), (null, " for an example.", ""), }),
-      new DoxygenHelpPageCommand("showdate",               "\"<format>\" [ <date_time> ]",                                                    "https://www.doxygen.nl/manual/commands.html#cmdshowdate",               new (object, string, string)[]{ (null, "Shows the date and time based on the given <format> and <date_time>. Where the <format> is a string in which the following tokens have a special meaning:\n    Code  Description                                              \n    ----  ---------------------------------------------------------\n    %y    Year without century as a zero-padded decimal number.    \n    %Y    Year with century as a decimal number.                   \n    %m    Month as a zero-padded decimal number.                   \n    %-m   The month as a decimal number.                           \n    %b    Month as locale’s abbreviated name.                      \n    %B    Month as locale’s full name.                             \n    %d    Day of the month as a zero-padded decimal number.        \n    %-d   Day of the month as a decimal number.                    \n    %u    The weekday as a decimal number (1-7), where Monday is 1.\n    %w    The weekday as a decimal number (0-6), where Sunday is 0.\n    %a    Weekday as locale’s abbreviated name.                    \n    %A    Weekday as locale’s full name.                           \n                                                                   \n    %H    Hour (24-hour clock) as a zero-padded decimal number.    \n    %-H   Hour (24-hour clock) as a decimal number.                \n    %I    Hour (12-hour clock) as a zero-padded decimal number.    \n    %-I   Hour (12-hour clock) as a decimal number.                \n    %M    Minute as a zero-padded decimal number.                  \n    %-M   Minute as a decimal number.                              \n    %S    Second as a zero-padded decimal number.                  \n    %-S   Second as a decimal number.                              \n    %p    Locale’s equivalent of either AM or PM.                  \n                                                                   \n    %%    A % character.                                           \n\nNote that the <format> has to be between double quotes.\n\nIn case the <date_time> is specified it has to have the following representation:\n    • optional ", ""), (ClassificationEnum.InlineCode, "date", ""), (null, " where ", ""), (ClassificationEnum.InlineCode, "date", ""), (null, " is:\n        • 4 digits for the year\n        • a minus sign\n        • one or 2 digits for the month\n        • a minus sign\n        • one or 2 digits for the day\n    • optional ", ""), (ClassificationEnum.InlineCode, "time", ""), (null, " where ", ""), (ClassificationEnum.InlineCode, "time", ""), (null, " is:\n        • whitespace\n        • one or 2 digits for the hours\n        • a colon sign\n        • one or 2 digits for the minutes\n        • when the format contains %S or %-S\n            • a colon sign\n            • 2 digits for the seconds\n\nin case the <date_time> is not specified the current date and time are used.\n\nHere is an example:\n", ""), (ClassificationEnum.InlineCode, "\n   - \\showdate \"%A %d-%m-%Y\" 2015-3-14\n   - \\showdate \"%a %d-%m-%y\" 2015-3-14\n   - \\showdate \"%-m.%d%y\" 2015-3-14\n   - \\showdate \"%A %d-%m-%Y %H:%M:%S\" 2015-3-14 03:04:15\n   - \\showdate \"%A %d-%m-%Y %H:%M\" 2015-3-14 03:04\n\n", ""), (null, "In case ", ""), (ClassificationEnum.InlineCode, "OUTPUT_LANGUAGE=english", ""), (null, " this results in:\n    • Saturday 14-03-2015\n    • Sat 14-03-15\n    • 3.1415\n    • Saturday 14-03-15 03:04:15\n    • Saturday 14-03-15 03:04\n\nIn case ", ""), (ClassificationEnum.InlineCode, "OUTPUT_LANGUAGE=dutch", ""), (null, " this results in:\n    • zaterdag 14-03-15\n    • za 14-03-2015\n    • 3.1415\n    • zaterdag 14-03-15 03:04:15\n    • zaterdag 14-03-15 03:04", ""), }),
-      new DoxygenHelpPageCommand("deprecated",             "{ description }",                                                                 "https://www.doxygen.nl/manual/commands.html#cmddeprecated",             new (object, string, string)[]{ (null, "Starts a paragraph indicating that this documentation block belongs to a deprecated entity. Can be used to describe alternatives, expected life span, etc. The paragraph will be indented. The text of the paragraph has no special internal structure. All visual enhancement commands may be used inside the paragraph. Multiple adjacent ", ""), (ClassificationEnum.InlineCode, "\\deprecated", ""), (null, " commands will be joined into a single paragraph. Each deprecation description will start on a new line. The ", ""), (ClassificationEnum.InlineCode, "\\deprecated", ""), (null, " command ends when a blank line or some other sectioning command is encountered.\n\nThe description will also add an item to a separate Deprecated list and the two instances of the description will be cross-referenced. Each item in the Deprecated list will be preceded by a header that indicates the origin of the item.\n\nThe Deprecated list and the corresponding entries can be disabled by setting the ", ""), (null, "GENERATE_DEPRECATEDLIST", "https://www.doxygen.nl/manual/config.html#cfg_generate_deprecatedlist"), (null, " to ", ""), (ClassificationEnum.InlineCode, "NO", ""), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("details",                "{ detailed description }",                                                        "https://www.doxygen.nl/manual/commands.html#cmddetails",                new (object, string, string)[]{ (null, "Just like ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\brief", "https://www.doxygen.nl/manual/commands.html#cmdbrief"), (null, " starts a brief description, ", ""), (ClassificationEnum.InlineCode, "\\details", ""), (null, " starts the detailed description. You can also start a new paragraph (blank line) then the ", ""), (ClassificationEnum.InlineCode, "\\details", ""), (null, " command is not needed.", ""), }),
-      new DoxygenHelpPageCommand("noop",                   "( text to be ignored )",                                                          "https://www.doxygen.nl/manual/commands.html#cmdnoop",                   new (object, string, string)[]{ (null, "All the text, including the command, till the end of the line is ignored. The command will most commonly be used in combination with ", ""), (null, "ALIASES", "https://www.doxygen.nl/manual/config.html#cfg_aliases"), (null, " to ignore not supported commands that are present for e.g. other processing tools.", ""), }),
-      new DoxygenHelpPageCommand("raisewarning",           "( text to be shown as warning )",                                                 "https://www.doxygen.nl/manual/commands.html#cmdraisewarning",           new (object, string, string)[]{ (null, "All the text, excluding the command, till the end of the line is literally shown as a documentation warning. The text, including the command, is removed from the output. The command will most commonly be used in combination with ", ""), (null, "ALIASES", "https://www.doxygen.nl/manual/config.html#cfg_aliases"), (null, " to show a specific warning.\nExample: ", ""), (ClassificationEnum.InlineCode, "\n   \\raisewarning My specific warning\n   \n   \\warnNoDoc\n   \n   \\warnNoDoc{My specific warning}\n\n", ""), (null, " together with: ", ""), (ClassificationEnum.InlineCode, "\n   ALIASES  = warnNoDoc=\"\\raisewarning Missing documentation\"\n   ALIASES += warnNoDoc{1}=\"\\raisewarning Incomplete documentation: \\1\"\n\n", ""), (null, " will result in: ", ""), (ClassificationEnum.InlineCode, "\n      ex_1.md:1: warning: My specific warning\n      ex_1.md:3: warning: Missing documentation\n      ex_1.md:5: warning: Incomplete documentation: My specific warning", ""), }),
-      new DoxygenHelpPageCommand("else",                   "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdelse",                   new (object, string, string)[]{ (null, "Starts a conditional section if the previous conditional section was not enabled. The previous section should have been started with a ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\if", "https://www.doxygen.nl/manual/commands.html#cmdif"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\ifnot", "https://www.doxygen.nl/manual/commands.html#cmdifnot"), (null, ", or ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\elseif", "https://www.doxygen.nl/manual/commands.html#cmdelseif"), (null, " command.\n\nSee also: commands ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\if", "https://www.doxygen.nl/manual/commands.html#cmdif"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\ifnot", "https://www.doxygen.nl/manual/commands.html#cmdifnot"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\elseif", "https://www.doxygen.nl/manual/commands.html#cmdelseif"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endif.", "https://www.doxygen.nl/manual/commands.html#cmdendif"), }),
-      new DoxygenHelpPageCommand("elseif",                 "(section-label)",                                                                 "https://www.doxygen.nl/manual/commands.html#cmdelseif",                 new (object, string, string)[]{ (null, "Starts a conditional documentation section if the previous section was not enabled. A conditional section is disabled by default. To enable it you must put the section-label after the ", ""), (null, "ENABLED_SECTIONS", "https://www.doxygen.nl/manual/config.html#cfg_enabled_sections"), (null, " tag in the configuration file. The section label can be a logical expression build of section names, round brackets, && (AND), || (OR) and ! (NOT). Conditional blocks can be nested. A nested section is only enabled if all enclosing sections are enabled as well.\n\nSee also: commands ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\if", "https://www.doxygen.nl/manual/commands.html#cmdif"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\ifnot", "https://www.doxygen.nl/manual/commands.html#cmdifnot"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\else", "https://www.doxygen.nl/manual/commands.html#cmdelse"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endif.", "https://www.doxygen.nl/manual/commands.html#cmdendif"), }),
-      new DoxygenHelpPageCommand("endcond",                "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdendcond",                new (object, string, string)[]{ (null, "Ends a conditional section that was started by ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\cond", "https://www.doxygen.nl/manual/commands.html#cmdcond"), (null, ".\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\cond", "https://www.doxygen.nl/manual/commands.html#cmdcond"), (null, ".\n\n", ""), (ClassificationEnum.Note, "Note:", ""), (null, " Due to the moment of parsing the ", ""), (ClassificationEnum.InlineCode, "\\endcond", ""), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\cond", "https://www.doxygen.nl/manual/commands.html#cmdcond"), (null, " commands cannot be used in ", ""), (null, "ALIASES", "https://www.doxygen.nl/manual/config.html#cfg_aliases"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("endif",                  "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdendif",                  new (object, string, string)[]{ (null, "Ends a conditional section that was started by ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\if", "https://www.doxygen.nl/manual/commands.html#cmdif"), (null, " or ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\ifnot", "https://www.doxygen.nl/manual/commands.html#cmdifnot"), (null, " For each ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\if", "https://www.doxygen.nl/manual/commands.html#cmdif"), (null, " or ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\ifnot", "https://www.doxygen.nl/manual/commands.html#cmdifnot"), (null, " one and only one matching ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endif", "https://www.doxygen.nl/manual/commands.html#cmdendif"), (null, " must follow.\n\nSee also: commands ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\if", "https://www.doxygen.nl/manual/commands.html#cmdif"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\ifnot", "https://www.doxygen.nl/manual/commands.html#cmdifnot"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\else", "https://www.doxygen.nl/manual/commands.html#cmdelse"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\elseif.", "https://www.doxygen.nl/manual/commands.html#cmdelseif"), }),
-      new DoxygenHelpPageCommand("exception",              "<exception-object> { exception description }",                                    "https://www.doxygen.nl/manual/commands.html#cmdexception",              new (object, string, string)[]{ (null, "Starts an exception description for an exception object with name <exception-object>. Followed by a description of the exception. The existence of the exception object is not checked. The text of the paragraph has no special internal structure. All visual enhancement commands may be used inside the paragraph. Multiple adjacent ", ""), (ClassificationEnum.InlineCode, "\\exception", ""), (null, " commands will be joined into a single paragraph. Each exception description will start on a new line. The ", ""), (ClassificationEnum.InlineCode, "\\exception", ""), (null, " description ends when a blank line or some other sectioning command is encountered. See section ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\fn", "https://www.doxygen.nl/manual/commands.html#cmdfn"), (null, " for an example.", ""), }),
-      new DoxygenHelpPageCommand("if",                     "(section-label)",                                                                 "https://www.doxygen.nl/manual/commands.html#cmdif",                     new (object, string, string)[]{ (null, "Starts a conditional documentation section. The section ends with a matching ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endif", "https://www.doxygen.nl/manual/commands.html#cmdendif"), (null, " command. A conditional section is disabled by default. To enable it you must put the section-label after the ", ""), (null, "ENABLED_SECTIONS", "https://www.doxygen.nl/manual/config.html#cfg_enabled_sections"), (null, " tag in the configuration file.\n\nThe section label can be a logical expression build of section names, round brackets, && (AND), || (OR) and ! (NOT). If you use an expression you need to wrap it in round brackets, i.e ", ""), (ClassificationEnum.InlineCode, "\\if (!LABEL1 && LABEL2)", ""), (null, ".\n\nConditional blocks can be nested. A nested section is only enabled if all enclosing sections are enabled as well.\n\nThe ", ""), (ClassificationEnum.InlineCode, "\\if", ""), (null, " and corresponding ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endif", "https://www.doxygen.nl/manual/commands.html#cmdendif"), (null, " have to be in the same comment block. When a conditional block needs to span more than one comment block one has to use ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\cond", "https://www.doxygen.nl/manual/commands.html#cmdcond"), (null, " ... ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endcond", "https://www.doxygen.nl/manual/commands.html#cmdendcond"), (null, ".\n\nExample: ", ""), (ClassificationEnum.InlineCode, "\n     /*! Unconditionally shown documentation.\n      *  \\if Cond1\n      *    Only included if Cond1 is set.\n      *  \\endif\n      *  \\if Cond2\n      *    Only included if Cond2 is set.\n      *    \\if Cond3\n      *      Only included if Cond2 and Cond3 are set.\n      *    \\endif\n      *    More text.\n      *  \\endif\n      *  Unconditional text.\n      */\n\n", ""), (null, "\n\nYou can also use conditional commands inside aliases. To document a class in two languages you could for instance use:\n\nExample 2: ", ""), (ClassificationEnum.InlineCode, "\n   /*! \\english\n    *  This is English.\n    *  \\endenglish\n    *  \\dutch\n    *  Dit is Nederlands.\n    *  \\enddutch\n    */\n   class Example\n   {\n   };\n\n", ""), (null, "\n\nWhere the following aliases are defined in the configuration file:\n\n", ""), (ClassificationEnum.InlineCode, "   ALIASES  = \"english=\\if english\" \\\n              \"endenglish=\\endif\" \\\n              \"dutch=\\if dutch\" \\\n              \"enddutch=\\endif\"\n\n", ""), (null, "and ", ""), (null, "ENABLED_SECTIONS", "https://www.doxygen.nl/manual/config.html#cfg_enabled_sections"), (null, " can be used to enable either ", ""), (ClassificationEnum.InlineCode, "english", ""), (null, " or ", ""), (ClassificationEnum.InlineCode, "dutch", ""), (null, ".\n\nSee also: commands ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endif", "https://www.doxygen.nl/manual/commands.html#cmdendif"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\ifnot", "https://www.doxygen.nl/manual/commands.html#cmdifnot"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\else", "https://www.doxygen.nl/manual/commands.html#cmdelse"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\elseif", "https://www.doxygen.nl/manual/commands.html#cmdelseif"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\cond", "https://www.doxygen.nl/manual/commands.html#cmdcond"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endcond", "https://www.doxygen.nl/manual/commands.html#cmdendcond"), (null, ", and ", ""), (null, "ENABLED_SECTIONS", "https://www.doxygen.nl/manual/config.html#cfg_enabled_sections"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("ifnot",                  "(section-label)",                                                                 "https://www.doxygen.nl/manual/commands.html#cmdifnot",                  new (object, string, string)[]{ (null, "Starts a conditional documentation section. The section ends with a matching ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endif", "https://www.doxygen.nl/manual/commands.html#cmdendif"), (null, " command. This conditional section is enabled by default. To disable it you must put the section-label after the ", ""), (null, "ENABLED_SECTIONS", "https://www.doxygen.nl/manual/config.html#cfg_enabled_sections"), (null, " tag in the configuration file. The section label can be a logical expression build of section names, round brackets, && (AND), || (OR) and ! (NOT).\n\nSee also: commands ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endif", "https://www.doxygen.nl/manual/commands.html#cmdendif"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\if", "https://www.doxygen.nl/manual/commands.html#cmdif"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\else", "https://www.doxygen.nl/manual/commands.html#cmdelse"), (null, ", and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\elseif", "https://www.doxygen.nl/manual/commands.html#cmdelseif"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\cond", "https://www.doxygen.nl/manual/commands.html#cmdcond"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endcond", "https://www.doxygen.nl/manual/commands.html#cmdendcond"), (null, ", and ", ""), (null, "ENABLED_SECTIONS", "https://www.doxygen.nl/manual/config.html#cfg_enabled_sections"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("invariant",              "{ description of invariant }",                                                    "https://www.doxygen.nl/manual/commands.html#cmdinvariant",              new (object, string, string)[]{ (null, "Starts a paragraph where the invariant of an entity can be described. The paragraph will be indented. The text of the paragraph has no special internal structure. All visual enhancement commands may be used inside the paragraph. Multiple adjacent ", ""), (ClassificationEnum.InlineCode, "\\invariant", ""), (null, " commands will be joined into a single paragraph. Each invariant description will start on a new line. Alternatively, one ", ""), (ClassificationEnum.InlineCode, "\\invariant", ""), (null, " command may mention several invariants. The ", ""), (ClassificationEnum.InlineCode, "\\invariant", ""), (null, " command ends when a blank line or some other sectioning command is encountered.", ""), }),
-      new DoxygenHelpPageCommand("note",                   "{ text }",                                                                        "https://www.doxygen.nl/manual/commands.html#cmdnote",                   new (object, string, string)[]{ (null, "Starts a paragraph where a note can be entered. The paragraph will be indented. The text of the paragraph has no special internal structure. All visual enhancement commands may be used inside the paragraph. Multiple adjacent ", ""), (ClassificationEnum.InlineCode, "\\note", ""), (null, " commands will be joined into a single paragraph. Each note description will start on a new line. Alternatively, one ", ""), (ClassificationEnum.InlineCode, "\\note", ""), (null, " command may mention several notes. The ", ""), (ClassificationEnum.InlineCode, "\\note", ""), (null, " command ends when a blank line or some other sectioning command is encountered. See section ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\par", "https://www.doxygen.nl/manual/commands.html#cmdpar"), (null, " for an example.", ""), }),
-      new DoxygenHelpPageCommand("par",                    "[(paragraph title)] { paragraph }",                                               "https://www.doxygen.nl/manual/commands.html#cmdpar",                    new (object, string, string)[]{ (null, "If a paragraph title is given this command starts a paragraph with a user defined heading. The heading extends until the end of the line. The paragraph following the command will be indented.\n\nIf no paragraph title is given this command will start a new paragraph. This will also work inside other paragraph commands (like ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\param", "https://www.doxygen.nl/manual/commands.html#cmdparam"), (null, " or ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\warning", "https://www.doxygen.nl/manual/commands.html#cmdwarning"), (null, ") without ending that command.\n\nThe text of the paragraph has no special internal structure. All visual enhancement commands may be used inside the paragraph. The ", ""), (ClassificationEnum.InlineCode, "\\par", ""), (null, " command ends when a blank line or some other sectioning command is encountered.\n\nExample: ", ""), (ClassificationEnum.InlineCode, "\n   /*! \\class Par_Test\n    * Normal text.\n    *\n    * \\par User defined paragraph:\n    * Contents of the paragraph.\n    *\n    * \\par\n    * New paragraph under the same heading.\n    *\n    * \\note\n    * This note consists of two paragraphs.\n    * This is the first paragraph.\n    *\n    * \\par\n    * And this is the second paragraph.\n    *\n    * More normal text. \n    */\n    \n   class Par_Test {};\n\n", ""), (null, "  \nClick ", ""), (null, "here", "https://www.doxygen.nl/manual/examples/par/html/class_par___test.html"), (null, " for the corresponding HTML documentation that is generated by doxygen.", ""), }),
-      new DoxygenHelpPageCommand("param",                  "'['dir']' <parameter-name> { parameter description }",                            "https://www.doxygen.nl/manual/commands.html#cmdparam",                  new (object, string, string)[]{ (null, "Starts a parameter description for a function parameter with name <parameter-name>, followed by a description of the parameter. The existence of the parameter is checked and a warning is given if the documentation of this (or any other) parameter is missing or not present in the function declaration or definition.\n\nThe ", ""), (ClassificationEnum.InlineCode, "\\param", ""), (null, " command has an optional attribute, ", ""), (ClassificationEnum.InlineCode, "dir", ""), (null, ", specifying the direction of the parameter. Possible values are \"[in]\", \"[in,out]\", and \"[out]\", note the [square] brackets in this description. When a parameter is both input and output, [in,out] is used as attribute. Here is an example for the function ", ""), (ClassificationEnum.InlineCode, "memcpy:", ""), (null, "\n", ""), (ClassificationEnum.InlineCode, "\n   /*!\n    * Copies bytes from a source memory area to a destination memory area,\n    * where both areas may not overlap.\n    * @param[out] dest The memory area to copy to.\n    * @param[in]  src  The memory area to copy from.\n    * @param[in]  n    The number of bytes to copy\n    */\n   void memcpy(void *dest, const void *src, size_t n);\n\n", ""), (null, "The parameter description is a paragraph with no special internal structure. All visual enhancement commands may be used inside the paragraph.\n\nMultiple adjacent ", ""), (ClassificationEnum.InlineCode, "\\param", ""), (null, " commands will be joined into a single paragraph. Each parameter description will start on a new line. The ", ""), (ClassificationEnum.InlineCode, "\\param", ""), (null, " description ends when a blank line or some other sectioning command is encountered. See section ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\fn", "https://www.doxygen.nl/manual/commands.html#cmdfn"), (null, " for an example.\n\nNote that you can also document multiple parameters with a single ", ""), (ClassificationEnum.InlineCode, "\\param", ""), (null, " command using a comma separated list. Here is an example:\n\n", ""), (ClassificationEnum.InlineCode, "   /** Sets the position.\n    *  @param x,y,z Coordinates of the position in 3D space.\n    */\n   void setPosition(double x,double y,double z,double t)\n   {\n   }\n\n", ""), (null, "Note that for PHP one can also specify the type (or types if you separate them with a pipe symbol) which are allowed for a parameter (as this is not part of the definition). The syntax is the same as for the ", ""), (ClassificationEnum.InlineCode, "phpDocumentor", ""), (null, ", i.e.\n", ""), (ClassificationEnum.InlineCode, "\n   @param  datatype1|datatype2 $paramname description", ""), }),
-      new DoxygenHelpPageCommand("parblock",               "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdparblock",               new (object, string, string)[]{ (null, "For commands that expect a single paragraph as argument (such as ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\par", "https://www.doxygen.nl/manual/commands.html#cmdpar"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\param", "https://www.doxygen.nl/manual/commands.html#cmdparam"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\warning", "https://www.doxygen.nl/manual/commands.html#cmdwarning"), (null, "), the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\parblock", "https://www.doxygen.nl/manual/commands.html#cmdparblock"), (null, " command allows to start a description that covers multiple paragraphs, which then ends with ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endparblock", "https://www.doxygen.nl/manual/commands.html#cmdendparblock"), (null, ".\n\nExample:\n", ""), (ClassificationEnum.InlineCode, "\n   /** Example of a param command with a description consisting of two paragraphs\n    *  \\param p\n    *  \\parblock\n    *  First paragraph of the param description.\n    *\n    *  Second paragraph of the param description.\n    *  \\endparblock\n    *  Rest of the comment block continues.\n    */\n\n", ""), (null, "Note that the ", ""), (ClassificationEnum.InlineCode, "\\parblock", ""), (null, " command may also appear directly after ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\param", "https://www.doxygen.nl/manual/commands.html#cmdparam"), (null, "'s first argument.", ""), }),
-      new DoxygenHelpPageCommand("endparblock",            "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdendparblock",            new (object, string, string)[]{ (null, "This ends a block of paragraphs started with ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\parblock", "https://www.doxygen.nl/manual/commands.html#cmdparblock"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("tparam",                 "<template-parameter-name> { description }",                                       "https://www.doxygen.nl/manual/commands.html#cmdtparam",                 new (object, string, string)[]{ (null, "Starts a template parameter for a class or function template parameter with name <template-parameter-name>, followed by a description of the template parameter.\n\nOtherwise similar to ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\param", "https://www.doxygen.nl/manual/commands.html#cmdparam"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("post",                   "{ description of the postcondition }",                                            "https://www.doxygen.nl/manual/commands.html#cmdpost",                   new (object, string, string)[]{ (null, "Starts a paragraph where the postcondition of an entity can be described. The paragraph will be indented. The text of the paragraph has no special internal structure. All visual enhancement commands may be used inside the paragraph. Multiple adjacent ", ""), (ClassificationEnum.InlineCode, "\\post", ""), (null, " commands will be joined into a single paragraph. Each postcondition will start on a new line. Alternatively, one ", ""), (ClassificationEnum.InlineCode, "\\post", ""), (null, " command may mention several postconditions. The ", ""), (ClassificationEnum.InlineCode, "\\post", ""), (null, " command ends when a blank line or some other sectioning command is encountered.", ""), }),
-      new DoxygenHelpPageCommand("pre",                    "{ description of the precondition }",                                             "https://www.doxygen.nl/manual/commands.html#cmdpre",                    new (object, string, string)[]{ (null, "Starts a paragraph where the precondition of an entity can be described. The paragraph will be indented. The text of the paragraph has no special internal structure. All visual enhancement commands may be used inside the paragraph. Multiple adjacent ", ""), (ClassificationEnum.InlineCode, "\\pre", ""), (null, " commands will be joined into a single paragraph. Each precondition will start on a new line. Alternatively, one ", ""), (ClassificationEnum.InlineCode, "\\pre", ""), (null, " command may mention several preconditions. The ", ""), (ClassificationEnum.InlineCode, "\\pre", ""), (null, " command ends when a blank line or some other sectioning command is encountered.", ""), }),
-      new DoxygenHelpPageCommand("remark",                 "{ remark text }",                                                                 "https://www.doxygen.nl/manual/commands.html#cmdremark",                 new (object, string, string)[]{ (null, "Starts a paragraph where one or more remarks may be entered. The paragraph will be indented. The text of the paragraph has no special internal structure. All visual enhancement commands may be used inside the paragraph. Multiple adjacent ", ""), (ClassificationEnum.InlineCode, "\\remark", ""), (null, " commands will be joined into a single paragraph. Each remark will start on a new line. Alternatively, one ", ""), (ClassificationEnum.InlineCode, "\\remark", ""), (null, " command may mention several remarks. The ", ""), (ClassificationEnum.InlineCode, "\\remark", ""), (null, " command ends when a blank line or some other sectioning command is encountered.", ""), }),
-      new DoxygenHelpPageCommand("remarks",                "{ remark text }",                                                                 "https://www.doxygen.nl/manual/commands.html#cmdremarks",                new (object, string, string)[]{ (null, "Equivalent to ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\remark", "https://www.doxygen.nl/manual/commands.html#cmdremark"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("result",                 "{ description of the result value }",                                             "https://www.doxygen.nl/manual/commands.html#cmdresult",                 new (object, string, string)[]{ (null, "Equivalent to ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\return", "https://www.doxygen.nl/manual/commands.html#cmdreturn"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("return",                 "{ description of the return value }",                                             "https://www.doxygen.nl/manual/commands.html#cmdreturn",                 new (object, string, string)[]{ (null, "Starts a return value description for a function. The text of the paragraph has no special internal structure. All visual enhancement commands may be used inside the paragraph. Multiple adjacent ", ""), (ClassificationEnum.InlineCode, "\\return", ""), (null, " commands will be joined into a single paragraph. The ", ""), (ClassificationEnum.InlineCode, "\\return", ""), (null, " description ends when a blank line or some other sectioning command is encountered. See section ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\fn", "https://www.doxygen.nl/manual/commands.html#cmdfn"), (null, " for an example.", ""), }),
-      new DoxygenHelpPageCommand("returns",                "{ description of the return value }",                                             "https://www.doxygen.nl/manual/commands.html#cmdreturns",                new (object, string, string)[]{ (null, "Equivalent to ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\return", "https://www.doxygen.nl/manual/commands.html#cmdreturn"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("retval",                 "<return value> { description }",                                                  "https://www.doxygen.nl/manual/commands.html#cmdretval",                 new (object, string, string)[]{ (null, "Starts a description for a function's return value with name <return value>, followed by a description of the return value. The text of the paragraph that forms the description has no special internal structure. All visual enhancement commands may be used inside the paragraph. Multiple adjacent ", ""), (ClassificationEnum.InlineCode, "\\retval", ""), (null, " commands will be joined into a single paragraph. Each return value description will start on a new line. The ", ""), (ClassificationEnum.InlineCode, "\\retval", ""), (null, " description ends when a blank line or some other sectioning command is encountered.", ""), }),
-      new DoxygenHelpPageCommand("sa",                     "{ references }",                                                                  "https://www.doxygen.nl/manual/commands.html#cmdsa",                     new (object, string, string)[]{ (null, "Starts a paragraph where one or more cross-references to classes, functions, methods, variables, files or URL may be specified. Two names joined by either ", ""), (ClassificationEnum.InlineCode, "::", ""), (null, " or ", ""), (ClassificationEnum.InlineCode, "#", ""), (null, " are understood as referring to a class and one of its members. One of several overloaded methods or constructors may be selected by including a parenthesized list of argument types after the method name.\n\nSynonymous to ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\see", "https://www.doxygen.nl/manual/commands.html#cmdsee"), (null, ".\n\nSee also: command ", ""), (null, "autolink", "https://www.doxygen.nl/manual/autolink.html"), (null, " for information on how to create links to objects.", ""), }),
-      new DoxygenHelpPageCommand("see",                    "{ references }",                                                                  "https://www.doxygen.nl/manual/commands.html#cmdsee",                    new (object, string, string)[]{ (null, "Equivalent to ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\sa", "https://www.doxygen.nl/manual/commands.html#cmdsa"), (null, ". Introduced for compatibility with Javadoc.", ""), }),
-      new DoxygenHelpPageCommand("short",                  "{ short description }",                                                           "https://www.doxygen.nl/manual/commands.html#cmdshort",                  new (object, string, string)[]{ (null, "Equivalent to ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\brief", "https://www.doxygen.nl/manual/commands.html#cmdbrief"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("since",                  "{ text }",                                                                        "https://www.doxygen.nl/manual/commands.html#cmdsince",                  new (object, string, string)[]{ (null, "This command can be used to specify since when (version or time) an entity is available. The paragraph that follows ", ""), (ClassificationEnum.InlineCode, "\\since", ""), (null, " does not have any special internal structure. All visual enhancement commands may be used inside the paragraph. The ", ""), (ClassificationEnum.InlineCode, "\\since", ""), (null, " description ends when a blank line or some other sectioning command is encountered.", ""), }),
-      new DoxygenHelpPageCommand("test",                   "{ paragraph describing a test case }",                                            "https://www.doxygen.nl/manual/commands.html#cmdtest",                   new (object, string, string)[]{ (null, "Starts a paragraph where one or more test cases can be described. The paragraph will be indented. The text of the paragraph has no special internal structure. All visual enhancement commands may be used inside the paragraph. Multiple adjacent ", ""), (ClassificationEnum.InlineCode, "\\test", ""), (null, " commands will be joined into a single paragraph. Each test case description will start on a new line. Alternatively, one ", ""), (ClassificationEnum.InlineCode, "\\test", ""), (null, " command may mention several test cases. The ", ""), (ClassificationEnum.InlineCode, "\\test", ""), (null, " command ends when a blank line or some other sectioning command is encountered.\n\nThe description will also add an item to a separate Test list and the two instances of the description will be cross-referenced. Each item in the Test list will be preceded by a header that indicates the origin of the item.\n\nThe Test list and the corresponding entries can be disabled by setting the ", ""), (null, "GENERATE_TESTLIST", "https://www.doxygen.nl/manual/config.html#cfg_generate_testlist"), (null, " to ", ""), (ClassificationEnum.InlineCode, "NO", ""), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("throw",                  "<exception-object> { exception description }",                                    "https://www.doxygen.nl/manual/commands.html#cmdthrow",                  new (object, string, string)[]{ (null, "Synonymous ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\exception", "https://www.doxygen.nl/manual/commands.html#cmdexception"), (null, ".\n\nNote: the command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\throws", "https://www.doxygen.nl/manual/commands.html#cmdthrows"), (null, " is a synonym for this command.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\exception", "https://www.doxygen.nl/manual/commands.html#cmdexception"), }),
-      new DoxygenHelpPageCommand("throws",                 "<exception-object> { exception description }",                                    "https://www.doxygen.nl/manual/commands.html#cmdthrows",                 new (object, string, string)[]{ (null, "Equivalent to ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\throw", "https://www.doxygen.nl/manual/commands.html#cmdthrow"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("todo",                   "{ paragraph describing what is to be done }",                                     "https://www.doxygen.nl/manual/commands.html#cmdtodo",                   new (object, string, string)[]{ (null, "Starts a paragraph where one or more todo items are described. The paragraph will be indented. The text of the paragraph has no special internal structure. All visual enhancement commands may be used inside the paragraph. Multiple adjacent ", ""), (ClassificationEnum.InlineCode, "\\todo", ""), (null, " commands will be joined into a single paragraph. Each todo description will start on a new line. Alternatively, one ", ""), (ClassificationEnum.InlineCode, "\\todo", ""), (null, " command may mention several todo descriptions. The ", ""), (ClassificationEnum.InlineCode, "\\todo", ""), (null, " command ends when a blank line or some other sectioning command is encountered.\n\nThe description will also add an item to a separate Todo list and the two instances of the description will be cross-referenced. Each item in the Todo list will be preceded by a header that indicates the origin of the item.\n\nThe Todo list and the corresponding entries can be disabled by setting the ", ""), (null, "GENERATE_TODOLIST", "https://www.doxygen.nl/manual/config.html#cfg_generate_todolist"), (null, " to ", ""), (ClassificationEnum.InlineCode, "NO", ""), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("version",                "{ version number }",                                                              "https://www.doxygen.nl/manual/commands.html#cmdversion",                new (object, string, string)[]{ (null, "Starts a paragraph where one or more version strings may be entered. The paragraph will be indented. The text of the paragraph has no special internal structure. All visual enhancement commands may be used inside the paragraph. Multiple adjacent ", ""), (ClassificationEnum.InlineCode, "\\version", ""), (null, " commands will be joined into a single paragraph. Each version description will start on a new line. Alternatively, one ", ""), (ClassificationEnum.InlineCode, "\\version", ""), (null, " command may mention several version strings. The \\version command ends when a blank line or some other sectioning command is encountered. See section ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\author", "https://www.doxygen.nl/manual/commands.html#cmdauthor"), (null, " for an example.", ""), }),
-      new DoxygenHelpPageCommand("warning",                "{ warning message }",                                                             "https://www.doxygen.nl/manual/commands.html#cmdwarning",                new (object, string, string)[]{ (null, "Starts a paragraph where one or more warning messages may be entered. The paragraph will be indented. The text of the paragraph has no special internal structure. All visual enhancement commands may be used inside the paragraph. Multiple adjacent ", ""), (ClassificationEnum.InlineCode, "\\warning", ""), (null, " commands will be joined into a single paragraph. Each warning description will start on a new line. Alternatively, one ", ""), (ClassificationEnum.InlineCode, "\\warning", ""), (null, " command may mention several warnings. The ", ""), (ClassificationEnum.InlineCode, "\\warning", ""), (null, " command ends when a blank line or some other sectioning command is encountered. See section ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\author", "https://www.doxygen.nl/manual/commands.html#cmdauthor"), (null, " for an example.", ""), }),
-      new DoxygenHelpPageCommand("xrefitem",               "<key> \"heading\" \"list title\" { text }",                                       "https://www.doxygen.nl/manual/commands.html#cmdxrefitem",               new (object, string, string)[]{ (null, "This command is a generalization of commands such as ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\todo", "https://www.doxygen.nl/manual/commands.html#cmdtodo"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\bug", "https://www.doxygen.nl/manual/commands.html#cmdbug"), (null, ". It can be used to create user-defined text sections which are automatically cross-referenced between the place of occurrence and a related page, which will be generated. On the related page all sections of the same type will be collected.\n\nThe first argument <key> is an identifier uniquely representing the type of the section. The second argument is a quoted string representing the heading of the section under which text passed as the fourth argument is put. The third argument (list title) is used as the title for the related page containing all items with the same key. The second and third string argument cannot contain a newline. The keys ", ""), (ClassificationEnum.InlineCode, "\"todo\"", ""), (null, ", ", ""), (ClassificationEnum.InlineCode, "\"test\"", ""), (null, ", ", ""), (ClassificationEnum.InlineCode, "\"bug\"", ""), (null, " and ", ""), (ClassificationEnum.InlineCode, "\"deprecated\"", ""), (null, " are predefined.\n\nTo get an idea on how to use the ", ""), (ClassificationEnum.InlineCode, "\\xrefitem", ""), (null, " command and what its effect is, consider the todo list, which (for English output) can be seen an alias for the command\n", ""), (ClassificationEnum.InlineCode, "\n   \\xrefitem todo \"Todo\" \"Todo List\" \n\n", ""), (null, "Since it is very tedious and error-prone to repeat the first three parameters of the command for each section, the command is meant to be used in combination with the ", ""), (null, "ALIASES", "https://www.doxygen.nl/manual/config.html#cfg_aliases"), (null, " option in the configuration file. To define a new command ", ""), (ClassificationEnum.InlineCode, "\\reminder", ""), (null, ", for instance, one should add the following line to the configuration file:\n", ""), (ClassificationEnum.InlineCode, "\n   ALIASES += \"reminder=\\xrefitem reminders \\\"Reminder\\\" \\\"Reminders\\\"\" \n\n", ""), (null, "Note the use of escaped quotes for the second and third argument of the ", ""), (ClassificationEnum.InlineCode, "\\xrefitem", ""), (null, " command.\n\nIn case parameter \"(heading)\" is the empty string no heading is generated. This can be useful when used in combination with the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\page", "https://www.doxygen.nl/manual/commands.html#cmdpage"), (null, " command e.g.\n", ""), (ClassificationEnum.InlineCode, "\n   /** @page my_errors My Errors\n    *  @brief Errors page\n    *\n    *  Errors page contents.\n    */\n   \n   /** \\error ERROR 101: in case a file can not be opened.\n       Check about file system read/write access. */\n   #define MY_ERR_CANNOT_OPEN_FILE                   101\n   \n   /** \\error ERROR 102: in case a file can not be closed.\n       Check about file system read/write access. */\n   #define MY_ERR_CANNOT_CLOSE_FILE                  102\n\n", ""), (null, "with ", ""), (ClassificationEnum.InlineCode, "\\error", ""), (null, " defined as\n", ""), (ClassificationEnum.InlineCode, "\n   ALIASES += \"error=\\xrefitem my_errors \\\"\\\" \\\"\\\"\"", ""), }),
-      new DoxygenHelpPageCommand("addindex",               "(text)",                                                                          "https://www.doxygen.nl/manual/commands.html#cmdaddindex",               new (object, string, string)[]{ (null, "This command adds (text) to the LaTeX , DocBook and RTF index.", ""), }),
-      new DoxygenHelpPageCommand("anchor",                 "<word>",                                                                          "https://www.doxygen.nl/manual/commands.html#cmdanchor",                 new (object, string, string)[]{ (null, "This command places an invisible, named anchor into the documentation to which you can refer with the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\ref", "https://www.doxygen.nl/manual/commands.html#cmdref"), (null, " command.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\ref", "https://www.doxygen.nl/manual/commands.html#cmdref"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("cite",                   "<label>",                                                                         "https://www.doxygen.nl/manual/commands.html#cmdcite",                   new (object, string, string)[]{ (null, "Adds a bibliographic reference in the text and in the list of bibliographic references. The <label> must be a valid BibTeX label that can be found in one of the .bib files listed in ", ""), (null, "CITE_BIB_FILES", "https://www.doxygen.nl/manual/config.html#cfg_cite_bib_files"), (null, ". For the LaTeX output the formatting of the reference in the text can be configured with ", ""), (null, "LATEX_BIB_STYLE", "https://www.doxygen.nl/manual/config.html#cfg_latex_bib_style"), (null, ". For other output formats a fixed representation is used. Note that using this command requires the ", ""), (ClassificationEnum.InlineCode, "bibtex", ""), (null, " tool to be present in the search path.", ""), }),
-      new DoxygenHelpPageCommand("endlink",                "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdendlink",                new (object, string, string)[]{ (null, "This command ends a link that is started with the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\link", "https://www.doxygen.nl/manual/commands.html#cmdlink"), (null, " command.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\link", "https://www.doxygen.nl/manual/commands.html#cmdlink"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("link",                   "<link-object>",                                                                   "https://www.doxygen.nl/manual/commands.html#cmdlink",                   new (object, string, string)[]{ (null, "The links that are automatically generated by doxygen always have the name of the object they point to as link-text.\n\nThe ", ""), (ClassificationEnum.InlineCode, "\\link", ""), (null, " command can be used to create a link to an object (a file, class, or member) with a user specified link-text. The link command should end with an ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endlink", "https://www.doxygen.nl/manual/commands.html#cmdendlink"), (null, " command. All text between the ", ""), (ClassificationEnum.InlineCode, "\\link", ""), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endlink", "https://www.doxygen.nl/manual/commands.html#cmdendlink"), (null, " commands serves as text for a link to the <link-object> specified as the first argument of ", ""), (ClassificationEnum.InlineCode, "\\link", ""), (null, ".\n\nSee also: Command ", ""), (null, "autolink", "https://www.doxygen.nl/manual/autolink.html"), (null, " for more information on automatically generated links and valid link-objects.", ""), }),
-      new DoxygenHelpPageCommand("ref",                    "<name> [\"(text)\"]",                                                             "https://www.doxygen.nl/manual/commands.html#cmdref",                    new (object, string, string)[]{ (null, "Creates a reference to a named symbol, file, section, subsection, page or anchor.\n\nFor HTML documentation the reference command will generate a link to the section. For a section or subsection the title of the section will be used as the text of the link. For an anchor the optional text between quotes will be used or <name> if no text is specified.\n\nIn case <name> has spaces (for instance if it refers a file name containing spaces) you need to add double quotes around the <name>, e.g. \"my file.md\".\n\nFor LaTeX documentation the reference command will be the same unless the ", ""), (null, "PDF_HYPERLINKS", "https://www.doxygen.nl/manual/config.html#cfg_pdf_hyperlinks"), (null, " option has been set to ", ""), (ClassificationEnum.InlineCode, "NO", ""), (null, ", in this case it generates the section title for sections or the text if <name> refers to an anchor followed by a page number.\n\nSee also: Command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\page", "https://www.doxygen.nl/manual/commands.html#cmdpage"), (null, " for an example of the ", ""), (ClassificationEnum.InlineCode, "\\ref", ""), (null, " command.", ""), }),
-      new DoxygenHelpPageCommand("refitem",                "<name>",                                                                          "https://www.doxygen.nl/manual/commands.html#cmdrefitem",                new (object, string, string)[]{ (null, "Just like the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\ref", "https://www.doxygen.nl/manual/commands.html#cmdref"), (null, " command, this command creates a reference to a named section, but this reference appears in a list that is started by ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\secreflist", "https://www.doxygen.nl/manual/commands.html#cmdsecreflist"), (null, " and ends with ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endsecreflist", "https://www.doxygen.nl/manual/commands.html#cmdendsecreflist"), (null, ". An example of such a list can be seen ", ""), (null, "at the top of the page", "https://www.doxygen.nl/manual/commands.html#showsecreflist"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("secreflist",             "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdsecreflist",             new (object, string, string)[]{ (null, "Starts an index list of item, created with ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\refitem", "https://www.doxygen.nl/manual/commands.html#cmdrefitem"), (null, " that each link to a named section.", ""), }),
-      new DoxygenHelpPageCommand("endsecreflist",          "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdendsecreflist",          new (object, string, string)[]{ (null, "End an index list started with ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\secreflist", "https://www.doxygen.nl/manual/commands.html#cmdsecreflist"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("subpage",                "<name> [\"(text)\"]",                                                             "https://www.doxygen.nl/manual/commands.html#cmdsubpage",                new (object, string, string)[]{ (null, "This command can be used to create a hierarchy of pages. The same structure can be made using the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\defgroup", "https://www.doxygen.nl/manual/commands.html#cmddefgroup"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\ingroup", "https://www.doxygen.nl/manual/commands.html#cmdingroup"), (null, " commands, but for pages the ", ""), (ClassificationEnum.InlineCode, "\\subpage", ""), (null, " command is often more convenient. The main page (see ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\mainpage", "https://www.doxygen.nl/manual/commands.html#cmdmainpage"), (null, ") is typically the root of hierarchy.\n\nThis command behaves similar as ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\ref", "https://www.doxygen.nl/manual/commands.html#cmdref"), (null, " in the sense that it creates a reference to a page labeled <name> with the optional link text as specified in the second argument.\n\nIt differs from the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\ref", "https://www.doxygen.nl/manual/commands.html#cmdref"), (null, " command in that it only works for pages, and creates a parent-child relation between pages, where the child page (or sub page) is identified by label <name>.\n\nSee the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\section", "https://www.doxygen.nl/manual/commands.html#cmdsection"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\subsection", "https://www.doxygen.nl/manual/commands.html#cmdsubsection"), (null, " commands if you want to add structure without creating multiple pages.\n\n", ""), (ClassificationEnum.Note, "Note:", ""), (null, " Each page can be the sub page \nof only one other page and no cyclic relations are allowed, i.e. the \npage hierarchy must have a tree structure.\n\nHere is an example:\n", ""), (ClassificationEnum.InlineCode, "\n   /*! \\mainpage A simple manual\n   \n   Some general info.\n   \n   This manual is divided in the following sections:\n   - \\subpage intro\n   - \\subpage advanced \"Advanced usage\"\n   */\n   \n   //-----------------------------------------------------------\n   \n   /*! \\page intro Introduction\n   This page introduces the user to the topic.\n   Now you can proceed to the \\ref advanced \"advanced section\".\n   */\n   \n   //-----------------------------------------------------------\n   \n   /*! \\page advanced Advanced Usage\n   This page is for advanced users.\n   Make sure you have first read \\ref intro \"the introduction\".\n   */", ""), }),
-      new DoxygenHelpPageCommand("tableofcontents",        "['{'[option[:level]][,option[:level]]*'}']",                                      "https://www.doxygen.nl/manual/commands.html#cmdtableofcontents",        new (object, string, string)[]{ (null, "Creates a table of contents at the top of a page, listing all sections and subsections in the page. The ", ""), (ClassificationEnum.InlineCode, "option", ""), (null, " can be ", ""), (ClassificationEnum.InlineCode, "HTML", ""), (null, " or ", ""), (ClassificationEnum.InlineCode, "LaTeX", ""), (null, " or ", ""), (ClassificationEnum.InlineCode, "XML", ""), (null, " or ", ""), (ClassificationEnum.InlineCode, "DocBook", ""), (null, ". When a ", ""), (ClassificationEnum.InlineCode, "level", ""), (null, " is specified this means the maximum nesting level that is shown. The value of ", ""), (ClassificationEnum.InlineCode, "level", ""), (null, " should be in the range 1..5, values outside this range are considered to be 5. In case no ", ""), (ClassificationEnum.InlineCode, "level", ""), (null, " is specified ", ""), (ClassificationEnum.InlineCode, "level", ""), (null, " is set to 5 (show all) In case no ", ""), (ClassificationEnum.InlineCode, "option", ""), (null, ". is specified ", ""), (ClassificationEnum.InlineCode, "\\tableofcontents", ""), (null, " acts as if just the ", ""), (ClassificationEnum.InlineCode, "option", ""), (null, " ", ""), (ClassificationEnum.InlineCode, "HTML", ""), (null, " and ", ""), (ClassificationEnum.InlineCode, "XML", ""), (null, " was specified. In case of multiple ", ""), (ClassificationEnum.InlineCode, "\\tableofcontents", ""), (null, " commands in a page the ", ""), (ClassificationEnum.InlineCode, "option", ""), (null, "(s) will be used additional to the already specified ", ""), (ClassificationEnum.InlineCode, "option", ""), (null, "(s), but only the last ", ""), (ClassificationEnum.InlineCode, "level", ""), (null, " of an ", ""), (ClassificationEnum.InlineCode, "option", ""), (null, " is valid.\n\n", ""), (ClassificationEnum.Warning, "Warning:", ""), (null, " This command only works inside related page documentation and ", ""), (ClassificationEnum.EmphasisMinor, "not", ""), (null, " in other documentation blocks and only has effect in the specified output!", ""), }),
-      new DoxygenHelpPageCommand("section",                "<section-name> (section title)",                                                  "https://www.doxygen.nl/manual/commands.html#cmdsection",                new (object, string, string)[]{ (null, "Creates a section with name <section-name>. The title of the section should be specified as the second argument of the ", ""), (ClassificationEnum.InlineCode, "\\section", ""), (null, " command.\n\n", ""), (ClassificationEnum.Warning, "Warning:", ""), (null, " This command only works inside related page documentation and ", ""), (ClassificationEnum.EmphasisMinor, "not", ""), (null, " in other documentation blocks!\n\nSee also: Command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\page", "https://www.doxygen.nl/manual/commands.html#cmdpage"), (null, " for an example of the ", ""), (ClassificationEnum.InlineCode, "\\section", ""), (null, " command.", ""), }),
-      new DoxygenHelpPageCommand("subsection",             "<subsection-name> (subsection title)",                                            "https://www.doxygen.nl/manual/commands.html#cmdsubsection",             new (object, string, string)[]{ (null, "Creates a subsection with name <subsection-name>. The title of the subsection should be specified as the second argument of the ", ""), (ClassificationEnum.InlineCode, "\\subsection", ""), (null, " command.\n\n", ""), (ClassificationEnum.Warning, "Warning:", ""), (null, " This command only works inside a section of a related page documentation block and ", ""), (ClassificationEnum.EmphasisMinor, "not", ""), (null, " in other documentation blocks!\n\nSee also: Command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\page", "https://www.doxygen.nl/manual/commands.html#cmdpage"), (null, " for an example of the ", ""), (ClassificationEnum.InlineCode, "\\subsection", ""), (null, " command.", ""), }),
-      new DoxygenHelpPageCommand("subsubsection",          "<subsubsection-name> (subsubsection title)",                                      "https://www.doxygen.nl/manual/commands.html#cmdsubsubsection",          new (object, string, string)[]{ (null, "Creates a subsubsection with name <subsubsection-name>. The title of the subsubsection should be specified as the second argument of the ", ""), (ClassificationEnum.InlineCode, "\\subsubsection", ""), (null, " command.\n\n", ""), (ClassificationEnum.Warning, "Warning:", ""), (null, " This command only works inside a subsection of a related page documentation block and ", ""), (ClassificationEnum.EmphasisMinor, "not", ""), (null, " in other documentation blocks!\n\nSee also: Command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\page", "https://www.doxygen.nl/manual/commands.html#cmdpage"), (null, " for an example of the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\section", "https://www.doxygen.nl/manual/commands.html#cmdsection"), (null, " command and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\subsection", "https://www.doxygen.nl/manual/commands.html#cmdsubsection"), (null, " command.", ""), }),
-      new DoxygenHelpPageCommand("paragraph",              "<paragraph-name> (paragraph title)",                                              "https://www.doxygen.nl/manual/commands.html#cmdparagraph",              new (object, string, string)[]{ (null, "Creates a named paragraph with name <paragraph-name>. The title of the paragraph should be specified as the second argument of the ", ""), (ClassificationEnum.InlineCode, "\\paragraph", ""), (null, " command.\n\n", ""), (ClassificationEnum.Warning, "Warning:", ""), (null, " This command only works inside a subsubsection of a related page documentation block and ", ""), (ClassificationEnum.EmphasisMinor, "not", ""), (null, " in other documentation blocks!", ""), }),
-      new DoxygenHelpPageCommand("dontinclude",            "['{lineno}'] <file-name>",                                                        "https://www.doxygen.nl/manual/commands.html#cmddontinclude",            new (object, string, string)[]{ (null, "This command can be used to parse a source file without actually verbatim including it in the documentation (as the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\include", "https://www.doxygen.nl/manual/commands.html#cmdinclude"), (null, " command does). This is useful if you want to divide the source file into smaller pieces and add documentation between the pieces. Source files or directories can be specified using the ", ""), (null, "EXAMPLE_PATH", "https://www.doxygen.nl/manual/config.html#cfg_example_path"), (null, " tag of doxygen's configuration file.\n\nYou can add option ", ""), (ClassificationEnum.InlineCode, "lineno", ""), (null, " to enable line numbers for the included code if desired.\n\nThe class and member declarations and definitions inside the code fragment are 'remembered' during the parsing of the comment block that contained the ", ""), (ClassificationEnum.InlineCode, "\\dontinclude", ""), (null, " command.\n\nFor line by line descriptions of source files, one or more lines of the example can be displayed using the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\line", "https://www.doxygen.nl/manual/commands.html#cmdline"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\skip", "https://www.doxygen.nl/manual/commands.html#cmdskip"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\skipline", "https://www.doxygen.nl/manual/commands.html#cmdskipline"), (null, ", and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\until", "https://www.doxygen.nl/manual/commands.html#cmduntil"), (null, " commands. An internal pointer is used for these commands. The ", ""), (ClassificationEnum.InlineCode, "\\dontinclude", ""), (null, " command sets the pointer to the first line of the example.\n\nExample: ", ""), (ClassificationEnum.InlineCode, "\n    \n   /*! A test class. */\n    \n   class Include_Test\n   {\n    public:\n       /// a member function\n    void example();\n   };\n    \n   /*! \\page pag_example\n    *  \\dontinclude include_test.cpp\n    *  Our main function starts like this:\n    *  \\skip main\n    *  \\until {\n    *  First we create an object \\c t of the Include_Test class.\n    *  \\skipline Include_Test\n    *  Then we call the example member function \n    *  \\line example\n    *  After that our little test routine ends.\n    *  \\line }\n    */\n\n", ""), (null, " Where the example file ", ""), (ClassificationEnum.InlineCode, "include_test.cpp", ""), (null, " looks as follows: ", ""), (ClassificationEnum.InlineCode, "\n   void main()\n   {\n     Include_Test t;\n     t.example();\n   }\n\n", ""), (null, "  \nClick ", ""), (null, "here", "https://www.doxygen.nl/manual/examples/include/html/pag_example.html"), (null, " for the corresponding HTML documentation that is generated by doxygen.\n\n", ""), (null, "See also: commands ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\line", "https://www.doxygen.nl/manual/commands.html#cmdline"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\skip", "https://www.doxygen.nl/manual/commands.html#cmdskip"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\skipline", "https://www.doxygen.nl/manual/commands.html#cmdskipline"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\until", "https://www.doxygen.nl/manual/commands.html#cmduntil"), (null, ", and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\include", "https://www.doxygen.nl/manual/commands.html#cmdinclude"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("include",                "['{'option'}'] <file-name>",                                                      "https://www.doxygen.nl/manual/commands.html#cmdinclude",                new (object, string, string)[]{ (null, "This command can be used to include a source file as a block of code. The command takes the name of an include file as an argument. Source files or directories can be specified using the ", ""), (null, "EXAMPLE_PATH", "https://www.doxygen.nl/manual/config.html#cfg_example_path"), (null, " tag of doxygen's configuration file.\n\nIf <file-name> itself is not unique for the set of example files specified by the ", ""), (null, "EXAMPLE_PATH", "https://www.doxygen.nl/manual/config.html#cfg_example_path"), (null, " tag, you can include part of the absolute path to disambiguate it.\n\nUsing the ", ""), (ClassificationEnum.InlineCode, "\\include", ""), (null, " command is equivalent to inserting the file into the documentation block and surrounding it with ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\code", "https://www.doxygen.nl/manual/commands.html#cmdcode"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endcode", "https://www.doxygen.nl/manual/commands.html#cmdendcode"), (null, " commands.\n\nThe main purpose of the ", ""), (ClassificationEnum.InlineCode, "\\include", ""), (null, " command is to avoid code duplication in case of example blocks that consist of multiple source and header files.\n\nFor a line by line description of a source files use the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\dontinclude", "https://www.doxygen.nl/manual/commands.html#cmddontinclude"), (null, " command in combination with the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\line", "https://www.doxygen.nl/manual/commands.html#cmdline"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\skip", "https://www.doxygen.nl/manual/commands.html#cmdskip"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\skipline", "https://www.doxygen.nl/manual/commands.html#cmdskipline"), (null, ", and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\until", "https://www.doxygen.nl/manual/commands.html#cmduntil"), (null, " commands.\n\nAlternatively, the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\snippet", "https://www.doxygen.nl/manual/commands.html#cmdsnippet"), (null, " command can be used to include only a fragment of a source file. For this to work the fragment has to be marked.\n\n", ""), (ClassificationEnum.Note, "Note:", ""), (null, " Doxygen's special commands do not work inside blocks of code. It is allowed to nest C-style comments inside a code block though.\n\nThe ", ""), (ClassificationEnum.InlineCode, "option", ""), (null, " can either be ", ""), (ClassificationEnum.InlineCode, "lineno", ""), (null, ", or ", ""), (ClassificationEnum.InlineCode, "doc", ""), (null, ", and additionally ", ""), (ClassificationEnum.InlineCode, "local", ""), (null, " can be specified.\n    • The ", ""), (ClassificationEnum.InlineCode, "option", ""), (null, " ", ""), (ClassificationEnum.InlineCode, "lineno", ""), (null, " can be used to enable line numbers for the included code if desired.\n    • The ", ""), (ClassificationEnum.InlineCode, "option", ""), (null, " ", ""), (ClassificationEnum.InlineCode, "doc", ""), (null, " can be used to treat the file as documentation rather than code.\n    • The ", ""), (ClassificationEnum.InlineCode, "option", ""), (null, " ", ""), (ClassificationEnum.InlineCode, "local", ""), (null, " can be used make doxygen \ninterpret the code as if it was in the class or namespace in which the \ninclude command appears, rather than the global namespace.\n\n", ""), (ClassificationEnum.Note, "Note:", ""), (null, "\n	When using the ", ""), (ClassificationEnum.InlineCode, "{doc}", ""), (null, " option, some commands like ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\cond", "https://www.doxygen.nl/manual/commands.html#cmdcond"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\if", "https://www.doxygen.nl/manual/commands.html#cmdif"), (null, " don't work with this command due to the moment of parsing.\n	The included documentation should not have comment signs in it as they will appear in the documentation as well.\n\nSee also: commands ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\example", "https://www.doxygen.nl/manual/commands.html#cmdexample"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\dontinclude", "https://www.doxygen.nl/manual/commands.html#cmddontinclude"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\verbatim", "https://www.doxygen.nl/manual/commands.html#cmdverbatim"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\includedoc", "https://www.doxygen.nl/manual/commands.html#cmdincludedoc"), (null, ", and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\snippet", "https://www.doxygen.nl/manual/commands.html#cmdsnippet"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("includelineno",          "<file-name>",                                                                     "https://www.doxygen.nl/manual/commands.html#cmdincludelineno",          new (object, string, string)[]{ (null, "This command is obsolete and is still supported for backward compatibility reasons, it works the same way as ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\include{lineno}", "https://www.doxygen.nl/manual/commands.html#cmdinclude"), (null, "\n\nSee also: commands ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\include{lineno}", "https://www.doxygen.nl/manual/commands.html#cmdinclude"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("includedoc",             "<file-name>",                                                                     "https://www.doxygen.nl/manual/commands.html#cmdincludedoc",             new (object, string, string)[]{ (null, "This command is obsolete and is still supported for backward compatibility reasons, it works the same way as ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\include{doc}", "https://www.doxygen.nl/manual/commands.html#cmdinclude"), (null, "\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\include{doc}", "https://www.doxygen.nl/manual/commands.html#cmdinclude"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("line",                   "( pattern )",                                                                     "https://www.doxygen.nl/manual/commands.html#cmdline",                   new (object, string, string)[]{ (null, "This command searches line by line through the example that was last included using ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\include", "https://www.doxygen.nl/manual/commands.html#cmdinclude"), (null, " or ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\dontinclude", "https://www.doxygen.nl/manual/commands.html#cmddontinclude"), (null, " until it finds a non-blank line. If that line contains the specified pattern, it is written to the output.\n\nThe internal pointer that is used to keep track of the current line in the example, is set to the start of the line following the non-blank line that was found (or to the end of the example if no such line could be found).\n\nSee section ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\dontinclude", "https://www.doxygen.nl/manual/commands.html#cmddontinclude"), (null, " for an example.", ""), }),
-      new DoxygenHelpPageCommand("skip",                   "( pattern )",                                                                     "https://www.doxygen.nl/manual/commands.html#cmdskip",                   new (object, string, string)[]{ (null, "This command searches line by line through the example that was last included using ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\include", "https://www.doxygen.nl/manual/commands.html#cmdinclude"), (null, " or ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\dontinclude", "https://www.doxygen.nl/manual/commands.html#cmddontinclude"), (null, " until it finds a line that contains the specified pattern.\n\nThe internal pointer that is used to keep track of the current line in the example, is set to the start of the line that contains the specified pattern (or to the end of the example if the pattern could not be found).\n\nSee section ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\dontinclude", "https://www.doxygen.nl/manual/commands.html#cmddontinclude"), (null, " for an example.", ""), }),
-      new DoxygenHelpPageCommand("skipline",               "( pattern )",                                                                     "https://www.doxygen.nl/manual/commands.html#cmdskipline",               new (object, string, string)[]{ (null, "This command searches line by line through the example that was last included using ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\include", "https://www.doxygen.nl/manual/commands.html#cmdinclude"), (null, " or ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\dontinclude", "https://www.doxygen.nl/manual/commands.html#cmddontinclude"), (null, " until it finds a line that contains the specified pattern. It then writes the line to the output.\n\nThe internal pointer that is used to keep track of the current line in the example, is set to the start of the line following the line that is written (or to the end of the example if the pattern could not be found).\n\nNote: The command: ", ""), (ClassificationEnum.InlineCode, "\n   \\skipline pattern\n\n", ""), (null, " is equivalent to: ", ""), (ClassificationEnum.InlineCode, "\n   \\skip pattern\n   \\line pattern\n\n", ""), (null, "\n\nSee section ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\dontinclude", "https://www.doxygen.nl/manual/commands.html#cmddontinclude"), (null, " for an example.", ""), }),
-      new DoxygenHelpPageCommand("snippet",                "['{'option'}'] <file-name> ( block_id )",                                         "https://www.doxygen.nl/manual/commands.html#cmdsnippet",                new (object, string, string)[]{ (null, "Where the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\include", "https://www.doxygen.nl/manual/commands.html#cmdinclude"), (null, " command can be used to include a complete file as source code, this command can be used to quote only a fragment of a source file. In case ", ""), (ClassificationEnum.InlineCode, "this", ""), (null, " is used as <file-name> the current file is taken as file to take the snippet from.\n\nFor example, the putting the following command in the documentation, references a snippet in file ", ""), (ClassificationEnum.InlineCode, "example.cpp", ""), (null, " residing in a subdirectory which should be pointed to by ", ""), (null, "EXAMPLE_PATH", "https://www.doxygen.nl/manual/config.html#cfg_example_path"), (null, ".\n\n", ""), (ClassificationEnum.InlineCode, "     \\snippet snippets/example.cpp Adding a resource\n\n", ""), (null, "The text following the file name is the unique identifier for the snippet. This is used to delimit the quoted code in the relevant snippet file as shown in the following example that corresponds to the above ", ""), (ClassificationEnum.InlineCode, "\\snippet", ""), (null, " command:\n\n", ""), (ClassificationEnum.InlineCode, "       QImage image(64, 64, QImage::Format_RGB32);\n       image.fill(qRgb(255, 160, 128));\n    \n   //! [Adding a resource]\n       document->addResource(QTextDocument::ImageResource,\n           QUrl(\"mydata://image.png\"), QVariant(image));\n   //! [Adding a resource]\n       ...\n\n", ""), (null, "Note that the lines containing the block markers will not be included, so the output will be:\n\n", ""), (ClassificationEnum.InlineCode, "   document->addResource(QTextDocument::ImageResource,\n       QUrl(\"mydata://image.png\"), QVariant(image));\n\n", ""), (null, "Note also that the [block_id] markers should appear exactly twice in the source file.\n\nThe ", ""), (ClassificationEnum.InlineCode, "option", ""), (null, " can either be ", ""), (ClassificationEnum.InlineCode, "lineno", ""), (null, ", ", ""), (ClassificationEnum.InlineCode, "trimleft", ""), (null, " or ", ""), (ClassificationEnum.InlineCode, "doc", ""), (null, ", and additionally ", ""), (ClassificationEnum.InlineCode, "local", ""), (null, " can be specified.\n    • The ", ""), (ClassificationEnum.InlineCode, "option", ""), (null, " ", ""), (ClassificationEnum.InlineCode, "lineno", ""), (null, " can be used to enable line numbers for the included code if desired.\n    • The ", ""), (ClassificationEnum.InlineCode, "option", ""), (null, " ", ""), (ClassificationEnum.InlineCode, "trimleft", ""), (null, " can be used to remove the common spacing in front of all lines (also taking in account the setting of the ", ""), (null, "TAB_SIZE", "https://www.doxygen.nl/manual/config.html#cfg_tab_size"), (null, " tag).\n    • The ", ""), (ClassificationEnum.InlineCode, "option", ""), (null, " ", ""), (ClassificationEnum.InlineCode, "doc", ""), (null, " can be used to treat the file as documentation rather than code.\n    • The ", ""), (ClassificationEnum.InlineCode, "option", ""), (null, " ", ""), (ClassificationEnum.InlineCode, "local", ""), (null, " can be used make doxygen \ninterpret the code as if it was in the class or namespace in which the \ninclude command appears, rather than the global namespace.\n\n", ""), (ClassificationEnum.Note, "Note:", ""), (null, "\n	When using the ", ""), (ClassificationEnum.InlineCode, "{doc}", ""), (null, " option, some commands like ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\cond", "https://www.doxygen.nl/manual/commands.html#cmdcond"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\if", "https://www.doxygen.nl/manual/commands.html#cmdif"), (null, " don't work with this command due to the moment of parsing.\n	The included documentation should not have comment signs in it as they will appear in the documentation as well.\n\nsee section ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\dontinclude", "https://www.doxygen.nl/manual/commands.html#cmddontinclude"), (null, " for an alternative way to include fragments of a source file that does not require markers.", ""), }),
-      new DoxygenHelpPageCommand("snippetlineno",          "<file-name> ( block_id )",                                                        "https://www.doxygen.nl/manual/commands.html#cmdsnippetlineno",          new (object, string, string)[]{ (null, "This command is obsolete and is still supported for backward compatibility reasons, it works the same way as ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\snippet{lineno}", "https://www.doxygen.nl/manual/commands.html#cmdsnippet"), (null, "\n\nSee also: commands ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\snippet{lineno}", "https://www.doxygen.nl/manual/commands.html#cmdsnippet"), }),
-      new DoxygenHelpPageCommand("snippetdoc",             "<file-name> ( block_id )",                                                        "https://www.doxygen.nl/manual/commands.html#cmdsnippetdoc",             new (object, string, string)[]{ (null, "This command is obsolete and is still supported for backward compatibility reasons, it works the same way as ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\snippet{doc}", "https://www.doxygen.nl/manual/commands.html#cmdsnippet"), (null, "\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\snippet{doc}", "https://www.doxygen.nl/manual/commands.html#cmdsnippet"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\include{doc}", "https://www.doxygen.nl/manual/commands.html#cmdinclude"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("until",                  "( pattern )",                                                                     "https://www.doxygen.nl/manual/commands.html#cmduntil",                  new (object, string, string)[]{ (null, "This command writes all lines of the example that was last included using ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\include", "https://www.doxygen.nl/manual/commands.html#cmdinclude"), (null, " or ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\dontinclude", "https://www.doxygen.nl/manual/commands.html#cmddontinclude"), (null, " to the output, until it finds a line containing the specified pattern. The line containing the pattern will be written as well.\n\nThe internal pointer that is used to keep track of the current line in the example, is set to the start of the line following last written line (or to the end of the example if the pattern could not be found).\n\nSee section ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\dontinclude", "https://www.doxygen.nl/manual/commands.html#cmddontinclude"), (null, " for an example.", ""), }),
-      new DoxygenHelpPageCommand("verbinclude",            "<file-name>",                                                                     "https://www.doxygen.nl/manual/commands.html#cmdverbinclude",            new (object, string, string)[]{ (null, "This command includes the contents of the file <file-name> verbatim in the documentation. The command is equivalent to pasting the contents of the file in the documentation and placing ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\verbatim", "https://www.doxygen.nl/manual/commands.html#cmdverbatim"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endverbatim", "https://www.doxygen.nl/manual/commands.html#cmdendverbatim"), (null, " commands around it.\n\nFiles or directories that doxygen should look for can be specified using the ", ""), (null, "EXAMPLE_PATH", "https://www.doxygen.nl/manual/config.html#cfg_example_path"), (null, " tag of doxygen's configuration file.", ""), }),
-      new DoxygenHelpPageCommand("htmlinclude",            "[\"[block]\"] <file-name>",                                                       "https://www.doxygen.nl/manual/commands.html#cmdhtmlinclude",            new (object, string, string)[]{ (null, "This command includes the contents of the file <file-name> as is in the HTML documentation and tagged with ", ""), (ClassificationEnum.InlineCode, "<htmlonly>", ""), (null, " in the generated XML output. The command is equivalent to pasting the contents of the file in the documentation and placing ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\htmlonly", "https://www.doxygen.nl/manual/commands.html#cmdhtmlonly"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endhtmlonly", "https://www.doxygen.nl/manual/commands.html#cmdendhtmlonly"), (null, " commands around it.\n\nNormally the contents of the file indicated by ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\htmlinclude", "https://www.doxygen.nl/manual/commands.html#cmdhtmlinclude"), (null, " is inserted as-is. When you want to insert a HTML fragment that has block scope like a table or list which should appear outside <p>..</p>, this can lead to invalid HTML. You can use ", ""), (ClassificationEnum.InlineCode, "\\htmlinclude[block]", ""), (null, " to make doxygen end the current paragraph and restart after the file is included.\n\nFiles or directories that doxygen should look for can be specified using the ", ""), (null, "EXAMPLE_PATH", "https://www.doxygen.nl/manual/config.html#cfg_example_path"), (null, " tag of doxygen's configuration file.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\htmlonly", "https://www.doxygen.nl/manual/commands.html#cmdhtmlonly"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\latexinclude", "https://www.doxygen.nl/manual/commands.html#cmdlatexinclude"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\rtfinclude", "https://www.doxygen.nl/manual/commands.html#cmdrtfinclude"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\maninclude", "https://www.doxygen.nl/manual/commands.html#cmdmaninclude"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\docbookinclude", "https://www.doxygen.nl/manual/commands.html#cmddocbookinclude"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\xmlinclude", "https://www.doxygen.nl/manual/commands.html#cmdxmlinclude"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("latexinclude",           "<file-name>",                                                                     "https://www.doxygen.nl/manual/commands.html#cmdlatexinclude",           new (object, string, string)[]{ (null, "This command includes the contents of the file <file-name> as is in the LaTeX documentation and tagged with ", ""), (ClassificationEnum.InlineCode, "<latexonly>", ""), (null, " in the generated XML output. The command is equivalent to pasting the contents of the file in the documentation and placing ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\latexonly", "https://www.doxygen.nl/manual/commands.html#cmdlatexonly"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endlatexonly", "https://www.doxygen.nl/manual/commands.html#cmdendlatexonly"), (null, " commands around it.\n\nFiles or directories that doxygen should look for can be specified using the ", ""), (null, "EXAMPLE_PATH", "https://www.doxygen.nl/manual/config.html#cfg_example_path"), (null, " tag of doxygen's configuration file.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\latexonly", "https://www.doxygen.nl/manual/commands.html#cmdlatexonly"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\htmlinclude", "https://www.doxygen.nl/manual/commands.html#cmdhtmlinclude"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\rtfinclude", "https://www.doxygen.nl/manual/commands.html#cmdrtfinclude"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\maninclude", "https://www.doxygen.nl/manual/commands.html#cmdmaninclude"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\docbookinclude", "https://www.doxygen.nl/manual/commands.html#cmddocbookinclude"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\xmlinclude", "https://www.doxygen.nl/manual/commands.html#cmdxmlinclude"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("rtfinclude",             "<file-name>",                                                                     "https://www.doxygen.nl/manual/commands.html#cmdrtfinclude",             new (object, string, string)[]{ (null, "This command includes the contents of the file <file-name> as is in the RTF documentation and tagged with ", ""), (ClassificationEnum.InlineCode, "<rtfonly>", ""), (null, " in the generated XML output. The command is equivalent to pasting the contents of the file in the documentation and placing ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\rtfonly", "https://www.doxygen.nl/manual/commands.html#cmdrtfonly"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endrtfonly", "https://www.doxygen.nl/manual/commands.html#cmdendrtfonly"), (null, " commands around it.\n\nFiles or directories that doxygen should look for can be specified using the ", ""), (null, "EXAMPLE_PATH", "https://www.doxygen.nl/manual/config.html#cfg_example_path"), (null, " tag of doxygen's configuration file.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\rtfonly", "https://www.doxygen.nl/manual/commands.html#cmdrtfonly"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\htmlinclude", "https://www.doxygen.nl/manual/commands.html#cmdhtmlinclude"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\latexinclude", "https://www.doxygen.nl/manual/commands.html#cmdlatexinclude"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\maninclude", "https://www.doxygen.nl/manual/commands.html#cmdmaninclude"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\docbookinclude", "https://www.doxygen.nl/manual/commands.html#cmddocbookinclude"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\xmlinclude", "https://www.doxygen.nl/manual/commands.html#cmdxmlinclude"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("maninclude",             "<file-name>",                                                                     "https://www.doxygen.nl/manual/commands.html#cmdmaninclude",             new (object, string, string)[]{ (null, "This command includes the contents of the file <file-name> as is in the MAN documentation and tagged with ", ""), (ClassificationEnum.InlineCode, "<manonly>", ""), (null, " in the generated XML output. The command is equivalent to pasting the contents of the file in the documentation and placing ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\manonly", "https://www.doxygen.nl/manual/commands.html#cmdmanonly"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endmanonly", "https://www.doxygen.nl/manual/commands.html#cmdendmanonly"), (null, " commands around it.\n\nFiles or directories that doxygen should look for can be specified using the ", ""), (null, "EXAMPLE_PATH", "https://www.doxygen.nl/manual/config.html#cfg_example_path"), (null, " tag of doxygen's configuration file.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\manonly", "https://www.doxygen.nl/manual/commands.html#cmdmanonly"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\htmlinclude", "https://www.doxygen.nl/manual/commands.html#cmdhtmlinclude"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\latexinclude", "https://www.doxygen.nl/manual/commands.html#cmdlatexinclude"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\rtfinclude", "https://www.doxygen.nl/manual/commands.html#cmdrtfinclude"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\docbookinclude", "https://www.doxygen.nl/manual/commands.html#cmddocbookinclude"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\xmlinclude", "https://www.doxygen.nl/manual/commands.html#cmdxmlinclude"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("docbookinclude",         "<file-name>",                                                                     "https://www.doxygen.nl/manual/commands.html#cmddocbookinclude",         new (object, string, string)[]{ (null, "This command includes the contents of the file <file-name> as is in the DocBook documentation and tagged with ", ""), (ClassificationEnum.InlineCode, "<docbookonly>", ""), (null, " in the generated XML output. The command is equivalent to pasting the contents of the file in the documentation and placing ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\docbookonly", "https://www.doxygen.nl/manual/commands.html#cmddocbookonly"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\enddocbookonly", "https://www.doxygen.nl/manual/commands.html#cmdenddocbookonly"), (null, " commands around it.\n\nFiles or directories that doxygen should look for can be specified using the ", ""), (null, "EXAMPLE_PATH", "https://www.doxygen.nl/manual/config.html#cfg_example_path"), (null, " tag of doxygen's configuration file.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\docbookonly", "https://www.doxygen.nl/manual/commands.html#cmddocbookonly"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\htmlinclude", "https://www.doxygen.nl/manual/commands.html#cmdhtmlinclude"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\latexinclude", "https://www.doxygen.nl/manual/commands.html#cmdlatexinclude"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\rtfinclude", "https://www.doxygen.nl/manual/commands.html#cmdrtfinclude"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\maninclude", "https://www.doxygen.nl/manual/commands.html#cmdmaninclude"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\xmlinclude", "https://www.doxygen.nl/manual/commands.html#cmdxmlinclude"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("xmlinclude",             "<file-name>",                                                                     "https://www.doxygen.nl/manual/commands.html#cmdxmlinclude",             new (object, string, string)[]{ (null, "This command includes contents of the file <file-name> as is in the XML documentation. The command is equivalent to pasting the contents of the file in the documentation and placing ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\xmlonly", "https://www.doxygen.nl/manual/commands.html#cmdxmlonly"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endxmlonly", "https://www.doxygen.nl/manual/commands.html#cmdendxmlonly"), (null, " commands around it.\n\nFiles or directories that doxygen should look for can be specified using the ", ""), (null, "EXAMPLE_PATH", "https://www.doxygen.nl/manual/config.html#cfg_example_path"), (null, " tag of doxygen's configuration file.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\xmlonly", "https://www.doxygen.nl/manual/commands.html#cmdxmlonly"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\htmlinclude", "https://www.doxygen.nl/manual/commands.html#cmdhtmlinclude"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\latexinclude", "https://www.doxygen.nl/manual/commands.html#cmdlatexinclude"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\rtfinclude", "https://www.doxygen.nl/manual/commands.html#cmdrtfinclude"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\maninclude", "https://www.doxygen.nl/manual/commands.html#cmdmaninclude"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\docbookinclude", "https://www.doxygen.nl/manual/commands.html#cmddocbookinclude"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("a",                      "<word>",                                                                          "https://www.doxygen.nl/manual/commands.html#cmda",                      new (object, string, string)[]{ (null, "Displays the argument <word> in italics. Use this command to emphasize words. Use this command to refer to member arguments in the running text.\n\nExample: ", ""), (ClassificationEnum.InlineCode, "\n     ... the \\a x and \\a y coordinates are used to ...\n\n", ""), (null, " This will result in the following text:\n\n ... the ", ""), (ClassificationEnum.EmphasisMinor, "x", ""), (null, " and ", ""), (ClassificationEnum.EmphasisMinor, "y", ""), (null, " coordinates are used to ...\n\nEquivalent to ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\e", "https://www.doxygen.nl/manual/commands.html#cmde"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\em", "https://www.doxygen.nl/manual/commands.html#cmdem"), (null, ". To emphasize multiple words use ", ""), (null, "<em>", "https://www.doxygen.nl/manual/htmlcmds.html#htmltag_EM"), (null, "multiple words", ""), (null, "</em>", "https://www.doxygen.nl/manual/htmlcmds.html#htmltag_endEM"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("arg",                    "{ item-description }",                                                            "https://www.doxygen.nl/manual/commands.html#cmdarg",                    new (object, string, string)[]{ (null, "This command has one argument that continues until the first blank line or until another ", ""), (ClassificationEnum.InlineCode, "\\arg", ""), (null, " is encountered. The command can be used to generate a simple, not nested list of arguments. Each argument should start with a ", ""), (ClassificationEnum.InlineCode, "\\arg", ""), (null, " command.\n\nExample: Typing: ", ""), (ClassificationEnum.InlineCode, "\n     \\arg \\c AlignLeft left alignment.\n     \\arg \\c AlignCenter center alignment.\n     \\arg \\c AlignRight right alignment\n   \n     No other types of alignment are supported.\n\n", ""), (null, " will result in the following text:\n\n\n    • ", ""), (ClassificationEnum.InlineCode, "AlignLeft", ""), (null, " left alignment. \n    • ", ""), (ClassificationEnum.InlineCode, "AlignCenter", ""), (null, " center alignment. \n    • ", ""), (ClassificationEnum.InlineCode, "AlignRight", ""), (null, " right alignment \n\n\n No other types of alignment are supported.\n\nNote: For nested lists, HTML commands should be used.\n\nEquivalent to ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\li", "https://www.doxygen.nl/manual/commands.html#cmdli"), }),
-      new DoxygenHelpPageCommand("b",                      "<word>",                                                                          "https://www.doxygen.nl/manual/commands.html#cmdb",                      new (object, string, string)[]{ (null, "Displays the argument <word> using a bold font. Equivalent to ", ""), (null, "<b>", "https://www.doxygen.nl/manual/htmlcmds.html#htmltag_B"), (null, "word", ""), (null, "</b>", "https://www.doxygen.nl/manual/htmlcmds.html#htmltag_endB"), (null, ". To put multiple words in bold use ", ""), (null, "<b>", "https://www.doxygen.nl/manual/htmlcmds.html#htmltag_B"), (null, "multiple words", ""), (null, "</b>", "https://www.doxygen.nl/manual/htmlcmds.html#htmltag_endB"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("c",                      "<word>",                                                                          "https://www.doxygen.nl/manual/commands.html#cmdc",                      new (object, string, string)[]{ (null, "Displays the argument <word> using a typewriter font. Use this to refer to a word of code. Equivalent to ", ""), (null, "<tt>", "https://www.doxygen.nl/manual/htmlcmds.html#htmltag_TT"), (null, "word", ""), (null, "</tt>", "https://www.doxygen.nl/manual/htmlcmds.html#htmltag_endTT"), (null, ".\n\nExample: Typing: ", ""), (ClassificationEnum.InlineCode, "\n        ... This function returns \\c void and not \\c int ...\n\n", ""), (null, " will result in the following text:\n\n ... This function returns ", ""), (ClassificationEnum.InlineCode, "void", ""), (null, " and not ", ""), (ClassificationEnum.InlineCode, "int", ""), (null, " ...\n\nEquivalent to ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\p", "https://www.doxygen.nl/manual/commands.html#cmdp"), (null, ". To have multiple words in typewriter font use ", ""), (null, "<tt>", "https://www.doxygen.nl/manual/htmlcmds.html#htmltag_TT"), (null, "multiple words", ""), (null, "</tt>", "https://www.doxygen.nl/manual/htmlcmds.html#htmltag_endTT"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("code",                   "['{'<word>'}']",                                                                  "https://www.doxygen.nl/manual/commands.html#cmdcode",                   new (object, string, string)[]{ (null, "Starts a block of code. A code block is treated differently from ordinary text. It is interpreted as source code. The names of classes and members and other documented entities are automatically replaced by links to the documentation.\n\nBy default the language that is assumed for syntax highlighting is based on the location where the ", ""), (ClassificationEnum.InlineCode, "\\code", ""), (null, " block was found. If this part of a Python file for instance, the syntax highlight will be done according to the Python syntax.\n\nIf it is unclear from the context which language is meant (for instance the comment is in a ", ""), (ClassificationEnum.InlineCode, ".txt", ""), (null, " or ", ""), (ClassificationEnum.InlineCode, ".markdown", ""), (null, " file) then you can also explicitly indicate the language, by putting the file extension typically that doxygen associated with the language in curly brackets after the code block. Here is an example:\n\n", ""), (ClassificationEnum.InlineCode, "     \\code{.py}\n     class Python:\n        pass\n     \\endcode\n   \n     \\code{.cpp}\n     class Cpp {};\n     \\endcode\n\n", ""), (null, "If the contents of the code block are in a language that doxygen cannot parse, doxygen will just show the output as-is. You can make this explicit using .unparsed, or by giving some other extension that doxygen doesn't support, e.g.\n\n", ""), (ClassificationEnum.InlineCode, "     \\code{.unparsed}\n     Show this as-is please\n     \\endcode\n   \n     \\code{.sh}\n     echo \"This is a shell script\"\n     \\endcode\n\n", ""), (null, "See also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endcode", "https://www.doxygen.nl/manual/commands.html#cmdendcode"), (null, " and command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\verbatim", "https://www.doxygen.nl/manual/commands.html#cmdverbatim"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("copydoc",                "<link-object>",                                                                   "https://www.doxygen.nl/manual/commands.html#cmdcopydoc",                new (object, string, string)[]{ (null, "Copies a documentation block from the object specified by <link-object> and pastes it at the location of the command. This command can be useful to avoid cases where a documentation block would otherwise have to be duplicated or it can be used to extend the documentation of an inherited member.\n\nThe link object can point to a member (of a class, file or group), a class, a namespace, a group, a page, or a file (checked in that order). Note that if the object pointed to is a member (function, variable, typedef, etc), the compound (class, file, or group) containing it should also be documented for the copying to work.\n\nTo copy the documentation for a member of a class one can, for instance, put the following in the documentation:\n\n", ""), (ClassificationEnum.InlineCode, "     /*! @copydoc MyClass::myfunction()\n      *  More documentation.\n      */\n\n", ""), (null, "if the member is overloaded, you should specify the argument types explicitly (without spaces!), like in the following:\n\n", ""), (ClassificationEnum.InlineCode, "     //! @copydoc MyClass::myfunction(type1,type2)\n\n", ""), (null, "Qualified names are only needed if the context in which the documentation block is found requires them.\n\nThe ", ""), (ClassificationEnum.InlineCode, "\\copydoc", ""), (null, " command can be used recursively, but cycles in the ", ""), (ClassificationEnum.InlineCode, "\\copydoc", ""), (null, " relation will be broken and flagged as an error.\n\nNote that ", ""), (ClassificationEnum.InlineCode, "\\copydoc foo()", ""), (null, " is roughly equivalent to doing:\n", ""), (ClassificationEnum.InlineCode, "\n     \\brief \\copybrief foo()\n     \\details \\copydetails foo()\n\n", ""), (null, "See ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\copybrief", "https://www.doxygen.nl/manual/commands.html#cmdcopybrief"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\copydetails", "https://www.doxygen.nl/manual/commands.html#cmdcopydetails"), (null, " for copying only the brief or detailed part of the comment block.", ""), }),
-      new DoxygenHelpPageCommand("copybrief",              "<link-object>",                                                                   "https://www.doxygen.nl/manual/commands.html#cmdcopybrief",              new (object, string, string)[]{ (null, "Works in a similar way as ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\copydoc", "https://www.doxygen.nl/manual/commands.html#cmdcopydoc"), (null, " but will only copy the brief description, not the detailed documentation.", ""), }),
-      new DoxygenHelpPageCommand("copydetails",            "<link-object>",                                                                   "https://www.doxygen.nl/manual/commands.html#cmdcopydetails",            new (object, string, string)[]{ (null, "Works in a similar way as ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\copydoc", "https://www.doxygen.nl/manual/commands.html#cmdcopydoc"), (null, " but will only copy the detailed documentation, not the brief description.", ""), }),
-      new DoxygenHelpPageCommand("docbookonly",            "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmddocbookonly",            new (object, string, string)[]{ (null, "Starts a block of text that only will be verbatim included in the generated DocBook documentation and tagged with ", ""), (ClassificationEnum.InlineCode, "<docbookonly>", ""), (null, " in the generated XML output. The block ends with a ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\enddocbookonly", "https://www.doxygen.nl/manual/commands.html#cmdenddocbookonly"), (null, " command.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\manonly", "https://www.doxygen.nl/manual/commands.html#cmdmanonly"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\latexonly", "https://www.doxygen.nl/manual/commands.html#cmdlatexonly"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\rtfonly", "https://www.doxygen.nl/manual/commands.html#cmdrtfonly"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\xmlonly", "https://www.doxygen.nl/manual/commands.html#cmdxmlonly"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\htmlonly", "https://www.doxygen.nl/manual/commands.html#cmdhtmlonly"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\docbookinclude", "https://www.doxygen.nl/manual/commands.html#cmddocbookinclude"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("dot",                    "[\"caption\"] [<sizeindication>=<size>]",                                         "https://www.doxygen.nl/manual/commands.html#cmddot",                    new (object, string, string)[]{ (null, "Starts a text fragment which should contain a valid description of a dot graph. The text fragment ends with ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\enddot", "https://www.doxygen.nl/manual/commands.html#cmdenddot"), (null, ". Doxygen will pass the text on to dot and include the resulting image (and image map) into the output.\n\nThe first argument is optional and can be used to specify the caption that is displayed below the image. This argument has to be specified between quotes even if it does not contain any spaces. The quotes are stripped before the caption is displayed.\n\nThe second argument is also optional and can be used to specify the width or height of the image. For a description of the possibilities see the paragraph ", ""), (null, "Size indication", "https://www.doxygen.nl/manual/commands.html#image_sizeindicator"), (null, " with the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\image", "https://www.doxygen.nl/manual/commands.html#cmdimage"), (null, " command.\n\nThe nodes of a graph can be made clickable by using the URL attribute. By using the command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\ref", "https://www.doxygen.nl/manual/commands.html#cmdref"), (null, " inside the URL value you can conveniently link to an item inside doxygen. Here is an example:\n\n", ""), (ClassificationEnum.Note, "Note:", ""), (null, "\n	usage of this command requires that ", ""), (null, "HAVE_DOT", "https://www.doxygen.nl/manual/config.html#cfg_have_dot"), (null, " is set to ", ""), (ClassificationEnum.InlineCode, "YES", ""), (null, "\n	doxygen creates a temporary file that is automatically removed unless the ", ""), (null, "DOT_CLEANUP", "https://www.doxygen.nl/manual/config.html#cfg_dot_cleanup"), (null, " tag is set to ", ""), (ClassificationEnum.InlineCode, "NO", ""), (null, ".\n\n", ""), (ClassificationEnum.InlineCode, "   /*! class B */\n   class B {};\n    \n   /*! class C */\n   class C {};\n    \n   /*! \\mainpage\n    *\n    *  Class relations expressed via an inline dot graph:\n    *  \\dot\n    *  digraph example {\n    *      node [shape=record, fontname=Helvetica, fontsize=10];\n    *      b [ label=\"class B\" URL=\"\\ref B\"];\n    *      c [ label=\"class C\" URL=\"\\ref C\"];\n    *      b -> c [ arrowhead=\"open\", style=\"dashed\" ];\n    *  }\n    *  \\enddot\n    *  Note that the classes in the above graph are clickable\n    *  (in the HTML output).\n    */", ""), }),
-      new DoxygenHelpPageCommand("emoji",                  "\"name\"",                                                                        "https://www.doxygen.nl/manual/commands.html#cmdemoji",                  new (object, string, string)[]{ (null, "This command will produce an emoji character given its name.\n\nThe supported names are the ones also supported by GitHub and listed here ", ""), (null, "https://gist.github.com/rxaviers/7360908", "https://gist.github.com/rxaviers/7360908"), (null, "\n\nYou can use the name with or without colons, i.e. ", ""), (ClassificationEnum.InlineCode, "\\emoji smile", ""), (null, " is the same as writing ", ""), (ClassificationEnum.InlineCode, "\\emoji :smile:", ""), (null, ". When an emoji is not supported the name with by places in the text with in between colons, i.e. ", ""), (ClassificationEnum.InlineCode, "\\emoji unsupported", ""), (null, " will produce ", ""), (ClassificationEnum.InlineCode, ":unsupported:", ""), (null, " in the output. Doxygen will also give a warning message.\n\nSee also the ", ""), (null, "emoji support page", "https://www.doxygen.nl/manual/emojisup.html"), (null, " for details.", ""), }),
-      new DoxygenHelpPageCommand("msc",                    "[\"caption\"] [<sizeindication>=<size>]",                                         "https://www.doxygen.nl/manual/commands.html#cmdmsc",                    new (object, string, string)[]{ (null, "Starts a text fragment which should contain a valid description of a message sequence chart. See ", ""), (null, "https://www.mcternan.me.uk/mscgen/", "https://www.mcternan.me.uk/mscgen/"), (null, " for examples. The text fragment ends with ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endmsc", "https://www.doxygen.nl/manual/commands.html#cmdendmsc"), (null, ".\n\nThe first argument is optional and can be used to specify the caption that is displayed below the image. This argument has to be specified between quotes even if it does not contain any spaces. The quotes are stripped before the caption is displayed.\n\nThe second argument is also optional and can be used to specify the width or height of the image. For a description of the possibilities see the paragraph ", ""), (null, "Size indication", "https://www.doxygen.nl/manual/commands.html#image_sizeindicator"), (null, " with the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\image", "https://www.doxygen.nl/manual/commands.html#cmdimage"), (null, " command.\n\n", ""), (ClassificationEnum.Note, "Note:", ""), (null, "\n	The text fragment should only include the part of the message sequence chart that is within the ", ""), (ClassificationEnum.InlineCode, "msc {...}", ""), (null, " block (this is different from ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\mscfile", "https://www.doxygen.nl/manual/commands.html#cmdmscfile"), (null, ").\n	mscgen is now built in into doxygen\n	doxygen creates a temporary file that is automatically removed unless the ", ""), (null, "DOT_CLEANUP", "https://www.doxygen.nl/manual/config.html#cfg_dot_cleanup"), (null, " tag is set to ", ""), (ClassificationEnum.InlineCode, "NO", ""), (null, ".\n\nHere is an example of the use of the ", ""), (ClassificationEnum.InlineCode, "\\msc", ""), (null, " command.\n", ""), (ClassificationEnum.InlineCode, "\n   /** Sender class. Can be used to send a command to the server.\n    *  The receiver will acknowledge the command by calling Ack().\n    *  \\msc\n    *    Sender,Receiver;\n    *    Sender->Receiver [label=\"Command()\", URL=\"\\ref Receiver::Command()\"];\n    *    Sender<-Receiver [label=\"Ack()\", URL=\"\\ref Ack()\", ID=\"1\"];\n    *  \\endmsc\n    */\n   class Sender\n   {\n    public:\n       /** Acknowledgment from server */\n    void Ack(bool ok);\n   };\n    \n   /** Receiver class. Can be used to receive and execute commands.\n    *  After execution of a command, the receiver will send an acknowledgment\n    *  \\msc\n    *    Receiver,Sender;\n    *    Receiver<-Sender [label=\"Command()\", URL=\"\\ref Command()\"];\n    *    Receiver->Sender [label=\"Ack()\", URL=\"\\ref Sender::Ack()\", ID=\"1\"];\n    *  \\endmsc\n    */\n   class Receiver\n   {\n    public:\n       /** Executable a command on the server */\n    void Command(int commandId);\n   };\n\n", ""), (null, "See also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\mscfile", "https://www.doxygen.nl/manual/commands.html#cmdmscfile"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("startuml",               "['{'option[,option]'}'] [\"caption\"] [<sizeindication>=<size>]",                 "https://www.doxygen.nl/manual/commands.html#cmdstartuml",               new (object, string, string)[]{ (null, "Starts a text fragment which should contain a valid description of a PlantUML diagram. See ", ""), (null, "https://plantuml.com/", "https://plantuml.com/"), (null, " for examples. The text fragment ends with ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\enduml", "https://www.doxygen.nl/manual/commands.html#cmdenduml"), (null, ".\n\n", ""), (ClassificationEnum.Note, "Note:", ""), (null, "\n	You need to install Java and the PlantUML's jar file, if you want to use this command. When using PlantUML in LaTeX you have to download some more ", ""), (ClassificationEnum.InlineCode, "jar", ""), (null, " files, for details see the PlantUML documentation. This also is valid for the ", ""), (ClassificationEnum.InlineCode, "<engine>", ""), (null, "s ", ""), (ClassificationEnum.InlineCode, "latex", ""), (null, " and ", ""), (ClassificationEnum.InlineCode, "math", ""), (null, ". The location of the PlantUML file should be specified using ", ""), (null, "PLANTUML_JAR_PATH", "https://www.doxygen.nl/manual/config.html#cfg_plantuml_jar_path"), (null, ". The other jar files should also reside in this directory.\n	The use of the ", ""), (ClassificationEnum.InlineCode, "<engine>", ""), (null, " ", ""), (ClassificationEnum.InlineCode, "ditaa", ""), (null, " is not possible in LaTeX as PlantUML only supports the ", ""), (ClassificationEnum.InlineCode, "png", ""), (null, " format and doxygen requires, temporary, ", ""), (ClassificationEnum.InlineCode, "eps", ""), (null, " output.\n\nNot all diagrams can be created with the PlantUML ", ""), (ClassificationEnum.InlineCode, "@startuml", ""), (null, " command but need another PlantUML ", ""), (ClassificationEnum.InlineCode, "@start...", ""), (null, " command. This will look like ", ""), (ClassificationEnum.InlineCode, "@start<engine>", ""), (null, " where currently supported are the following ", ""), (ClassificationEnum.InlineCode, "<engine>", ""), (null, "s: ", ""), (ClassificationEnum.InlineCode, "uml", ""), (null, ", ", ""), (ClassificationEnum.InlineCode, "bpm", ""), (null, ", ", ""), (ClassificationEnum.InlineCode, "wire", ""), (null, ", ", ""), (ClassificationEnum.InlineCode, "dot", ""), (null, ", ", ""), (ClassificationEnum.InlineCode, "ditaa", ""), (null, ", ", ""), (ClassificationEnum.InlineCode, "salt", ""), (null, ", ", ""), (ClassificationEnum.InlineCode, "math", ""), (null, ", ", ""), (ClassificationEnum.InlineCode, "latex", ""), (null, ", ", ""), (ClassificationEnum.InlineCode, "gantt", ""), (null, ", ", ""), (ClassificationEnum.InlineCode, "mindmap", ""), (null, ", ", ""), (ClassificationEnum.InlineCode, "wbs", ""), (null, ", ", ""), (ClassificationEnum.InlineCode, "yaml", ""), (null, ", ", ""), (ClassificationEnum.InlineCode, "creole", ""), (null, ", ", ""), (ClassificationEnum.InlineCode, "json", ""), (null, ", ", ""), (ClassificationEnum.InlineCode, "flow", ""), (null, ", ", ""), (ClassificationEnum.InlineCode, "board", ""), (null, ", ", ""), (ClassificationEnum.InlineCode, "git", ""), (null, ", ", ""), (ClassificationEnum.InlineCode, "hcl", ""), (null, ", ", ""), (ClassificationEnum.InlineCode, "regex", ""), (null, " and ", ""), (ClassificationEnum.InlineCode, "ebnf", ""), (null, ". By default the ", ""), (ClassificationEnum.InlineCode, "<engine>", ""), (null, " is ", ""), (ClassificationEnum.InlineCode, "uml", ""), (null, ". The ", ""), (ClassificationEnum.InlineCode, "<engine>", ""), (null, " can be specified as an option. Also the file to write the resulting image to can be specified by means of an option, see the description of the first (optional) argument for details. Of course only one ", ""), (ClassificationEnum.InlineCode, "<engine>", ""), (null, " can be specified and also the filename can only be specified once.\n\nThe first argument is optional and is for compatibility with running PlantUML as a preprocessing step before running doxygen, you can also add the name of the image file after ", ""), (ClassificationEnum.InlineCode, "\\startuml", ""), (null, " and inside curly brackets as option, i.e.\n", ""), (ClassificationEnum.InlineCode, "\n     @startuml{myimage.png} \"Image Caption\" width=5cm\n     Alice -> Bob : Hello\n     @enduml\n\n", ""), (null, "When the name of the image is specified, doxygen will generate an image with that name. Without the name doxygen will choose a name automatically.\n\nThe second argument is optional and can be used to specify the caption that is displayed below the image. This argument has to be specified between quotes even if it does not contain any spaces. The quotes are stripped before the caption is displayed.\n\nThe third argument is also optional and can be used to specify the width or height of the image. For a description of the possibilities see the paragraph ", ""), (null, "Size indication", "https://www.doxygen.nl/manual/commands.html#image_sizeindicator"), (null, " with the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\image", "https://www.doxygen.nl/manual/commands.html#cmdimage"), (null, " command.\n\n", ""), (ClassificationEnum.Note, "Note:", ""), (null, "\n	doxygen does not support the Plantuml commands like ", ""), (ClassificationEnum.InlineCode, "@startjson", ""), (null, ", by design, directly but the support can be accomplished, by the user, by adding to the doxygen settings file: ", ""), (ClassificationEnum.InlineCode, "\n     ALIASES += startjson=@startuml{json}\n     ALIASES += endjson=@enduml", ""), (null, "\n	doxygen creates a temporary file that is automatically removed unless the ", ""), (null, "DOT_CLEANUP", "https://www.doxygen.nl/manual/config.html#cfg_dot_cleanup"), (null, " tag is set to ", ""), (ClassificationEnum.InlineCode, "NO", ""), (null, ".\n\nHere is an example of the use of the ", ""), (ClassificationEnum.InlineCode, "\\startuml", ""), (null, " command.\n", ""), (ClassificationEnum.InlineCode, "\n   /** Sender class. Can be used to send a command to the server.\n    *  The receiver will acknowledge the command by calling Ack().\n    *  \\startuml\n    *    Sender->Receiver  : Command()\n    *    Sender<--Receiver : Ack()\n    *  \\enduml\n    */\n   class Sender\n   {\n    public:\n       /** Acknowledgment from server */\n    void Ack(bool ok);\n   };\n    \n   /** Receiver class. Can be used to receive and execute commands.\n    *  After execution of a command, the receiver will send an acknowledgment\n    *  \\startuml\n    *    Receiver<-Sender  : Command()\n    *    Receiver-->Sender : Ack()\n    *  \\enduml\n    */\n   class Receiver\n   {\n    public:\n       /** Executable a command on the server */\n    void Command(int commandId);\n   };", ""), }),
-      new DoxygenHelpPageCommand("dotfile",                "<file> [\"caption\"] [<sizeindication>=<size>]",                                  "https://www.doxygen.nl/manual/commands.html#cmddotfile",                new (object, string, string)[]{ (null, "Inserts an image generated by dot from <file> into the documentation.\n\nThe first argument specifies the file name of the image. doxygen will look for files in the paths (or files) that you specified after the ", ""), (null, "DOTFILE_DIRS", "https://www.doxygen.nl/manual/config.html#cfg_dotfile_dirs"), (null, " tag. If the dot file is found it will be used as an input file to the dot tool. The resulting image will be put into the correct output directory. If the dot file name contains spaces you'll have to put quotes (\"...\") around it.\n\nThe second argument is optional and can be used to specify the caption that is displayed below the image. This argument has to be specified between quotes even if it does not contain any spaces. The quotes are stripped before the caption is displayed.\n\nThe third argument is also optional and can be used to specify the width or height of the image. For a description of the possibilities see the paragraph ", ""), (null, "Size indication", "https://www.doxygen.nl/manual/commands.html#image_sizeindicator"), (null, " with the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\image", "https://www.doxygen.nl/manual/commands.html#cmdimage"), (null, " command.\n\n", ""), (ClassificationEnum.Note, "Note:", ""), (null, " usage of this command requires that ", ""), (null, "HAVE_DOT", "https://www.doxygen.nl/manual/config.html#cfg_have_dot"), (null, " is set to ", ""), (ClassificationEnum.InlineCode, "YES", ""), (null, "\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\dot", "https://www.doxygen.nl/manual/commands.html#cmddot"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("mscfile",                "<file> [\"caption\"] [<sizeindication>=<size>]",                                  "https://www.doxygen.nl/manual/commands.html#cmdmscfile",                new (object, string, string)[]{ (null, "Inserts an image generated by mscgen from <file> into the documentation. See ", ""), (null, "https://www.mcternan.me.uk/mscgen/", "https://www.mcternan.me.uk/mscgen/"), (null, " for examples.\n\nThe first argument specifies the file name of the image. doxygen will look for files in the paths (or files) that you specified after the ", ""), (null, "MSCFILE_DIRS", "https://www.doxygen.nl/manual/config.html#cfg_mscfile_dirs"), (null, " tag. If the msc file is found it will be used as an input file to the built in mscgen tool. The resulting image will be put into the correct output directory. If the msc file name contains spaces you'll have to put quotes (\"...\") around it.\n\nThe second argument is optional and can be used to specify the caption that is displayed below the image. This argument has to be specified between quotes even if it does not contain any spaces. The quotes are stripped before the caption is displayed.\n\nThe third argument is also optional and can be used to specify the width or height of the image. For a description of the possibilities see the paragraph ", ""), (null, "Size indication", "https://www.doxygen.nl/manual/commands.html#image_sizeindicator"), (null, " with the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\image", "https://www.doxygen.nl/manual/commands.html#cmdimage"), (null, " command.\n\n", ""), (ClassificationEnum.Note, "Note:", ""), (null, " The text fragment should include the part message of the sequence chart as well as the starting ", ""), (ClassificationEnum.InlineCode, "msc {", ""), (null, " and ending ", ""), (ClassificationEnum.InlineCode, "}", ""), (null, " (this is different from ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\msc", "https://www.doxygen.nl/manual/commands.html#cmdmsc"), (null, ").\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\msc", "https://www.doxygen.nl/manual/commands.html#cmdmsc"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("diafile",                "<file> [\"caption\"] [<sizeindication>=<size>]",                                  "https://www.doxygen.nl/manual/commands.html#cmddiafile",                new (object, string, string)[]{ (null, "Inserts an image made in dia from <file> into the documentation.\n\nThe first argument specifies the file name of the image. doxygen will look for files in the paths (or files) that you specified after the ", ""), (null, "DIAFILE_DIRS", "https://www.doxygen.nl/manual/config.html#cfg_diafile_dirs"), (null, " tag. If the dia file is found it will be used as an input file dia. The resulting image will be put into the correct output directory. If the dia file name contains spaces you'll have to put quotes (\"...\") around it.\n\nThe second argument is optional and can be used to specify the caption that is displayed below the image. This argument has to be specified between quotes even if it does not contain any spaces. The quotes are stripped before the caption is displayed.\n\nThe third argument is also optional and can be used to specify the width or height of the image. For a description of the possibilities see the paragraph ", ""), (null, "Size indication", "https://www.doxygen.nl/manual/commands.html#image_sizeindicator"), (null, " with the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\image", "https://www.doxygen.nl/manual/commands.html#cmdimage"), (null, " command.", ""), }),
-      new DoxygenHelpPageCommand("doxyconfig",             "<config_option>",                                                                 "https://www.doxygen.nl/manual/commands.html#cmddoxyconfig",             new (object, string, string)[]{ (null, "Displays the value of the configuration option ", ""), (ClassificationEnum.InlineCode, "<config_option>", ""), (null, " as used in doxygen's configuration file that is in use when this command is processed.\n\nExample: When creating this manual the following: ", ""), (ClassificationEnum.InlineCode, "\n     ... Project name = \\doxyconfig PROJECT_NAME ...\n\n", ""), (null, " gives:\n ... Project name = Manual ...", ""), }),
-      new DoxygenHelpPageCommand("e",                      "<word>",                                                                          "https://www.doxygen.nl/manual/commands.html#cmde",                      new (object, string, string)[]{ (null, "Displays the argument <word> in italics. Use this command to emphasize words.\n\nExample: Typing: ", ""), (ClassificationEnum.InlineCode, "\n     ... this is a \\e really good example ...\n\n", ""), (null, " will result in the following text:\n\n ... this is a ", ""), (ClassificationEnum.EmphasisMinor, "really", ""), (null, " good example ...\n\nEquivalent to ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\a", "https://www.doxygen.nl/manual/commands.html#cmda"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\em", "https://www.doxygen.nl/manual/commands.html#cmdem"), (null, ". To emphasize multiple words use ", ""), (null, "<em>", "https://www.doxygen.nl/manual/htmlcmds.html#htmltag_EM"), (null, "multiple words", ""), (null, "</em>", "https://www.doxygen.nl/manual/htmlcmds.html#htmltag_endEM"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("em",                     "<word>",                                                                          "https://www.doxygen.nl/manual/commands.html#cmdem",                     new (object, string, string)[]{ (null, "Displays the argument <word> in italics. Use this command to emphasize words.\n\nExample: Typing: ", ""), (ClassificationEnum.InlineCode, "\n     ... this is a \\em really good example ...\n\n", ""), (null, " will result in the following text:\n\n ... this is a ", ""), (ClassificationEnum.EmphasisMinor, "really", ""), (null, " good example ...\n\nEquivalent to ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\a", "https://www.doxygen.nl/manual/commands.html#cmda"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\e", "https://www.doxygen.nl/manual/commands.html#cmde"), (null, ". To emphasize multiple words use ", ""), (null, "<em>", "https://www.doxygen.nl/manual/htmlcmds.html#htmltag_EM"), (null, "multiple words", ""), (null, "</em>", "https://www.doxygen.nl/manual/htmlcmds.html#htmltag_endEM"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("endcode",                "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdendcode",                new (object, string, string)[]{ (null, "Ends a block of code.\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\code", "https://www.doxygen.nl/manual/commands.html#cmdcode"), }),
-      new DoxygenHelpPageCommand("enddocbookonly",         "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdenddocbookonly",         new (object, string, string)[]{ (null, "Ends a block of text that was started with a ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\docbookonly", "https://www.doxygen.nl/manual/commands.html#cmddocbookonly"), (null, " command.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\docbookonly", "https://www.doxygen.nl/manual/commands.html#cmddocbookonly"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("enddot",                 "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdenddot",                 new (object, string, string)[]{ (null, "Ends a block that was started with ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\dot", "https://www.doxygen.nl/manual/commands.html#cmddot"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("endmsc",                 "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdendmsc",                 new (object, string, string)[]{ (null, "Ends a block that was started with ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\msc", "https://www.doxygen.nl/manual/commands.html#cmdmsc"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("enduml",                 "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdenduml",                 new (object, string, string)[]{ (null, "Ends a block that was started with ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\startuml", "https://www.doxygen.nl/manual/commands.html#cmdstartuml"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("endhtmlonly",            "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdendhtmlonly",            new (object, string, string)[]{ (null, "Ends a block of text that was started with a ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\htmlonly", "https://www.doxygen.nl/manual/commands.html#cmdhtmlonly"), (null, " command.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\htmlonly", "https://www.doxygen.nl/manual/commands.html#cmdhtmlonly"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("endlatexonly",           "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdendlatexonly",           new (object, string, string)[]{ (null, "Ends a block of text that was started with a ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\latexonly", "https://www.doxygen.nl/manual/commands.html#cmdlatexonly"), (null, " command.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\latexonly", "https://www.doxygen.nl/manual/commands.html#cmdlatexonly"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("endmanonly",             "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdendmanonly",             new (object, string, string)[]{ (null, "Ends a block of text that was started with a ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\manonly", "https://www.doxygen.nl/manual/commands.html#cmdmanonly"), (null, " command.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\manonly", "https://www.doxygen.nl/manual/commands.html#cmdmanonly"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("endrtfonly",             "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdendrtfonly",             new (object, string, string)[]{ (null, "Ends a block of text that was started with a ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\rtfonly", "https://www.doxygen.nl/manual/commands.html#cmdrtfonly"), (null, " command.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\rtfonly", "https://www.doxygen.nl/manual/commands.html#cmdrtfonly"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("endverbatim",            "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdendverbatim",            new (object, string, string)[]{ (null, "Ends a block of text that was started with a ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\verbatim", "https://www.doxygen.nl/manual/commands.html#cmdverbatim"), (null, " command.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\verbatim", "https://www.doxygen.nl/manual/commands.html#cmdverbatim"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("endxmlonly",             "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdendxmlonly",             new (object, string, string)[]{ (null, "Ends a block of text that was started with a ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\xmlonly", "https://www.doxygen.nl/manual/commands.html#cmdxmlonly"), (null, " command.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\xmlonly", "https://www.doxygen.nl/manual/commands.html#cmdxmlonly"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("f$",                     "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdfdollar",                new (object, string, string)[]{ (null, "Marks the start and end of an in-text formula.\nSee also: command ", ""), (null, "formulas", "https://www.doxygen.nl/manual/formulas.html"), (null, " for an example.", ""), }),
-      new DoxygenHelpPageCommand("f(",                     "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdfrndopen",               new (object, string, string)[]{ (null, "Marks the start of an in-text formula, but contrary to ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\f$", "https://www.doxygen.nl/manual/commands.html#cmdfdollar"), (null, " it will not explicitly open the math-mode in LaTeX.\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\f)", "https://www.doxygen.nl/manual/commands.html#cmdfrndclose"), (null, " and command ", ""), (null, "formulas", "https://www.doxygen.nl/manual/formulas.html"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("f)",                     "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdfrndclose",              new (object, string, string)[]{ (null, "Marks the end of an in-text formula started with ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\f(", "https://www.doxygen.nl/manual/commands.html#cmdfrndopen"), (null, ".\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\f(", "https://www.doxygen.nl/manual/commands.html#cmdfrndopen"), (null, " and command ", ""), (null, "formulas", "https://www.doxygen.nl/manual/formulas.html"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("f[",                     "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdfbropen",                new (object, string, string)[]{ (null, "Marks the start of a long formula that is displayed centered on a separate line.\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\f]", "https://www.doxygen.nl/manual/commands.html#cmdfbrclose"), (null, " and command ", ""), (null, "formulas", "https://www.doxygen.nl/manual/formulas.html"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("f]",                     "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdfbrclose",               new (object, string, string)[]{ (null, "Marks the end of a long formula that is displayed centered on a separate line.\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\f[", "https://www.doxygen.nl/manual/commands.html#cmdfbropen"), (null, " and command ", ""), (null, "formulas", "https://www.doxygen.nl/manual/formulas.html"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("f{environment}{",        "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdfcurlyopen",             new (object, string, string)[]{ (null, "Marks the start of a formula that is in a specific environment.\n\n", ""), (ClassificationEnum.Note, "Note:", ""), (null, " The second ", ""), (ClassificationEnum.InlineCode, "{", ""), (null, " is optional and is only to help editors (such as ", ""), (ClassificationEnum.InlineCode, "Vim", ""), (null, ") to do proper syntax highlighting by making the number of opening and closing braces the same.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\f}", "https://www.doxygen.nl/manual/commands.html#cmdfcurlyclose"), (null, " and command ", ""), (null, "formulas", "https://www.doxygen.nl/manual/formulas.html"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("f}",                     "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdfcurlyclose",            new (object, string, string)[]{ (null, "Marks the end of a formula that is in a specific environment.\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\f{", "https://www.doxygen.nl/manual/commands.html#cmdfcurlyopen"), (null, " and command ", ""), (null, "formulas", "https://www.doxygen.nl/manual/formulas.html"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("htmlonly",               "[\"[block]\"]",                                                                   "https://www.doxygen.nl/manual/commands.html#cmdhtmlonly",               new (object, string, string)[]{ (null, "Starts a block of text that only will be verbatim included in the generated HTML documentation and tagged with ", ""), (ClassificationEnum.InlineCode, "<htmlonly>", ""), (null, " in the generated XML output. The block ends with a ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endhtmlonly", "https://www.doxygen.nl/manual/commands.html#cmdendhtmlonly"), (null, " command.\n\nThis command can be used to include HTML code that is too complex for doxygen (i.e. applets, java-scripts, and HTML tags that require specific attributes).\n\nNormally the contents between ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\htmlonly", "https://www.doxygen.nl/manual/commands.html#cmdhtmlonly"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endhtmlonly", "https://www.doxygen.nl/manual/commands.html#cmdendhtmlonly"), (null, " is inserted as-is. When you want to insert a HTML fragment that has block scope like a table or list which should appear outside <p>..</p>, this can lead to invalid HTML. You can use ", ""), (ClassificationEnum.InlineCode, "\\htmlonly[block]", ""), (null, " to make doxygen end the current paragraph and restart it after \\endhtmlonly.\n\n", ""), (ClassificationEnum.Note, "Note:", ""), (null, " environment variables (like $(HOME) ) are resolved inside a HTML-only block.\n\nSee also: command ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\manonly", "https://www.doxygen.nl/manual/commands.html#cmdmanonly"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\latexonly", "https://www.doxygen.nl/manual/commands.html#cmdlatexonly"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\rtfonly", "https://www.doxygen.nl/manual/commands.html#cmdrtfonly"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\xmlonly", "https://www.doxygen.nl/manual/commands.html#cmdxmlonly"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\docbookonly", "https://www.doxygen.nl/manual/commands.html#cmddocbookonly"), (null, ", and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\htmlinclude", "https://www.doxygen.nl/manual/commands.html#cmdhtmlinclude"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("image",                  "['{'option[,option]'}'] <format> <file> [\"caption\"] [<sizeindication>=<size>]", "https://www.doxygen.nl/manual/commands.html#cmdimage",                  new (object, string, string)[]{ (null, "Inserts an image into the documentation. This command is format specific, so if you want to insert an image for more than one format you'll have to repeat this command for each format.\n\nThe first argument specifies the output format in which the image should be embedded. Currently, the following values are supported: ", ""), (ClassificationEnum.InlineCode, "html", ""), (null, ", ", ""), (ClassificationEnum.InlineCode, "latex", ""), (null, ", ", ""), (ClassificationEnum.InlineCode, "docbook", ""), (null, ", ", ""), (ClassificationEnum.InlineCode, "rtf", ""), (null, " and ", ""), (ClassificationEnum.InlineCode, "xml", ""), (null, ".\n\nThe second argument specifies the file name of the image. doxygen will look for files in the paths (or files) that you specified after the ", ""), (null, "IMAGE_PATH", "https://www.doxygen.nl/manual/config.html#cfg_image_path"), (null, " tag. If the image is found it will be copied to the correct output directory. If the image name contains spaces you'll have to put quotes (\"...\") around the name. You can also specify an absolute URL instead of a file name, but then doxygen does not copy the image nor check its existence.\n\nThe third argument is optional and can be used to specify the caption that is displayed below the image. This argument has to be specified on a single line and between quotes even if it does not contain any spaces. The quotes are stripped before the caption is displayed.\n\nThe fourth argument is also optional and can be used to specify the width or height of the image. This can be useful for LaTeX or DocBook output (i.e. format=", ""), (ClassificationEnum.InlineCode, "latex", ""), (null, " or format=", ""), (ClassificationEnum.InlineCode, "docbook", ""), (null, ").\nSize indication The ", ""), (ClassificationEnum.InlineCode, "sizeindication", ""), (null, " can specify the width or height to be used (or a combination). The size specifier in LaTeX (for example ", ""), (ClassificationEnum.InlineCode, "10cm", ""), (null, " or ", ""), (ClassificationEnum.InlineCode, "4in", ""), (null, " or a symbolic width like ", ""), (ClassificationEnum.InlineCode, "\\textwidth", ""), (null, ").\n\nCurrently only the options ", ""), (ClassificationEnum.InlineCode, "inline", ""), (null, " and ", ""), (ClassificationEnum.InlineCode, "anchor", ""), (null, " are supported. In case the option ", ""), (ClassificationEnum.InlineCode, "inline", ""), (null, " is specified the image is placed \"in the line\", when a caption is present it is shown in HTML as tooltip (ignored for the other formats). For the ", ""), (ClassificationEnum.InlineCode, "anchor", ""), (null, " option the syntax is: ", ""), (ClassificationEnum.InlineCode, "anchor:<anchorId>", ""), (null, ".\n\nHere is example of a comment block:\n\n", ""), (ClassificationEnum.InlineCode, "     /*! Here is a snapshot of my new application:\n      *  \\image html application.jpg\n      *  \\image latex application.eps \"My application\" width=10cm\n      */\n\n", ""), (null, "And this is an example of how the relevant part of the configuration file may look:\n\n", ""), (ClassificationEnum.InlineCode, "     IMAGE_PATH     = my_image_dir\n\n", ""), (null, "\n", ""), (ClassificationEnum.Warning, "Warning:", ""), (null, " The image format for HTML is limited to what your browser supports.\nFor LaTeX, the image format must be supported by the LaTeX ", ""), (ClassificationEnum.InlineCode, "\\includegraphics", ""), (null, " command i.e. Encapsulated PostScript (eps), Portable network graphics (png), Joint photographic experts group (jpg / jpeg). \n\n Doxygen does not check if the image is in the correct format. So ", ""), (ClassificationEnum.EmphasisMinor, "you", ""), (null, " have to make sure this is the case!", ""), }),
-      new DoxygenHelpPageCommand("latexonly",              "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdlatexonly",              new (object, string, string)[]{ (null, "Starts a block of text that only will be verbatim included in the generated LaTeX documentation and tagged with ", ""), (ClassificationEnum.InlineCode, "<latexonly>", ""), (null, " in the generated XML output. The block ends with a ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endlatexonly", "https://www.doxygen.nl/manual/commands.html#cmdendlatexonly"), (null, " command.\n\nThis command can be used to include LaTeX code that is too complex for doxygen (i.e. images, formulas, special characters). You can use the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\htmlonly", "https://www.doxygen.nl/manual/commands.html#cmdhtmlonly"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endhtmlonly", "https://www.doxygen.nl/manual/commands.html#cmdendhtmlonly"), (null, " pair to provide a proper HTML alternative.\n\nNote: environment variables (like $(HOME) ) are resolved inside a LaTeX-only block.\n\nSee also: commands ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\rtfonly", "https://www.doxygen.nl/manual/commands.html#cmdrtfonly"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\xmlonly", "https://www.doxygen.nl/manual/commands.html#cmdxmlonly"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\manonly", "https://www.doxygen.nl/manual/commands.html#cmdmanonly"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\htmlonly", "https://www.doxygen.nl/manual/commands.html#cmdhtmlonly"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\docbookonly", "https://www.doxygen.nl/manual/commands.html#cmddocbookonly"), (null, ", and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\latexinclude", "https://www.doxygen.nl/manual/commands.html#cmdlatexinclude"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("manonly",                "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdmanonly",                new (object, string, string)[]{ (null, "Starts a block of text that only will be verbatim included in the generated MAN documentation and tagged with ", ""), (ClassificationEnum.InlineCode, "<manonly>", ""), (null, " in the generated XML output. The block ends with a ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endmanonly", "https://www.doxygen.nl/manual/commands.html#cmdendmanonly"), (null, " command.\n\nThis command can be used to include groff code directly into MAN pages. You can use the ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\htmlonly", "https://www.doxygen.nl/manual/commands.html#cmdhtmlonly"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endhtmlonly", "https://www.doxygen.nl/manual/commands.html#cmdendhtmlonly"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\latexonly", "https://www.doxygen.nl/manual/commands.html#cmdlatexonly"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endlatexonly", "https://www.doxygen.nl/manual/commands.html#cmdendlatexonly"), (null, " pairs to provide proper HTML and LaTeX alternatives.\n\nSee also: commands ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\htmlonly", "https://www.doxygen.nl/manual/commands.html#cmdhtmlonly"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\xmlonly", "https://www.doxygen.nl/manual/commands.html#cmdxmlonly"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\rtfonly", "https://www.doxygen.nl/manual/commands.html#cmdrtfonly"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\latexonly", "https://www.doxygen.nl/manual/commands.html#cmdlatexonly"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\docbookonly", "https://www.doxygen.nl/manual/commands.html#cmddocbookonly"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\maninclude", "https://www.doxygen.nl/manual/commands.html#cmdmaninclude"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("li",                     "{ item-description }",                                                            "https://www.doxygen.nl/manual/commands.html#cmdli",                     new (object, string, string)[]{ (null, "This command has one argument that continues until the first blank line or until another ", ""), (ClassificationEnum.InlineCode, "\\li", ""), (null, " is encountered. The command can be used to generate a simple, not nested list of arguments. Each argument should start with a ", ""), (ClassificationEnum.InlineCode, "\\li", ""), (null, " command.\n\nExample: Typing: ", ""), (ClassificationEnum.InlineCode, "\n     \\li \\c AlignLeft left alignment.\n     \\li \\c AlignCenter center alignment.\n     \\li \\c AlignRight right alignment\n   \n     No other types of alignment are supported.\n\n", ""), (null, " will result in the following text:\n\n\n    • ", ""), (ClassificationEnum.InlineCode, "AlignLeft", ""), (null, " left alignment. \n    • ", ""), (ClassificationEnum.InlineCode, "AlignCenter", ""), (null, " center alignment. \n    • ", ""), (ClassificationEnum.InlineCode, "AlignRight", ""), (null, " right alignment \n\n\n No other types of alignment are supported.\n\nNote: For nested lists, HTML commands should be used.\n\nEquivalent to ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\arg", "https://www.doxygen.nl/manual/commands.html#cmdarg"), }),
-      new DoxygenHelpPageCommand("n",                      "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdn",                      new (object, string, string)[]{ (null, "Forces a new line. Equivalent to ", ""), (null, "<br>", "https://www.doxygen.nl/manual/htmlcmds.html#htmltag_BR"), (null, " and inspired by the ", ""), (ClassificationEnum.InlineCode, "printf", ""), (null, " function.", ""), }),
-      new DoxygenHelpPageCommand("p",                      "<word>",                                                                          "https://www.doxygen.nl/manual/commands.html#cmdp",                      new (object, string, string)[]{ (null, "Displays the parameter <word> using a typewriter font. You can use this command to refer to member function parameters in the running text.\n\nExample: ", ""), (ClassificationEnum.InlineCode, "\n     ... the \\p x and \\p y coordinates are used to ...\n\n", ""), (null, " This will result in the following text:\n\n ... the ", ""), (ClassificationEnum.InlineCode, "x", ""), (null, " and ", ""), (ClassificationEnum.InlineCode, "y", ""), (null, " coordinates are used to ...\n\nEquivalent to ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\c", "https://www.doxygen.nl/manual/commands.html#cmdc"), (null, ". To have multiple words in typewriter font use ", ""), (null, "<tt>", "https://www.doxygen.nl/manual/htmlcmds.html#htmltag_TT"), (null, "multiple words", ""), (null, "</tt>", "https://www.doxygen.nl/manual/htmlcmds.html#htmltag_endTT"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("rtfonly",                "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdrtfonly",                new (object, string, string)[]{ (null, "Starts a block of text that only will be verbatim included in the generated RTF documentation and tagged with ", ""), (ClassificationEnum.InlineCode, "<rtfonly>", ""), (null, " in the generated XML output. The block ends with a ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endrtfonly", "https://www.doxygen.nl/manual/commands.html#cmdendrtfonly"), (null, " command.\n\nThis command can be used to include RTF code that is too complex for doxygen.\n\nNote: environment variables (like $(HOME) ) are resolved inside a RTF-only block.\n\nSee also: commands ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\manonly", "https://www.doxygen.nl/manual/commands.html#cmdmanonly"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\xmlonly", "https://www.doxygen.nl/manual/commands.html#cmdxmlonly"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\latexonly", "https://www.doxygen.nl/manual/commands.html#cmdlatexonly"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\htmlonly", "https://www.doxygen.nl/manual/commands.html#cmdhtmlonly"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\docbookonly", "https://www.doxygen.nl/manual/commands.html#cmddocbookonly"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\rtfinclude", "https://www.doxygen.nl/manual/commands.html#cmdrtfinclude"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("verbatim",               "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdverbatim",               new (object, string, string)[]{ (null, "Starts a block of text that will be verbatim included in the documentation. The block should end with a ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endverbatim", "https://www.doxygen.nl/manual/commands.html#cmdendverbatim"), (null, " command. All commands are disabled in a verbatim block.\n\n", ""), (ClassificationEnum.Warning, "Warning:", ""), (null, " Make sure you include a ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endverbatim", "https://www.doxygen.nl/manual/commands.html#cmdendverbatim"), (null, " command for each ", ""), (ClassificationEnum.InlineCode, "\\verbatim", ""), (null, " command or the parser will get confused!\n\nSee also: commands ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\code", "https://www.doxygen.nl/manual/commands.html#cmdcode"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endverbatim", "https://www.doxygen.nl/manual/commands.html#cmdendverbatim"), (null, " and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\verbinclude", "https://www.doxygen.nl/manual/commands.html#cmdverbinclude"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("xmlonly",                "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdxmlonly",                new (object, string, string)[]{ (null, "Starts a block of text that only will be verbatim included in the generated XML output. The block ends with a ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\endxmlonly", "https://www.doxygen.nl/manual/commands.html#cmdendxmlonly"), (null, " command.\n\nThis command can be used to include custom XML tags.\n\nSee also: commands ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\manonly", "https://www.doxygen.nl/manual/commands.html#cmdmanonly"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\rtfonly", "https://www.doxygen.nl/manual/commands.html#cmdrtfonly"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\latexonly", "https://www.doxygen.nl/manual/commands.html#cmdlatexonly"), (null, ", ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\htmlonly", "https://www.doxygen.nl/manual/commands.html#cmdhtmlonly"), (null, ", and ", ""), (DoxygenHelpPageCommand.OtherTypesEnum.Command, "\\docbookonly", "https://www.doxygen.nl/manual/commands.html#cmddocbookonly"), (null, ".", ""), }),
-      new DoxygenHelpPageCommand("\\",                     "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdbackslash",              new (object, string, string)[]{ (null, "This command writes a backslash character (", ""), (ClassificationEnum.InlineCode, "\\", ""), (null, ") to the output. The backslash has to be escaped in some cases because doxygen uses it to detect commands.", ""), }),
-      new DoxygenHelpPageCommand("@",                      "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdat",                     new (object, string, string)[]{ (null, "This command writes an at-sign (", ""), (ClassificationEnum.InlineCode, "@", ""), (null, ") to the output. The at-sign has to be escaped in some cases because doxygen uses it to detect Javadoc commands.", ""), }),
-      new DoxygenHelpPageCommand("~",                      "[LanguageId]",                                                                    "https://www.doxygen.nl/manual/commands.html#cmdtilde",                  new (object, string, string)[]{ (null, "This command enables/disables a language specific filter. This can be used to put documentation for different language into one comment block and use the ", ""), (null, "OUTPUT_LANGUAGE", "https://www.doxygen.nl/manual/config.html#cfg_output_language"), (null, " tag to filter out only a specific language. Use ", ""), (ClassificationEnum.InlineCode, "\\~language_id", ""), (null, " to enable output for a specific language only and ", ""), (ClassificationEnum.InlineCode, "\\~", ""), (null, " to enable output for all languages (this is also the default mode).\n\nExample:\n", ""), (ClassificationEnum.InlineCode, "\n   /*! \\~english This is English \\~dutch Dit is Nederlands \\~german Dies ist\n       Deutsch. \\~ output for all languages.\n    */", ""), }),
-      new DoxygenHelpPageCommand("&",                      "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdamp",                    new (object, string, string)[]{ (null, "This command writes the ", ""), (ClassificationEnum.InlineCode, "&", ""), (null, " character to the output. This character has to be escaped because it has a special meaning in HTML.", ""), }),
-      new DoxygenHelpPageCommand("$",                      "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmddollar",                 new (object, string, string)[]{ (null, "This command writes the ", ""), (ClassificationEnum.InlineCode, "$", ""), (null, " character to the output. This character has to be escaped in some cases, because it is used to expand environment variables.", ""), }),
-      new DoxygenHelpPageCommand("#",                      "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdhash",                   new (object, string, string)[]{ (null, "This command writes the ", ""), (ClassificationEnum.InlineCode, "#", ""), (null, " character to the output. This character has to be escaped in some cases, because it is used to refer to documented entities.", ""), }),
-      new DoxygenHelpPageCommand("<",                      "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdlt",                     new (object, string, string)[]{ (null, "This command writes the ", ""), (ClassificationEnum.InlineCode, "<", ""), (null, " character to the output. This character has to be escaped because it has a special meaning in HTML.", ""), }),
-      new DoxygenHelpPageCommand(">",                      "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdgt",                     new (object, string, string)[]{ (null, "This command writes the ", ""), (ClassificationEnum.InlineCode, ">", ""), (null, " character to the output. This character has to be escaped because it has a special meaning in HTML.", ""), }),
-      new DoxygenHelpPageCommand("%",                      "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdperc",                   new (object, string, string)[]{ (null, "This command writes the ", ""), (ClassificationEnum.InlineCode, "%", ""), (null, " character to the output. This character has to be escaped in some cases, because it is used to prevent auto-linking to a word that is also a documented class or struct.", ""), }),
-      new DoxygenHelpPageCommand("\"",                     "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdquot",                   new (object, string, string)[]{ (null, "This command writes the ", ""), (ClassificationEnum.InlineCode, "\"", ""), (null, " character to the output. This character has to be escaped in some cases, because it is used in pairs to indicate an unformatted text fragment.", ""), }),
-      new DoxygenHelpPageCommand(".",                      "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdchardot",                new (object, string, string)[]{ (null, "This command writes a dot (", ""), (ClassificationEnum.InlineCode, ".", ""), (null, ") to the output. This can be useful to prevent ending a brief description when ", ""), (null, "JAVADOC_AUTOBRIEF", "https://www.doxygen.nl/manual/config.html#cfg_javadoc_autobrief"), (null, " is enabled or to prevent starting a numbered list when the dot follows a number at the start of a line.", ""), }),
-      new DoxygenHelpPageCommand("=",                      "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdeq",                     new (object, string, string)[]{ (null, "This command writes an equal sign (", ""), (ClassificationEnum.InlineCode, "=", ""), (null, ") to the output. This character sequence has to be escaped in some cases, because it is used in Markdown header processing.", ""), }),
-      new DoxygenHelpPageCommand("::",                     "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmddcolon",                 new (object, string, string)[]{ (null, "This command writes a double colon (", ""), (ClassificationEnum.InlineCode, "::", ""), (null, ") to the output. This character sequence has to be escaped in some cases, because it is used to reference to documented entities.", ""), }),
-      new DoxygenHelpPageCommand("|",                      "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdpipe",                   new (object, string, string)[]{ (null, "This command writes a pipe symbol (|) to the output. This character has to be escaped in some cases, because it is used for Markdown tables.", ""), }),
-      new DoxygenHelpPageCommand("--",                     "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdndash",                  new (object, string, string)[]{ (null, "This command writes two dashes (--) to the output. This allows writing two consecutive dashes to the output instead of one n-dash character (–).", ""), }),
-      new DoxygenHelpPageCommand("---",                    "",                                                                                "https://www.doxygen.nl/manual/commands.html#cmdmdash",                  new (object, string, string)[]{ (null, "This command writes three dashes (---) to the output. This allows writing three consecutive dashes to the output instead of one m-dash character (—).", ""), }),
-    };
+    public static readonly DoxygenHelpPageCommand[] cCommands;
+
+
+    static DoxygenCommandsGeneratedFromHelpPage()
+    {
+      using (BinaryReader reader = OpenCommandsResource()) {
+        ReadAndCheckHeader(reader);
+
+        int numCommands = reader.ReadInt32();
+        cCommands = new DoxygenHelpPageCommand[numCommands];
+        for (int cmdIdx = 0; cmdIdx < numCommands; ++cmdIdx) {
+          string command = reader.ReadString();
+          string parameters = reader.ReadString();
+          string hyperlink = reader.ReadString();
+          int descriptionOffset = reader.ReadInt32();
+          int numFragments = reader.ReadInt32();
+          cCommands[cmdIdx] = new DoxygenHelpPageCommand(
+            command, parameters, hyperlink,
+            () => ReadDescription(descriptionOffset, numFragments));
+        }
+      }
+    }
+
+
+    /// <summary>
+    /// Deserializes the description fragments of a single command from the embedded resource. Gets called
+    /// lazily via the Description property of DoxygenHelpPageCommand, and at most once per command (the
+    /// property caches the result).
+    /// </summary>
+    private static (object type, string text, string hyperlink)[] ReadDescription(int descriptionOffset, int numFragments)
+    {
+      using (BinaryReader reader = OpenCommandsResource()) {
+        reader.BaseStream.Seek(descriptionOffset, SeekOrigin.Begin);
+
+        var fragments = new (object type, string text, string hyperlink)[numFragments];
+        for (int fragmentIdx = 0; fragmentIdx < numFragments; ++fragmentIdx) {
+          byte kind = reader.ReadByte();
+          string text = reader.ReadString();
+          string hyperlink = reader.ReadString();
+          fragments[fragmentIdx] = (MapFragmentKindToType(kind), text, hyperlink);
+        }
+        return fragments;
+      }
+    }
+
+
+    /// <summary>
+    /// Maps the fragment kind stored in the binary file to the "type" element used in the Description
+    /// property of DoxygenHelpPageCommand. The kind values match the FragmentType enumeration of the
+    /// Python script ParseDoxygenCommandHelpPage.py.
+    /// </summary>
+    private static object MapFragmentKindToType(byte kind)
+    {
+      switch (kind) {
+        case 1: return null; // Ordinary text
+        case 2: return ClassificationEnum.InlineCode;
+        case 3: return ClassificationEnum.EmphasisMinor;
+        case 4: return ClassificationEnum.Note;
+        case 5: return ClassificationEnum.Warning;
+        case 6: return DoxygenHelpPageCommand.OtherTypesEnum.Command;
+        default:
+          throw new VSDoxyHighlighterException(
+            $"Unknown fragment kind {kind} in the binary resource with the Doxygen commands.");
+      }
+    }
+
+
+    private static BinaryReader OpenCommandsResource()
+    {
+      Assembly assembly = typeof(DoxygenCommandsGeneratedFromHelpPage).Assembly;
+
+      // The full resource name contains the default namespace and folder names. Searching for the filename
+      // instead of hardcoding the full name makes this robust against changes of the project structure.
+      string resourceName = Array.Find(
+        assembly.GetManifestResourceNames(), name => name.EndsWith(cResourceFilename));
+      if (resourceName == null) {
+        throw new VSDoxyHighlighterException(
+          $"Embedded resource '{cResourceFilename}' with the Doxygen commands not found.");
+      }
+
+      Stream stream = assembly.GetManifestResourceStream(resourceName);
+      if (stream == null) {
+        throw new VSDoxyHighlighterException(
+          $"Failed to open embedded resource '{resourceName}' with the Doxygen commands.");
+      }
+      return new BinaryReader(stream, Encoding.UTF8);
+    }
+
+
+    private static void ReadAndCheckHeader(BinaryReader reader)
+    {
+      uint magic = reader.ReadUInt32();
+      uint version = reader.ReadUInt32();
+      if (magic != cExpectedMagic || version != cExpectedFormatVersion) {
+        throw new VSDoxyHighlighterException(
+          "The binary resource with the Doxygen commands has an unexpected format "
+          + $"(magic=0x{magic:X}, version={version}). The resource and the extension are out of sync.");
+      }
+    }
+
+
+    // The bytes "VSDC" (for "Visual Studio Doxygen Commands"), read as little endian uint32.
+    private const uint cExpectedMagic = 0x43445356;
+
+    // Must match BINARY_FORMAT_VERSION in ParseDoxygenCommandHelpPage.py. To be incremented
+    // together whenever the binary format changes.
+    private const uint cExpectedFormatVersion = 1;
+
+    private const string cResourceFilename = "DoxygenCommandsGeneratedFromHelpPage.bin";
   }
 }
@@ -38,14 +38,20 @@ namespace VSDoxyHighlighter
     public readonly string Hyperlink;
 
     /// <summary>
-    /// The description of the Doxygen command: The string is just the concatenation of the 
+    /// The description of the Doxygen command: The string is just the concatenation of the
     /// individual strings. However, we also have some semantic information:
     /// - If the first item is null, then it is ordinary text.
     /// - If the first item is a ClassificationEnum, then we apply that classification as-is.
     /// - If the first item is a OtherTypesEnum, then we convert it to a ClassificationEnum taking
     ///   into account the user settings.
+    /// Note that the commands coming from the binary resource (i.e. almost all of them) deserialize
+    /// their description lazily when this property is accessed the first time; compare
+    /// DoxygenCommandsGeneratedFromHelpPage. The descriptions are by far the largest part of the help
+    /// page data, but they are only needed once the user actually views the description of a command.
     /// </summary>
-    public readonly (object type, string text, string hyperlink)[] Description;
+    public (object type, string text, string hyperlink)[] Description {
+      get { return mDescriptionHolder.GetOrLoad(); }
+    }
 
 
     public DoxygenHelpPageCommand(string command, string parameters, string hyperlink, (object type, string text, string hyperlink)[] description)
@@ -53,8 +59,69 @@ namespace VSDoxyHighlighter
       Command = command;
       Parameters = parameters;
       Hyperlink = hyperlink;
-      Description = description;
+      mDescriptionHolder = new LazyDescription(description);
+    }
+
+
+    public DoxygenHelpPageCommand(string command, string parameters, string hyperlink, Func<(object type, string text, string hyperlink)[]> descriptionLoader)
+    {
+      Command = command;
+      Parameters = parameters;
+      Hyperlink = hyperlink;
+      mDescriptionHolder = new LazyDescription(descriptionLoader);
+    }
+
+
+    /// <summary>
+    /// Creates a variation of the given command (e.g. "param[in]" as variation of "param") that shares
+    /// the parameters, the hyperlink and especially the (possibly not yet loaded) description with the
+    /// original command. I.e. creating the variation does not force the deserialization of the original
+    /// command's description, and once one of the two gets loaded, both share the same array.
+    /// </summary>
+    public DoxygenHelpPageCommand(string command, DoxygenHelpPageCommand variationOf)
+    {
+      Command = command;
+      Parameters = variationOf.Parameters;
+      Hyperlink = variationOf.Hyperlink;
+      mDescriptionHolder = variationOf.mDescriptionHolder;
     }
+
+
+    /// <summary>
+    /// Holds either the already materialized description fragments, or the loader that produces them
+    /// on demand. Shared between a command and its variations.
+    /// </summary>
+    private sealed class LazyDescription
+    {
+      public LazyDescription((object type, string text, string hyperlink)[] description)
+      {
+        mDescription = description;
+      }
+
+      public LazyDescription(Func<(object type, string text, string hyperlink)[]> loader)
+      {
+        mLoader = loader;
+      }
+
+      public (object type, string text, string hyperlink)[] GetOrLoad()
+      {
+        // Note the lock: The quick info accesses descriptions on the main thread, while the autocomplete
+        // constructs its descriptions on a background thread. The lock ensures that the loader runs at
+        // most once and that its result is published safely.
+        lock (this) {
+          if (mDescription == null) {
+            mDescription = mLoader();
+            mLoader = null;
+          }
+          return mDescription;
+        }
+      }
+
+      private Func<(object type, string text, string hyperlink)[]> mLoader;
+      private (object type, string text, string hyperlink)[] mDescription;
+    }
+
+    private readonly LazyDescription mDescriptionHolder;
   }
 
 
@@ -96,6 +163,21 @@ namespace VSDoxyHighlighter
       ClassificationEnum commandClassification,
       bool showHyperlinks)
     {
+      // The description of a command depends only on the (static) help page data, the classification of the
+      // command itself and whether hyperlinks are desired. Especially, hovering along e.g. a "\param"-heavy
+      // comment block constructs the identical element over and over, and every construction runs the
+      // classification lookups for all commands embedded in the description. So cache the constructed
+      // elements; they are immutable and can be handed out to Visual Studio multiple times. The cache gets
+      // invalidated when the user changes the settings (the classifications might be different then).
+      // Note the lock: The quick info constructs descriptions on the main thread, but the autocomplete may
+      // do so from a background thread.
+      var cacheKey = (helpPageCmdInfo.Command, commandClassification, showHyperlinks);
+      lock (cDescriptionCache) {
+        if (cDescriptionCache.TryGetValue(cacheKey, out ClassifiedTextElement cachedDescription)) {
+          return cachedDescription;
+        }
+      }
+
       var runs = new List<ClassifiedTextRun>();
 
       // Add a line with the actual command.
@@ -148,7 +230,24 @@ namespace VSDoxyHighlighter
         }
       }
 
-      return new ClassifiedTextElement(runs);
+      var description = new ClassifiedTextElement(runs);
+      lock (cDescriptionCache) {
+        cDescriptionCache[cacheKey] = description;
+      }
+      return description;
+    }
+
+
+    /// <summary>
+    /// Throws away all cached description elements. Must be called when the Doxygen commands got updated
+    /// (i.e. on DoxygenCommands.CommandsGotUpdated), since the classifications embedded in the descriptions
+    /// might be different afterwards.
+    /// </summary>
+    public static void InvalidateDescriptionCache()
+    {
+      lock (cDescriptionCache) {
+        cDescriptionCache.Clear();
+      }
     }
 
 
@@ -273,6 +372,11 @@ namespace VSDoxyHighlighter
     }
 
 
+    // Caches the constructed description elements; see ConstructDescription(). Also serves as its own lock.
+    private static readonly Dictionary<(string command, ClassificationEnum classification, bool showHyperlinks), ClassifiedTextElement>
+      cDescriptionCache = new Dictionary<(string, ClassificationEnum, bool), ClassifiedTextElement>();
+
+
     private static void InsertCommandVariationAfterOriginal(List<DoxygenHelpPageCommand> commands, string originalCommand, string newCommand)
     {
       int idx = cAmendedDoxygenCommands.FindIndex(x => x.Command == originalCommand);
@@ -280,7 +384,9 @@ namespace VSDoxyHighlighter
         throw new VSDoxyHighlighterException($"Command '{originalCommand}' not found in list of Doxygen commands.");
       }
       DoxygenHelpPageCommand original = cAmendedDoxygenCommands[idx];
-      commands.Insert(idx + 1, new DoxygenHelpPageCommand(newCommand, original.Parameters, original.Hyperlink, original.Description));
+      // Note the dedicated constructor: It shares the lazily loaded description with the original command
+      // instead of forcing its deserialization here (which would happen if we accessed original.Description).
+      commands.Insert(idx + 1, new DoxygenHelpPageCommand(newCommand, original));
     }
   }
 }
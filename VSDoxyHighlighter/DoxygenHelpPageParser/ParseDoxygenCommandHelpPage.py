@@ -1,12 +1,15 @@
 # Script that parses the Doxygen command help page
 # https://www.doxygen.nl/manual/commands.html,
 # extracts the documentation for each command and
-# generates a C# file that exposes the information.
+# generates a compact binary file that is embedded
+# into the extension as a resource and read by
+# DoxygenCommandsGeneratedFromHelpPage.cs.
 
 import bs4
+import io
 import os
-from datetime import datetime
 import re
+import struct
 from enum import Enum
 from typing import Union
 
@@ -48,17 +51,16 @@ class ParsedCommand:
             raise Exception(f"Header does not start with '\\': {header}")
         (self.command, self.parameters) = split_command_header(header)
 
-        # Variants with escaped characters that are suitable to be written into a C# source file.
-        self.escaped_command = escape_characters(self.command)
-        self.escaped_parameters = escape_characters(self.parameters)
-        self.escaped_help_text = [Fragment(f.type, escape_characters(f.content), f.hyperlink) for f in self.help_text]
+        # Variants with normalized line endings that end up in the binary output file.
+        self.normalized_command = strip_carriage_returns(self.command)
+        self.normalized_parameters = strip_carriage_returns(self.parameters)
+        self.normalized_help_text = [Fragment(f.type, strip_carriage_returns(f.content), f.hyperlink) for f in self.help_text]
 
 
-def escape_characters(raw_string: str):
-    """ Escapes the given string such that it can be written to a C# source file."""
-    # Note: No need to maintain the carriage return in the C# source file; the newline character is sufficient
+def strip_carriage_returns(raw_string: str):
+    # Note: No need to maintain the carriage returns in the output file; the newline character is sufficient
     # for our purposes.
-    return raw_string.replace("\\", "\\\\").replace('"', '\\"').replace("\r", "").replace("\n", "\\n")
+    return raw_string.replace("\r", "")
 
 
 def split_command_header(header: str):
@@ -467,53 +469,70 @@ def strip_fragments(fragments: list[Fragment], to_strip: str = None) -> list[Fra
     return lstrip_fragments(rstrip_fragments(fragments, to_strip), to_strip)
 
 
-def generate_text_for_csharp_file(commands: list[ParsedCommand]) -> str:
-    python_file = os.path.basename(__file__)
-    current_time = datetime.now().strftime("%Y-%m-%d %H:%M:%S")
-    max_command_len, max_parameters_len, max_anchor_len = get_max_component_lengths(commands)
+# The binary format, read by DoxygenCommandsGeneratedFromHelpPage.cs:
+#   - uint32: magic bytes "VSDC" (to detect corrupted or foreign files)
+#   - uint32: format version
+#   - int32: number of commands
+#   - Index, one entry per command:
+#       string command, string parameters, string hyperlink,
+#       int32 absolute offset of the command's description within the file, int32 number of fragments
+#   - Descriptions, one fragment after the other:
+#       uint8 fragment type (the FragmentType value), string content, string hyperlink
+# All integers are little endian. Strings are UTF-8 with a 7-bit-encoded length prefix, compatible
+# with C#'s BinaryWriter/BinaryReader. The point of the index is that the C# side can cheaply read
+# all command names upfront while deserializing each (much larger) description lazily on first use.
 
-    s = f"// This file was automatically generated by the Python script\n"
-    s += f"// {python_file} on {current_time}.\n\n"
+BINARY_FORMAT_MAGIC = 0x43445356  # The bytes "VSDC" read as little endian uint32.
+BINARY_FORMAT_VERSION = 1  # Must match cExpectedFormatVersion in DoxygenCommandsGeneratedFromHelpPage.cs.
 
-    s += "namespace VSDoxyHighlighter\n"
-    s += "{\n"
-    s += "  class DoxygenCommandsGeneratedFromHelpPage\n"
-    s += "  {\n"
-    s += "    public static readonly DoxygenHelpPageCommand[] cCommands = {\n"
 
-    for cmd in commands:
-        command_padding = " " * (max_command_len - len(cmd.escaped_command))
-        parameters_padding = " " * (max_parameters_len - len(cmd.escaped_parameters))
-        anchor_padding = " " * (max_anchor_len - len(cmd.anchor))
-
-        s += f'      new DoxygenHelpPageCommand("{cmd.escaped_command}",{command_padding} "{cmd.escaped_parameters}",{parameters_padding} "{ONLINE_COMMAND_HELP_LINK}#{cmd.anchor}",{anchor_padding} new (object, string, string)[]{{ '
-        for fragment in cmd.escaped_help_text:
-            s += f'({map_fragment_type_to_csharp_type(fragment.type)}, "{fragment.content}", "{fragment.hyperlink}"), '
-        s += "}),\n"
+def write_7bit_encoded_int(f, value: int):
+    """Writes the length prefix the same way as C#'s BinaryWriter.Write(string) does."""
+    assert value >= 0
+    while value >= 0x80:
+        f.write(struct.pack("<B", (value & 0x7F) | 0x80))
+        value >>= 7
+    f.write(struct.pack("<B", value))
 
-    s += "    };\n"
-    s += "  }\n"
-    s += "}\n"
 
-    return s
+def write_string(f, s: str):
+    data = s.encode("utf-8")
+    write_7bit_encoded_int(f, len(data))
+    f.write(data)
 
 
-def map_fragment_type_to_csharp_type(type: FragmentType) -> str:
-    """Returns the appropriate enumeration value to be used in the C# code."""
-    if type == FragmentType.Text:
-        return "null"
-    elif type == FragmentType.Code:
-        return "ClassificationEnum.InlineCode"
-    elif type == FragmentType.Emphasis:
-        return "ClassificationEnum.EmphasisMinor"
-    elif type == FragmentType.Note:
-        return "ClassificationEnum.Note"
-    elif type == FragmentType.Warning:
-        return "ClassificationEnum.Warning"
-    elif type == FragmentType.Command:
-        return "DoxygenHelpPageCommand.OtherTypesEnum.Command"
-    else:
-        raise Exception("Unknown FragmentType")
+def generate_binary_command_file(commands: list[ParsedCommand], output_filename: str):
+    descriptions = io.BytesIO()
+    relative_offsets = []
+    for cmd in commands:
+        relative_offsets.append(descriptions.tell())
+        for fragment in cmd.normalized_help_text:
+            descriptions.write(struct.pack("<B", fragment.type.value))
+            write_string(descriptions, fragment.content)
+            write_string(descriptions, fragment.hyperlink)
+
+    def build_index(description_section_start: int) -> bytes:
+        index = io.BytesIO()
+        for (cmd, relative_offset) in zip(commands, relative_offsets):
+            write_string(index, cmd.normalized_command)
+            write_string(index, cmd.normalized_parameters)
+            write_string(index, f"{ONLINE_COMMAND_HELP_LINK}#{cmd.anchor}")
+            index.write(struct.pack("<i", description_section_start + relative_offset))
+            index.write(struct.pack("<i", len(cmd.normalized_help_text)))
+        return index.getvalue()
+
+    header_size = 12  # magic + version + number of commands
+    # The index size is independent of the offset values (they are fixed-width int32), so a dry run
+    # with dummy offsets yields the correct size for the absolute offsets of the real run.
+    index_size = len(build_index(0))
+    index_bytes = build_index(header_size + index_size)
+
+    with open(output_filename, "wb") as f:
+        f.write(struct.pack("<I", BINARY_FORMAT_MAGIC))
+        f.write(struct.pack("<I", BINARY_FORMAT_VERSION))
+        f.write(struct.pack("<i", len(commands)))
+        f.write(index_bytes)
+        f.write(descriptions.getvalue())
 
 
 def generate_debug_dump(commands: list[ParsedCommand]) -> str:
@@ -555,24 +574,11 @@ def fragment_list_to_string_for_debug(fragments: list[Fragment]) -> str:
     return s
 
 
-def get_max_component_lengths(commands: list[ParsedCommand]):
-    command_len = 0
-    parameters_len = 0
-    anchors_len = 0
-    for cmd in commands:
-        command_len = max(command_len, len(cmd.escaped_command))
-        parameters_len = max(parameters_len, len(cmd.escaped_parameters))
-        anchors_len = max(anchors_len, len(cmd.anchor))
-    return (command_len, parameters_len, anchors_len)
-
-
-def extract_and_convert_doxygen_commands_from_html(html_filename: str, output_csharp_filename: str, output_debug_dump_filename: str):
+def extract_and_convert_doxygen_commands_from_html(html_filename: str, output_binary_filename: str, output_debug_dump_filename: str):
     with open(html_filename, 'r', encoding='utf-8') as input_file:
         parsed_commands = parse_doxygen_help_html(input_file)
-    
-    csharp_text = generate_text_for_csharp_file(parsed_commands)
-    with open(output_csharp_filename, 'w', encoding='utf-8') as output_file:
-        output_file.write(csharp_text)
+
+    generate_binary_command_file(parsed_commands, output_binary_filename)
 
     dump_text = generate_debug_dump(parsed_commands)
     with open(output_debug_dump_filename, 'w', encoding='utf-8') as output_file:
@@ -585,5 +591,5 @@ if __name__ == "__main__":
         # The input html file is https://www.doxygen.nl/manual/commands.html
         # (simply saved via a browser).
         html_filename=os.path.join(main_folder, "testInput1.10.0.htm"),
-        output_csharp_filename=os.path.join(main_folder, "DoxygenCommandsGeneratedFromHelpPage.cs"),
+        output_binary_filename=os.path.join(main_folder, "DoxygenCommandsGeneratedFromHelpPage.bin"),
         output_debug_dump_filename=os.path.join(main_folder, "GeneratedDebugDump.txt"))
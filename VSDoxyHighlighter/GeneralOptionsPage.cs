@@ -82,8 +82,14 @@ namespace VSDoxyHighlighter
   public interface IGeneralOptions
   {
     bool EnableHighlighting { get; }
+    bool EnableMarkdownHighlighting { get; }
     bool EnableAutocomplete { get; }
     bool EnableQuickInfo { get; }
+    bool EnableParsingInBackground { get; }
+    bool EnableWholeDocumentPreWarm { get; }
+    bool EnablePersistentHighlightCache { get; }
+    bool EnablePerformanceLogging { get; }
+    int CacheMemoryBudgetMB { get; }
 
     bool EnableParameterAutocompleteFor_param { get; }
     bool EnableParameterAutocompleteFor_tparam { get; }
@@ -167,6 +173,14 @@ namespace VSDoxyHighlighter
       + "Note that with the settings below you can define in which comment types the highlighting is enabled.")]
     public bool EnableHighlighting { get; set; } = true;
 
+    [Category(FeaturesSubCategory)]
+    [DisplayName("Enable markdown highlighting")]
+    [Description("Enables the highlighting of the markdown styles in comments: *italic*, **bold**, "
+      + "_italic_, __bold__, ~~strikethrough~~ and `inline code`. If disabled, the corresponding matchers "
+      + "do not even run, which speeds up the parsing of comments a bit. The Doxygen commands themselves "
+      + "are unaffected.")]
+    public bool EnableMarkdownHighlighting { get; set; } = true;
+
     [Category(FeaturesSubCategory)]
     [DisplayName("Enable IntelliSense")]
     [Description("Enables the autocomplete of commands while typing in comments (\"IntelliSense\"): "
@@ -185,6 +199,51 @@ namespace VSDoxyHighlighter
 
     private bool mEnableAutocomplete = true;
     
+    [Category(FeaturesSubCategory)]
+    [DisplayName("Parse comments in the background")]
+    [Description("If enabled, the parsing of comments for the syntax highlighting happens on a background thread "
+      + "instead of blocking the Visual Studio UI thread. This keeps Visual Studio more responsive, especially when "
+      + "scrolling through large files with many comments. The highlighting of a comment might appear with a very "
+      + "short delay. Disable this option if you suspect that it causes issues.")]
+    public bool EnableParsingInBackground { get; set; } = true;
+
+    [Category(FeaturesSubCategory)]
+    [DisplayName("Pre-parse whole document when opening it")]
+    [Description("If enabled, the whole document gets parsed for the syntax highlighting shortly after it "
+      + "got opened, using multiple background threads. This way, scrolling through a large file directly "
+      + "after opening it does not stutter because of comments getting parsed on demand. The trade-off is "
+      + "additional CPU and memory usage for parts of documents that might never get viewed, which is why "
+      + "the option is disabled by default.")]
+    public bool EnableWholeDocumentPreWarm { get; set; } = false;
+
+    [Category(FeaturesSubCategory)]
+    [DisplayName("Cache highlighting of whole documents on disk")]
+    [Description("If enabled, the syntax highlighting computed for a whole document gets saved to a cache "
+      + "file in the local application data folder. Re-opening the document (also after a restart of Visual "
+      + "Studio) then restores the full highlighting instantly, as long as the document and the relevant "
+      + "settings did not change in the meantime. Most useful for large, rarely edited files. Implies the "
+      + "behavior of the whole document pre-parse whenever no up-to-date cache file exists yet.")]
+    public bool EnablePersistentHighlightCache { get; set; } = false;
+
+    [Category(FeaturesSubCategory)]
+    [DisplayName("Log performance statistics to the output window")]
+    [Description("If enabled, the extension periodically writes a summary of its internal performance "
+      + "counters (cache hit rates, parse times, etc.) to a \"VSDoxyHighlighter\" pane in the output "
+      + "window. Useful to attach to a bug report when Visual Studio feels slow with the extension "
+      + "enabled. Independent of this setting, detailed events can always be captured with an ETW tool "
+      + "via the \"VSDoxyHighlighter\" provider.")]
+    public bool EnablePerformanceLogging { get; set; } = false;
+
+    [Category(FeaturesSubCategory)]
+    [DisplayName("Highlighting cache memory budget (MB)")]
+    [Description("The extension caches the highlighting results of every open document to keep Visual Studio "
+      + "responsive. With very many open documents, these caches can consume a considerable amount of memory. "
+      + "This setting bounds the (approximate) total amount of memory used by the caches of all open documents "
+      + "together; when the bound is exceeded, the caches of the documents that were not viewed for the longest "
+      + "time get dropped (and simply get recomputed when the document is viewed again). A value of 0 disables "
+      + "the bound.")]
+    public int CacheMemoryBudgetMB { get; set; } = 50;
+
     [Category(FeaturesSubCategory)]
     [DisplayName("Enable quick info tooltips")]
     [Description("If enabled, hovering over a Doxygen command will display the help text of that command. "
@@ -0,0 +1,179 @@
+using System;
+using System.Diagnostics;
+using System.Diagnostics.Tracing;
+using System.Text;
+using System.Threading;
+
+namespace VSDoxyHighlighter
+{
+  /// <summary>
+  /// ETW provider of the extension. When a user reports that "Visual Studio is slow with the extension
+  /// enabled", the events allow attributing the latency in production without attaching a profiler to
+  /// devenv.exe, e.g. via:
+  ///    PerfView.exe collect /onlyProviders=*VSDoxyHighlighter
+  /// The per-operation events are emitted at verbose level and only if a listener actually enabled the
+  /// provider, so that the instrumentation costs nothing in the ordinary case.
+  /// </summary>
+  [EventSource(Name = "VSDoxyHighlighter")]
+  internal sealed class VSDoxyHighlighterEventSource : EventSource
+  {
+    public static readonly VSDoxyHighlighterEventSource Instance = new VSDoxyHighlighterEventSource();
+
+    private VSDoxyHighlighterEventSource() { }
+
+    [Event(1, Level = EventLevel.Verbose)]
+    public void ClassificationRequest(int spanLength, double milliseconds)
+    {
+      WriteEvent(1, spanLength, milliseconds);
+    }
+
+    [Event(2, Level = EventLevel.Verbose)]
+    public void CommentExtraction(int spanLength, double milliseconds)
+    {
+      WriteEvent(2, spanLength, milliseconds);
+    }
+
+    [Event(3, Level = EventLevel.Verbose)]
+    public void CommentParse(int textLength, double milliseconds)
+    {
+      WriteEvent(3, textLength, milliseconds);
+    }
+
+    [Event(4, Level = EventLevel.Warning)]
+    public void RegexTimeout()
+    {
+      WriteEvent(4);
+    }
+  }
+
+
+  /// <summary>
+  /// Lightweight always-on counters and accumulated times of the hot paths. Updated with Interlocked
+  /// operations (parsing runs concurrently on the UI thread and on thread pool threads), i.e. recording
+  /// costs a few nanoseconds per operation. The numbers can be inspected in a debugger or a memory dump;
+  /// additionally, the package can periodically write BuildSummary() to an output pane (opt-in setting),
+  /// so that users can attach the summary to a performance issue report.
+  /// </summary>
+  internal static class PerformanceMetrics
+  {
+    public static long NumClassificationRequests { get { return sNumClassificationRequests; } }
+    public static long NumParseSpanCalls { get { return sNumParseSpanCalls; } }
+    public static long NumParseSpanCacheHits { get { return sNumParseSpanCacheHits; } }
+    public static long NumCommentExtractions { get { return sNumCommentExtractions; } }
+    public static long NumParseCalls { get { return sNumParseCalls; } }
+    public static long NumRegexTimeouts { get { return sNumRegexTimeouts; } }
+
+
+    /// <summary>
+    /// Returns an opaque timestamp for one of the Record...() functions below. Costs a few nanoseconds.
+    /// </summary>
+    public static long StartTiming()
+    {
+      return Stopwatch.GetTimestamp();
+    }
+
+
+    public static void RecordClassificationRequest(long startTimestamp, int spanLength)
+    {
+      long elapsedTicks = Stopwatch.GetTimestamp() - startTimestamp;
+      Interlocked.Increment(ref sNumClassificationRequests);
+      Interlocked.Add(ref sClassificationTicks, elapsedTicks);
+      if (VSDoxyHighlighterEventSource.Instance.IsEnabled()) {
+        VSDoxyHighlighterEventSource.Instance.ClassificationRequest(spanLength, TicksToMilliseconds(elapsedTicks));
+      }
+    }
+
+
+    public static void RecordParseSpanCall(bool servedFromCache)
+    {
+      Interlocked.Increment(ref sNumParseSpanCalls);
+      if (servedFromCache) {
+        Interlocked.Increment(ref sNumParseSpanCacheHits);
+      }
+    }
+
+
+    public static void RecordCommentExtraction(long startTimestamp, int spanLength)
+    {
+      long elapsedTicks = Stopwatch.GetTimestamp() - startTimestamp;
+      Interlocked.Increment(ref sNumCommentExtractions);
+      Interlocked.Add(ref sCommentExtractionTicks, elapsedTicks);
+      if (VSDoxyHighlighterEventSource.Instance.IsEnabled()) {
+        VSDoxyHighlighterEventSource.Instance.CommentExtraction(spanLength, TicksToMilliseconds(elapsedTicks));
+      }
+    }
+
+
+    public static void RecordParse(long startTimestamp, int textLength)
+    {
+      long elapsedTicks = Stopwatch.GetTimestamp() - startTimestamp;
+      Interlocked.Increment(ref sNumParseCalls);
+      Interlocked.Add(ref sParseTicks, elapsedTicks);
+      if (VSDoxyHighlighterEventSource.Instance.IsEnabled()) {
+        VSDoxyHighlighterEventSource.Instance.CommentParse(textLength, TicksToMilliseconds(elapsedTicks));
+      }
+    }
+
+
+    public static void RecordRegexTimeout()
+    {
+      Interlocked.Increment(ref sNumRegexTimeouts);
+      if (VSDoxyHighlighterEventSource.Instance.IsEnabled()) {
+        VSDoxyHighlighterEventSource.Instance.RegexTimeout();
+      }
+    }
+
+
+    /// <summary>
+    /// Returns a human readable summary of all counters, including the more specialized ones that live
+    /// next to the code they count. The summary describes the whole process since its start.
+    /// </summary>
+    public static string BuildSummary()
+    {
+      var sb = new StringBuilder(1024);
+      sb.AppendLine($"===== VSDoxyHighlighter performance summary ({DateTime.Now:HH:mm:ss}) =====");
+      sb.AppendLine(
+        $"Classification requests: {sNumClassificationRequests} in {TicksToMilliseconds(sClassificationTicks):F1} ms total");
+      AppendWithRate(sb, "ParseSpan calls", sNumParseSpanCalls, "cache hits", sNumParseSpanCacheHits);
+      sb.AppendLine(
+        $"Comment extractions: {sNumCommentExtractions} in {TicksToMilliseconds(sCommentExtractionTicks):F1} ms total");
+      sb.AppendLine(
+        $"Comment parses: {sNumParseCalls} in {TicksToMilliseconds(sParseTicks):F1} ms total");
+      AppendWithRate(sb, "Parses", sNumParseCalls, "interned result hits", CommentParser.NumParseResultInternHits);
+      sb.AppendLine($"Intern store resets: {CommentParser.NumParseResultInternStoreResets}");
+      sb.AppendLine($"Regex timeouts: {sNumRegexTimeouts}");
+      sb.AppendLine(
+        $"Cache memory: {CommentClassifier.TotalCacheBytes} bytes; evictions: "
+        + $"{CommentClassifier.NumCacheEvictionsOfWholeDocuments} whole documents, "
+        + $"{CommentClassifier.NumCacheEvictionsOfSingleEntries} single entries");
+      AppendWithRate(sb, "VS cpp colorer reclassification events", CommentClassifier.NumCppColorerReclassificationEvents,
+        "coalesced", CommentClassifier.NumCoalescedCppColorerReclassifications);
+      sb.AppendLine($"Documents restored from the persistent cache: {CommentClassifier.NumPersistentCacheRestores}");
+      return sb.ToString();
+    }
+
+
+    private static void AppendWithRate(StringBuilder sb, string totalLabel, long total, string partLabel, long part)
+    {
+      double percent = total > 0 ? 100.0 * part / total : 0.0;
+      sb.AppendLine($"{totalLabel}: {total}, thereof {partLabel}: {part} ({percent:F1}%)");
+    }
+
+
+    private static double TicksToMilliseconds(long stopwatchTicks)
+    {
+      return stopwatchTicks * 1000.0 / Stopwatch.Frequency;
+    }
+
+
+    private static long sNumClassificationRequests = 0;
+    private static long sClassificationTicks = 0;
+    private static long sNumParseSpanCalls = 0;
+    private static long sNumParseSpanCacheHits = 0;
+    private static long sNumCommentExtractions = 0;
+    private static long sCommentExtractionTicks = 0;
+    private static long sNumParseCalls = 0;
+    private static long sParseTicks = 0;
+    private static long sNumRegexTimeouts = 0;
+  }
+}
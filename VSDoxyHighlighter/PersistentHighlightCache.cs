@@ -0,0 +1,265 @@
+using Microsoft.VisualStudio.Text;
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.IO;
+using System.Linq;
+using System.Security.Cryptography;
+using System.Text;
+
+namespace VSDoxyHighlighter
+{
+  /// <summary>
+  /// Persists the classification results of whole documents across Visual Studio sessions, as sidecar files
+  /// in the local application data folder. Re-opening an unchanged file then restores the full highlighting
+  /// from the sidecar file, without running the comment extraction or the parser at all. This is especially
+  /// worthwhile for large, stable files (think of a rarely edited 1 MB API header), where deriving everything
+  /// from scratch takes a noticeable amount of time on every single restart of Visual Studio.
+  ///
+  /// A sidecar file is keyed by a hash of the document content and by a hash of the configuration that
+  /// influences the classification results (enabled comment types and the Doxygen commands configuration).
+  /// If either does not match on load, the sidecar file is simply ignored and the ordinary on-demand
+  /// classification (or the whole document pre-warm) takes over. So a stale or corrupted sidecar file can
+  /// never lead to wrong highlighting, only to the same work as without the cache.
+  ///
+  /// All functions here are safe to call from any thread and swallow IO errors: The sidecar files are a pure
+  /// optimization, and e.g. a full disk or an anti-virus locking a file must not break the extension.
+  /// </summary>
+  public static class PersistentHighlightCache
+  {
+    /// <summary>
+    /// If non-null, sidecar files get written to and read from this directory instead of the local
+    /// application data folder. Intended for the automated tests, so that they neither touch nor depend
+    /// on the cache of an actual Visual Studio installation on the machine running the tests.
+    /// </summary>
+    public static string CacheDirectoryOverride = null;
+
+
+    /// <summary>
+    /// Attempts to load the classification results for the document with the given file path and content.
+    /// Returns null if no sidecar file exists, or if it was written for a different document content or
+    /// configuration, or if it cannot be read or is corrupted.
+    /// </summary>
+    public static Dictionary<Span, List<FormattedFragmentGroup>> TryLoad(
+        string documentFilePath, string documentText, int configHash)
+    {
+      try {
+        string cacheFilePath = GetCacheFilePathForDocument(documentFilePath);
+        if (!File.Exists(cacheFilePath)) {
+          return null;
+        }
+
+        using (var stream = new FileStream(cacheFilePath, FileMode.Open, FileAccess.Read, FileShare.Read))
+        using (var reader = new BinaryReader(stream)) {
+          if (reader.ReadInt32() != cMagic || reader.ReadInt32() != cFormatVersion) {
+            return null;
+          }
+          if (reader.ReadInt32() != configHash) {
+            return null; // Written with different settings (e.g. other commands or enabled comment types).
+          }
+          if (reader.ReadInt32() != documentText.Length) {
+            return null; // Cheap check before hashing: The document was edited since the file got written.
+          }
+          byte[] storedContentHash = reader.ReadBytes(cContentHashNumBytes);
+          if (!storedContentHash.SequenceEqual(HashDocumentContent(documentText))) {
+            return null;
+          }
+
+          int numEntries = reader.ReadInt32();
+          var entries = new Dictionary<Span, List<FormattedFragmentGroup>>(numEntries);
+          for (int entryIdx = 0; entryIdx < numEntries; ++entryIdx) {
+            int spanStart = reader.ReadInt32();
+            int spanLength = reader.ReadInt32();
+            if (spanStart < 0 || spanLength < 0 || spanStart + spanLength > documentText.Length) {
+              return null; // Corrupted file.
+            }
+
+            int numGroups = reader.ReadInt32();
+            var groups = new List<FormattedFragmentGroup>(numGroups);
+            for (int groupIdx = 0; groupIdx < numGroups; ++groupIdx) {
+              int numFragments = reader.ReadInt32();
+              if (numFragments <= 0) {
+                return null; // Corrupted file; a FormattedFragmentGroup is never empty.
+              }
+              var fragments = new List<FormattedFragment>(numFragments);
+              for (int fragmentIdx = 0; fragmentIdx < numFragments; ++fragmentIdx) {
+                int fragmentStart = reader.ReadInt32();
+                int fragmentLength = reader.ReadInt32();
+                uint classification = reader.ReadUInt32(); // ClassificationEnum is backed by uint.
+                if (fragmentStart < 0 || fragmentLength <= 0 || fragmentStart + fragmentLength > documentText.Length
+                    || !Enum.IsDefined(typeof(ClassificationEnum), classification)) {
+                  return null; // Corrupted file.
+                }
+                fragments.Add(new FormattedFragment(fragmentStart, fragmentLength, (ClassificationEnum)classification));
+              }
+              groups.Add(new FormattedFragmentGroup(fragments));
+            }
+
+            entries[new Span(spanStart, spanLength)] = groups;
+          }
+
+          return entries;
+        }
+      }
+      catch (Exception ex) {
+        Debug.WriteLine($"VSDoxyHighlighter: Failed to load persistent highlight cache: {ex.Message}");
+        return null;
+      }
+    }
+
+
+    /// <summary>
+    /// Writes the given classification results for the document with the given file path and content to the
+    /// sidecar file, replacing any previous one. The entries are expected in snapshot coordinates of the
+    /// snapshot from which <paramref name="documentText"/> was taken.
+    /// </summary>
+    public static void Save(
+        string documentFilePath, string documentText, int configHash,
+        List<KeyValuePair<Span, List<FormattedFragmentGroup>>> entries)
+    {
+      try {
+        Directory.CreateDirectory(GetCacheDirectory());
+        string cacheFilePath = GetCacheFilePathForDocument(documentFilePath);
+
+        // Write to a temporary file first and rename it afterwards, so that a crash or a parallel VS
+        // instance can never leave a half-written sidecar file behind under the final name.
+        string tempFilePath = cacheFilePath + ".tmp";
+        using (var stream = new FileStream(tempFilePath, FileMode.Create, FileAccess.Write, FileShare.None))
+        using (var writer = new BinaryWriter(stream)) {
+          writer.Write(cMagic);
+          writer.Write(cFormatVersion);
+          writer.Write(configHash);
+          writer.Write(documentText.Length);
+          writer.Write(HashDocumentContent(documentText));
+
+          writer.Write(entries.Count);
+          foreach (KeyValuePair<Span, List<FormattedFragmentGroup>> entry in entries) {
+            writer.Write(entry.Key.Start);
+            writer.Write(entry.Key.Length);
+            writer.Write(entry.Value.Count);
+            foreach (FormattedFragmentGroup group in entry.Value) {
+              writer.Write(group.Fragments.Count);
+              foreach (FormattedFragment fragment in group.Fragments) {
+                writer.Write(fragment.StartIndex);
+                writer.Write(fragment.Length);
+                writer.Write((uint)fragment.Classification);
+              }
+            }
+          }
+        }
+
+        File.Delete(cacheFilePath);
+        File.Move(tempFilePath, cacheFilePath);
+
+        CleanupOldCacheFiles();
+      }
+      catch (Exception ex) {
+        Debug.WriteLine($"VSDoxyHighlighter: Failed to save persistent highlight cache: {ex.Message}");
+      }
+    }
+
+
+    /// <summary>
+    /// Computes a hash of everything in the configuration that influences the classification results.
+    /// A sidecar file written with a different configuration hash gets ignored on load.
+    /// </summary>
+    public static int ComputeConfigHash(IGeneralOptions options)
+    {
+      // FNV-1a. No cryptographic strength needed; a collision merely causes outdated highlighting until the
+      // first edit or reclassification, and only if the user changed the settings in a colliding way.
+      uint hash = 2166136261;
+      void Mix(int value)
+      {
+        unchecked {
+          hash = (hash ^ (uint)value) * 16777619;
+        }
+      }
+
+      Mix(cFormatVersion);
+      foreach (CommentType commentType in Enum.GetValues(typeof(CommentType))) {
+        if (commentType != CommentType.Unknown) {
+          Mix(options.IsEnabledInCommentType(commentType) ? 1 : 0);
+        }
+      }
+      foreach (DoxygenCommandInConfig cmd in options.DoxygenCommandsConfig) {
+        foreach (char c in cmd.Command) {
+          Mix(c);
+        }
+        Mix((int)cmd.CommandClassification);
+        foreach (ClassificationEnum paramClassification in cmd.ParametersClassifications) {
+          Mix((int)paramClassification);
+        }
+      }
+
+      return unchecked((int)hash);
+    }
+
+
+    private static string GetCacheDirectory()
+    {
+      if (CacheDirectoryOverride != null) {
+        return CacheDirectoryOverride;
+      }
+      return Path.Combine(
+        Environment.GetFolderPath(Environment.SpecialFolder.LocalApplicationData),
+        "VSDoxyHighlighter", "HighlightCache");
+    }
+
+
+    // The name of the sidecar file is derived from the (case-insensitive) full path of the document, so that
+    // the same document always maps to the same sidecar file, without storing any kind of index.
+    private static string GetCacheFilePathForDocument(string documentFilePath)
+    {
+      byte[] pathHash;
+      using (var sha = SHA256.Create()) {
+        pathHash = sha.ComputeHash(Encoding.UTF8.GetBytes(documentFilePath.ToUpperInvariant()));
+      }
+      var name = new StringBuilder(2 * cFileNameHashNumBytes + cCacheFileExtension.Length);
+      for (int idx = 0; idx < cFileNameHashNumBytes; ++idx) {
+        name.Append(pathHash[idx].ToString("x2"));
+      }
+      name.Append(cCacheFileExtension);
+      return Path.Combine(GetCacheDirectory(), name.ToString());
+    }
+
+
+    private static byte[] HashDocumentContent(string documentText)
+    {
+      using (var sha = SHA256.Create()) {
+        byte[] fullHash = sha.ComputeHash(Encoding.UTF8.GetBytes(documentText));
+        Debug.Assert(fullHash.Length == cContentHashNumBytes);
+        return fullHash;
+      }
+    }
+
+
+    // Keeps the cache directory bounded: If there are too many sidecar files, the ones that were unused for
+    // the longest time get deleted. (Loading a sidecar file does not update its last write time, so strictly
+    // speaking this deletes the files that were not re-saved for the longest time. Good enough; the point is
+    // only that closing and never re-opening documents does not grow the directory forever.)
+    private static void CleanupOldCacheFiles()
+    {
+      try {
+        var files = new DirectoryInfo(GetCacheDirectory()).GetFiles("*" + cCacheFileExtension);
+        if (files.Length <= cMaxNumCacheFiles) {
+          return;
+        }
+        foreach (FileInfo file in files.OrderBy(f => f.LastWriteTimeUtc).Take(files.Length - cMaxNumCacheFiles)) {
+          file.Delete();
+        }
+      }
+      catch (Exception ex) {
+        Debug.WriteLine($"VSDoxyHighlighter: Failed to clean up persistent highlight cache: {ex.Message}");
+      }
+    }
+
+
+    private const int cMagic = 0x56444843; // "VDHC"
+    // Bump whenever the file format or the meaning of the stored data changes.
+    private const int cFormatVersion = 1;
+    private const int cContentHashNumBytes = 32;
+    private const int cFileNameHashNumBytes = 16;
+    private const string cCacheFileExtension = ".vsdhc";
+    private const int cMaxNumCacheFiles = 256;
+  }
+}
@@ -73,6 +73,56 @@ namespace VSDoxyHighlighter
       mGeneralOptions = (GeneralOptionsPage)GetDialogPage(typeof(GeneralOptionsPage));
       mDoxygenCommands = new DoxygenCommands(mGeneralOptions);
       mCommentParser = new CommentParser(mDoxygenCommands);
+
+      mGeneralOptions.SettingsChanged += OnSettingsChangedForPerformanceSummary;
+      StartPerformanceSummaryLoopIfEnabled();
+    }
+
+
+    private void OnSettingsChangedForPerformanceSummary(object sender, EventArgs e)
+    {
+      ThreadHelper.ThrowIfNotOnUIThread();
+      StartPerformanceSummaryLoopIfEnabled();
+    }
+
+
+    // If the corresponding setting is enabled, periodically writes the performance summary to our pane in
+    // the output window. The first summary is written immediately, i.e. toggling the setting in the options
+    // serves as "dump the statistics now" trigger. The loop ends itself when the setting gets disabled.
+    private void StartPerformanceSummaryLoopIfEnabled()
+    {
+      ThreadHelper.ThrowIfNotOnUIThread();
+
+      if (!mGeneralOptions.EnablePerformanceLogging || mPerformanceSummaryLoopRunning) {
+        return;
+      }
+      mPerformanceSummaryLoopRunning = true;
+
+      _ = JoinableTaskFactory.RunAsync(async () => {
+        while (mGeneralOptions.EnablePerformanceLogging) {
+          WritePerformanceSummaryToOutputPane();
+          await Task.Delay(cPerformanceSummaryIntervalInMs);
+          await JoinableTaskFactory.SwitchToMainThreadAsync();
+        }
+        mPerformanceSummaryLoopRunning = false;
+      });
+    }
+
+
+    private void WritePerformanceSummaryToOutputPane()
+    {
+      ThreadHelper.ThrowIfNotOnUIThread();
+
+      var outputWindow = ServiceProvider.GlobalProvider.GetService(typeof(SVsOutputWindow)) as IVsOutputWindow;
+      if (outputWindow == null) {
+        return;
+      }
+      if (outputWindow.GetPane(ref mOutputPaneGuid, out IVsOutputWindowPane pane) != Microsoft.VisualStudio.VSConstants.S_OK
+          || pane == null) {
+        outputWindow.CreatePane(ref mOutputPaneGuid, "VSDoxyHighlighter", fInitVisible: 1, fClearWithSolution: 0);
+        outputWindow.GetPane(ref mOutputPaneGuid, out pane);
+      }
+      pane?.OutputStringThreadSafe(PerformanceMetrics.BuildSummary());
     }
 
     protected override void Dispose(bool disposing)
@@ -127,5 +177,10 @@ namespace VSDoxyHighlighter
     private static CommentParser mCommentParser;
 
     private static bool mInLoadPackage = false;
+
+    // Our pane in the output window, used for the performance summaries.
+    private static Guid mOutputPaneGuid = new Guid("8c8e45d4-90d3-4f73-af0d-5e9b84a7c2e1");
+    private bool mPerformanceSummaryLoopRunning = false;
+    private const int cPerformanceSummaryIntervalInMs = 60 * 1000;
   }
 }
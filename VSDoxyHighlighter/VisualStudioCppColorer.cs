@@ -1,5 +1,6 @@
 ﻿using Microsoft.VisualStudio.Text.Tagging;
 using Microsoft.VisualStudio.Text;
+using Microsoft.VisualStudio.Text.Editor;
 using System.Collections.Generic;
 using System;
 using Microsoft.VisualStudio.Shell;
@@ -146,5 +147,201 @@ namespace VSDoxyHighlighter
 
     private bool mDisposed = false;
   }
+
+
+  //==============================================================================
+  // BatchingVSCppColorer
+  //==============================================================================
+
+  /// <summary>
+  /// Decorator around another IVisualStudioCppColorer (in practice DefaultVSCppColorerImpl) that batches the
+  /// requests to the underlying Visual Studio tagger: Visual Studio calls our GetClassificationSpans() line
+  /// by line, and each line resulted in a separate round-trip to the VS cpp tagger (plus additional ones in
+  /// CommentTypeIdentification for previous lines). So rendering a single page of a file issued dozens of
+  /// separate tagger requests. Instead, on the first request for some snapshot, this class fetches the tags
+  /// for the entire region that is visible in any text view of the buffer (plus a margin, so that scrolling
+  /// by a few lines does not immediately require a new fetch) in ONE call, and then serves all subsequent
+  /// requests for the same snapshot from that in-memory batch.
+  ///
+  /// For requests outside of the visible region (e.g. from the background parsing of off-screen spans, or
+  /// from the quick info), the batch gets placed around the requested span instead, so that successive
+  /// requests for nearby lines are again served from memory.
+  ///
+  /// The batch is keyed on the snapshot: As soon as a request comes in for a different snapshot, the batch is
+  /// stale and gets thrown away. The same happens when the VS cpp tagger reports changed tags, since then the
+  /// tags in the batch might no longer be what the tagger would return for the same snapshot (this happens
+  /// regularly, because the tagger parses the file asynchronously).
+  /// </summary>
+  class BatchingVSCppColorer : IVisualStudioCppColorer
+  {
+    public BatchingVSCppColorer(IVisualStudioCppColorer underlyingColorer, ITextBuffer textBuffer)
+    {
+      mUnderlyingColorer = underlyingColorer;
+      mTextBuffer = textBuffer;
+
+      // Note: We subscribe before any of our users can subscribe to our own event. Thus, the batch gets
+      // invalidated before the event is forwarded to the users, ensuring that a user triggering a
+      // reclassification in its handler does not get served outdated tags.
+      mUnderlyingColorer.CppColorerReclassifiedSpan += OnUnderlyingColorerReclassifiedSpan;
+    }
+
+
+    public event EventHandler<SnapshotSpanEventArgs> CppColorerReclassifiedSpan;
+
+
+    public void InitializeLazily()
+    {
+      mUnderlyingColorer.InitializeLazily();
+    }
+
+
+    public void Dispose()
+    {
+      if (mDisposed) {
+        return;
+      }
+      mDisposed = true;
+
+      mUnderlyingColorer.CppColorerReclassifiedSpan -= OnUnderlyingColorerReclassifiedSpan;
+      mUnderlyingColorer.Dispose();
+    }
+
+
+    public IEnumerable<ITagSpan<IClassificationTag>> TryGetTags(NormalizedSnapshotSpanCollection spans)
+    {
+      ThreadHelper.ThrowIfNotOnUIThread();
+
+      if (spans.Count == 0) {
+        return mUnderlyingColorer.TryGetTags(spans);
+      }
+
+      ITextSnapshot snapshot = spans[0].Snapshot;
+      var requestedSpan = Span.FromBounds(spans[0].Span.Start, spans[spans.Count - 1].Span.End);
+
+      if (mBatchedTags == null || mBatchSnapshot != snapshot || !mBatchSpan.Contains(requestedSpan)) {
+        if (!TryFetchBatchForSpan(snapshot, requestedSpan)) {
+          // Could not get the tags for the batch region. Do not simply return null, since the underlying
+          // tagger might still be able to answer the original, smaller request.
+          return mUnderlyingColorer.TryGetTags(spans);
+        }
+      }
+
+      // Serve the request from the batch. We return only the tags overlapping the requested span, mimicking
+      // a direct per-span request to the VS tagger. (Returning the whole batch would also break the
+      // performance assumptions of SplitIntoComments(), which indexes repeatedly into the returned
+      // collection via ElementAt().)
+      var result = new List<ITagSpan<IClassificationTag>>();
+      foreach (ITagSpan<IClassificationTag> tag in mBatchedTags) {
+        if (tag.Span.Span.OverlapsWith(requestedSpan)) {
+          result.Add(tag);
+        }
+        else if (tag.Span.Span.Start > requestedSpan.End) {
+          break; // The tags are sorted by position, so no further tag can overlap the requested span.
+        }
+      }
+      return result;
+    }
+
+
+    /// <summary>
+    /// Fetches the tags for the batch region around the given requested span in one call to the underlying
+    /// colorer, and remembers them in "mBatchedTags". Returns false if the underlying colorer is not (yet)
+    /// able to provide tags.
+    /// </summary>
+    private bool TryFetchBatchForSpan(ITextSnapshot snapshot, Span requestedSpan)
+    {
+      mBatchedTags = null;
+
+      Span batchSpan = ComputeBatchSpan(snapshot, requestedSpan);
+      IEnumerable<ITagSpan<IClassificationTag>> tags
+        = mUnderlyingColorer.TryGetTags(new NormalizedSnapshotSpanCollection(snapshot, batchSpan));
+      if (tags == null) {
+        return false;
+      }
+
+      // Materialize the lazy enumerable: This is the point where the underlying tagger actually does its
+      // work, once for the whole batch region.
+      var tagList = new List<ITagSpan<IClassificationTag>>(tags);
+
+      mBatchedTags = tagList;
+      mBatchSnapshot = snapshot;
+      mBatchSpan = batchSpan;
+      return true;
+    }
+
+
+    /// <summary>
+    /// Returns the region whose tags should be fetched in one go: The union of the regions that are visible
+    /// in the text views of the buffer if the requested span lies within it, and otherwise simply the
+    /// surroundings of the requested span. In both cases a margin of additional lines is added, and the
+    /// region is extended to full lines (the VS tagger effectively operates on whole lines anyway).
+    /// </summary>
+    private Span ComputeBatchSpan(ITextSnapshot snapshot, Span requestedSpan)
+    {
+      int visibleStart = int.MaxValue;
+      int visibleEnd = -1;
+      // Note: Might be null. The tracker only registers document views, but the classifier (and thus this
+      // batching colorer) gets created for any C/C++ buffer, e.g. also for buffers that are shown solely
+      // in a peek definition view. In this case we simply know no visible region.
+      var textViews = CommentTextViewTracker.GetTextViews(mTextBuffer);
+      if (textViews != null) {
+        foreach (ITextView textView in textViews) {
+          // Note: Accessing TextViewLines while the view is in a layout throws. Also, the view might lag
+          // behind and still show an older snapshot; tags of another snapshot are useless for the batch.
+          if (!textView.IsClosed && !textView.InLayout && textView.TextViewLines != null
+              && textView.TextViewLines.FormattedSpan.Snapshot == snapshot) {
+            visibleStart = Math.Min(visibleStart, textView.TextViewLines.FormattedSpan.Span.Start);
+            visibleEnd = Math.Max(visibleEnd, textView.TextViewLines.FormattedSpan.Span.End);
+          }
+        }
+      }
+
+      int batchStart, batchEnd;
+      if (visibleEnd >= 0 && visibleStart <= requestedSpan.Start && requestedSpan.End <= visibleEnd) {
+        (batchStart, batchEnd) = (visibleStart, visibleEnd);
+      }
+      else {
+        (batchStart, batchEnd) = (requestedSpan.Start, requestedSpan.End);
+      }
+
+      // Add the margin and extend to full lines (including the line breaks, since the comment tags of the
+      // VS tagger include the trailing line breaks).
+      ITextSnapshotLine firstLine = snapshot.GetLineFromPosition(Math.Min(batchStart, snapshot.Length));
+      ITextSnapshotLine lastLine = snapshot.GetLineFromPosition(Math.Min(batchEnd, snapshot.Length));
+      int firstLineNumber = Math.Max(0, firstLine.LineNumber - cBatchMarginInLines);
+      int lastLineNumber = Math.Min(snapshot.LineCount - 1, lastLine.LineNumber + cBatchMarginInLines);
+      return Span.FromBounds(
+        snapshot.GetLineFromLineNumber(firstLineNumber).Start,
+        snapshot.GetLineFromLineNumber(lastLineNumber).EndIncludingLineBreak);
+    }
+
+
+    private void OnUnderlyingColorerReclassifiedSpan(object sender, SnapshotSpanEventArgs e)
+    {
+      // The underlying tagger might now return different tags than those in the batch, even for the same
+      // snapshot (it parses the file asynchronously and fires this event when it caught up).
+      mBatchedTags = null;
+      mBatchSnapshot = null;
+
+      CppColorerReclassifiedSpan?.Invoke(this, e);
+    }
+
+
+    // Number of additional lines to fetch above and below the batch region, so that scrolling by a few
+    // lines (or, for off-screen requests, the successive requests for the following lines) can be served
+    // without a new fetch.
+    private const int cBatchMarginInLines = 10;
+
+    private readonly IVisualStudioCppColorer mUnderlyingColorer;
+    private readonly ITextBuffer mTextBuffer;
+
+    // The tags fetched in one go for "mBatchSpan" of "mBatchSnapshot", sorted by position.
+    // Null if no valid batch exists at the moment.
+    private List<ITagSpan<IClassificationTag>> mBatchedTags = null;
+    private ITextSnapshot mBatchSnapshot = null;
+    private Span mBatchSpan;
+
+    private bool mDisposed = false;
+  }
 }
 
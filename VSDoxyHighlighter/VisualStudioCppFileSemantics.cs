@@ -9,6 +9,7 @@ using System.Collections;
 using System.Collections.Generic;
 using System.Diagnostics;
 using System.Linq;
+using System.Linq.Expressions;
 using System.Reflection;
 using System.Runtime.InteropServices;
 
@@ -316,7 +317,15 @@ namespace VSDoxyHighlighter
     }
 
 
-    private bool IsFileCodeModelAvailable() 
+    /// <summary>
+    /// False if the user canceled the dialog of VS that appears while VS is still loading the browsing information,
+    /// or if the file is not part of a project. In this case only the (limited) information of the SemanticTokensCache
+    /// is used.
+    /// </summary>
+    public bool HasFileCodeModel => mFileCodeModel != null;
+
+
+    private bool IsFileCodeModelAvailable()
     {
       return mTextBuffer != null && mVsTextLines != null && mFileCodeModel != null;
     }
@@ -396,6 +405,186 @@ namespace VSDoxyHighlighter
   }
 
 
+  //==============================================================================
+  // CachedVisualStudioCppFileSemantics
+  //==============================================================================
+
+  /// <summary>
+  /// Long-lived wrapper around CppFileSemanticsFromVSCodeModelAndCache that lives on the text buffer and caches
+  /// the query results. Use GetOrCreate() to get the instance for a given text buffer.
+  ///
+  /// Motivation: Constructing a new CppFileSemanticsFromVSCodeModelAndCache means going through the "new to old"
+  /// mapper and getting the FileCodeModel again, and every query hits the slow COM based FileCodeModel. This
+  /// happened on every single completion request before, i.e. every time the user typed a character after e.g.
+  /// "\param". But as long as the code does not change, the answers cannot change either. So we keep one instance
+  /// per text buffer and remember the results of the individual queries, keyed by the query position.
+  ///
+  /// The cached results get thrown away whenever the text buffer changes (detected via the snapshot version) and
+  /// whenever the default VS cpp colorer reclassifies something. The latter indicates that the C++ parsing of VS
+  /// progressed, i.e. that the SemanticTokensCache and the FileCodeModel might know more (or different) things
+  /// than when we cached the result, even though the text itself did not change.
+  ///
+  /// Note: There is no explicit disposal. The instance, its event subscription and the wrapped VS objects are all
+  /// per-buffer and become garbage together with the text buffer once the document gets closed.
+  /// </summary>
+  class CachedVisualStudioCppFileSemantics : IVisualStudioCppFileSemantics
+  {
+    public static CachedVisualStudioCppFileSemantics GetOrCreate(IVsEditorAdaptersFactoryService adapterService, ITextBuffer textBuffer)
+    {
+      ThreadHelper.ThrowIfNotOnUIThread();
+      return textBuffer.Properties.GetOrCreateSingletonProperty(
+        typeof(CachedVisualStudioCppFileSemantics),
+        () => new CachedVisualStudioCppFileSemantics(adapterService, textBuffer));
+    }
+
+
+    private CachedVisualStudioCppFileSemantics(IVsEditorAdaptersFactoryService adapterService, ITextBuffer textBuffer)
+    {
+      ThreadHelper.ThrowIfNotOnUIThread();
+
+      mAdapterService = adapterService;
+      mTextBuffer = textBuffer;
+
+      mVSCppColorer = new DefaultVSCppColorerImpl(textBuffer);
+      mVSCppColorer.CppColorerReclassifiedSpan += OnVSCppColorerReclassifiedSpan;
+    }
+
+
+    public FunctionInfo TryGetFunctionInfoIfNextIsAFunction(SnapshotPoint point)
+    {
+      ThreadHelper.ThrowIfNotOnUIThread();
+      InvalidateCacheIfBufferChanged();
+
+      int cacheKey = CacheKeyFor(point);
+      if (mFunctionInfoCache.TryGetValue(cacheKey, out FunctionInfo cachedInfo)) {
+        return cachedInfo;
+      }
+      // Note: "null" results are cached, too. Asking the FileCodeModel about a point after which no function
+      // comes is just as expensive as asking about a point before a function.
+      FunctionInfo info = GetOrCreateSemantics().TryGetFunctionInfoIfNextIsAFunction(point);
+      mFunctionInfoCache[cacheKey] = info;
+      return info;
+    }
+
+
+    public ClassOrAliasInfo TryGetClassInfoIfNextIsATemplateClassOrAlias(SnapshotPoint point)
+    {
+      ThreadHelper.ThrowIfNotOnUIThread();
+      InvalidateCacheIfBufferChanged();
+
+      int cacheKey = CacheKeyFor(point);
+      if (mClassInfoCache.TryGetValue(cacheKey, out ClassOrAliasInfo cachedInfo)) {
+        return cachedInfo;
+      }
+      ClassOrAliasInfo info = GetOrCreateSemantics().TryGetClassInfoIfNextIsATemplateClassOrAlias(point);
+      mClassInfoCache[cacheKey] = info;
+      return info;
+    }
+
+
+    public MacroInfo TryGetMacroInfoIfNextIsAMacro(SnapshotPoint point)
+    {
+      ThreadHelper.ThrowIfNotOnUIThread();
+      InvalidateCacheIfBufferChanged();
+
+      int cacheKey = CacheKeyFor(point);
+      if (mMacroInfoCache.TryGetValue(cacheKey, out MacroInfo cachedInfo)) {
+        return cachedInfo;
+      }
+      MacroInfo info = GetOrCreateSemantics().TryGetMacroInfoIfNextIsAMacro(point);
+      mMacroInfoCache[cacheKey] = info;
+      return info;
+    }
+
+
+    public int TryGetEndPositionOfCppElementBefore(SnapshotPoint point, uint withinNumLinesBefore)
+    {
+      ThreadHelper.ThrowIfNotOnUIThread();
+      InvalidateCacheIfBufferChanged();
+
+      if (mEndPositionCache.TryGetValue((point.Position, withinNumLinesBefore), out int cachedPosition)) {
+        return cachedPosition;
+      }
+      int position = GetOrCreateSemantics().TryGetEndPositionOfCppElementBefore(point, withinNumLinesBefore);
+      mEndPositionCache[(point.Position, withinNumLinesBefore)] = position;
+      return position;
+    }
+
+
+    /// <summary>
+    /// The results are cached per line rather than per exact position: All queries originate from inside a
+    /// comment that precedes the code element in question (the completion session and the speculative pre-fetch
+    /// while the caret idles in the comment), and two points on the same line within such a comment resolve to
+    /// the same next code element. Keying by line is what makes the pre-fetch effective in the first place,
+    /// because the idle caret position and the later completion point are (almost) never exactly the same, but
+    /// they usually are on the same line.
+    /// </summary>
+    private int CacheKeyFor(SnapshotPoint point)
+    {
+      return point.GetContainingLineNumber();
+    }
+
+
+    private CppFileSemanticsFromVSCodeModelAndCache GetOrCreateSemantics()
+    {
+      ThreadHelper.ThrowIfNotOnUIThread();
+
+      // If the FileCodeModel was unavailable when we constructed the instance (e.g. because VS was still loading
+      // the browsing information and the user canceled the corresponding dialog), we try again to get it for every
+      // query, by constructing a new instance. That mimics the behavior from before the cache existed, where a new
+      // instance got constructed for every completion request.
+      if (mSemantics == null || !mSemantics.HasFileCodeModel) {
+        mSemantics = new CppFileSemanticsFromVSCodeModelAndCache(mAdapterService, mTextBuffer);
+      }
+      return mSemantics;
+    }
+
+
+    private void InvalidateCacheIfBufferChanged()
+    {
+      int currentVersion = mTextBuffer.CurrentSnapshot.Version.VersionNumber;
+      if (currentVersion != mVersionNumberOfCache) {
+        mVersionNumberOfCache = currentVersion;
+        ClearCachedResults();
+      }
+    }
+
+
+    private void OnVSCppColorerReclassifiedSpan(object sender, SnapshotSpanEventArgs e)
+    {
+      // The VS cpp colorer fires this after VS parsed (a part of) the file again. So the semantic information
+      // might have changed even though the text did not (e.g. a declaration in an included header changed, or
+      // VS simply finished its initial parse). Throw away the cached results to be on the safe side. The next
+      // completion request then asks VS again.
+      ClearCachedResults();
+    }
+
+
+    private void ClearCachedResults()
+    {
+      mFunctionInfoCache.Clear();
+      mClassInfoCache.Clear();
+      mMacroInfoCache.Clear();
+      mEndPositionCache.Clear();
+    }
+
+
+    private readonly IVsEditorAdaptersFactoryService mAdapterService;
+    private readonly ITextBuffer mTextBuffer;
+    private readonly IVisualStudioCppColorer mVSCppColorer;
+
+    private CppFileSemanticsFromVSCodeModelAndCache mSemantics = null;
+    private int mVersionNumberOfCache = -1;
+
+    // Cached query results, keyed by the line of the query point (see CacheKeyFor()). The dictionaries stay small
+    // in practice: They get cleared on every edit, and between two edits only very few lines get queried.
+    private readonly Dictionary<int, FunctionInfo> mFunctionInfoCache = new Dictionary<int, FunctionInfo>();
+    private readonly Dictionary<int, ClassOrAliasInfo> mClassInfoCache = new Dictionary<int, ClassOrAliasInfo>();
+    private readonly Dictionary<int, MacroInfo> mMacroInfoCache = new Dictionary<int, MacroInfo>();
+    private readonly Dictionary<(int position, uint numLines), int> mEndPositionCache = new Dictionary<(int position, uint numLines), int>();
+  }
+
+
   //==============================================================================
   // CppFileSemanticsFromSemanticTokensCache
   //==============================================================================
@@ -510,18 +699,19 @@ namespace VSDoxyHighlighter
       {
         mSemanticsTokenCache = semanticsTokenCache;
         Debug.Assert(mSemanticsTokenCache != null);
-        mGetTokensMethod = mSemanticsTokenCache?.GetType().GetMethod("GetTokens");
+        MethodInfo getTokensMethod = mSemanticsTokenCache?.GetType().GetMethod("GetTokens");
+        if (getTokensMethod != null) {
+          mGetTokensCaller = CreateGetTokensCaller(getTokensMethod);
+        }
       }
 
       public IEnumerable<SemanticToken> GetTokens(NormalizedSnapshotSpanCollection spans)
       {
-        if (mSemanticsTokenCache == null || mGetTokensMethod == null) {
+        if (mSemanticsTokenCache == null || mGetTokensCaller == null) {
           yield break;
         }
 
-        int outVersion = 0;
-        object[] args = new object[] { spans, outVersion };
-        IEnumerable allTokens = mGetTokensMethod.Invoke(mSemanticsTokenCache, args) as IEnumerable;
+        IEnumerable allTokens = mGetTokensCaller(mSemanticsTokenCache, spans);
         if (allTokens != null) {
           foreach (object token in allTokens) {
             if (token != null) {
@@ -538,8 +728,8 @@ namespace VSDoxyHighlighter
         if (mKindGetter == null || mSpanGetter == null) {
           // semanticTokenType == class Microsoft.VisualStudio.VC.SemanticTokensCache.SemanticToken
           var semanticTokenType = semanticToken.GetType();
-          mKindGetter = semanticTokenType.GetProperty("Kind");
-          mSpanGetter = semanticTokenType.GetProperty("Span");
+          mKindGetter = CreatePropertyGetter(semanticTokenType, "Kind");
+          mSpanGetter = CreatePropertyGetter(semanticTokenType, "Span");
         }
 
         if (mKindGetter == null || mSpanGetter == null) {
@@ -547,8 +737,8 @@ namespace VSDoxyHighlighter
           return null;
         }
 
-        var kind = mKindGetter.GetValue(semanticToken);
-        var span = mSpanGetter.GetValue(semanticToken);
+        var kind = mKindGetter(semanticToken);
+        var span = mSpanGetter(semanticToken);
         if (kind == null || span == null) {
           Debug.Assert(false);
           return null;
@@ -566,10 +756,81 @@ namespace VSDoxyHighlighter
         return new SemanticToken { SemanticTokenKind = kindEnum, Span = (SnapshotSpan)span };
       }
 
+      /// <summary>
+      /// Binds the given "GetTokens" method of the VS SemanticTokensCache into a compiled delegate. We call the
+      /// method for every query, so going through MethodInfo.Invoke() every time (which validates and boxes the
+      /// arguments on each call) is noticeably slower than the plain indirect call that we get from the compiled
+      /// expression. The signature of the method is "GetTokens(NormalizedSnapshotSpanCollection spans, out int version)",
+      /// but since it is a VS internal, we build the argument list from the actual parameters to be a bit more
+      /// robust against future VS versions (additional parameters simply get their default value).
+      /// </summary>
+      private static Func<object, NormalizedSnapshotSpanCollection, IEnumerable> CreateGetTokensCaller(MethodInfo method)
+      {
+        try {
+          ParameterInfo[] parameters = method.GetParameters();
+          if (parameters.Length == 0) {
+            Debug.Assert(false);
+            return null;
+          }
+
+          var cacheParam = Expression.Parameter(typeof(object), "cache");
+          var spansParam = Expression.Parameter(typeof(NormalizedSnapshotSpanCollection), "spans");
+
+          // Out/ref parameters (such as the "out int version") need an actual local variable. Locals of an
+          // expression block are default-initialized, which is what we want for all parameters but the first.
+          var locals = new List<ParameterExpression>();
+          foreach (ParameterInfo param in parameters) {
+            Type paramType = param.ParameterType.IsByRef ? param.ParameterType.GetElementType() : param.ParameterType;
+            locals.Add(Expression.Variable(paramType, param.Name));
+          }
+
+          var body = Expression.Block(
+            typeof(IEnumerable),
+            locals,
+            Expression.Assign(locals[0], Expression.Convert(spansParam, locals[0].Type)),
+            Expression.Convert(
+              Expression.Call(Expression.Convert(cacheParam, method.DeclaringType), method, locals),
+              typeof(IEnumerable)));
+
+          return Expression.Lambda<Func<object, NormalizedSnapshotSpanCollection, IEnumerable>>(
+            body, cacheParam, spansParam).Compile();
+        }
+        catch (Exception ex) {
+          // Very unlikely, but who knows what a future VS version does. Fall back to plain reflection, which is
+          // slower but always works.
+          ActivityLog.LogWarning("VSDoxyHighlighter", $"Failed to compile delegate for 'GetTokens()': {ex.ToString()}");
+          return (cache, spans) => method.Invoke(cache, new object[] { spans, 0 }) as IEnumerable;
+        }
+      }
+
+      /// <summary>
+      /// Binds the getter of the given property into a compiled delegate, for the same performance reason as in
+      /// CreateGetTokensCaller(): The getters are called twice per token, and a query can touch many tokens.
+      /// </summary>
+      private static Func<object, object> CreatePropertyGetter(Type type, string propertyName)
+      {
+        PropertyInfo property = type.GetProperty(propertyName);
+        if (property == null) {
+          return null;
+        }
+
+        try {
+          var objParam = Expression.Parameter(typeof(object), "obj");
+          var body = Expression.Convert(
+            Expression.Property(Expression.Convert(objParam, type), property),
+            typeof(object));
+          return Expression.Lambda<Func<object, object>>(body, objParam).Compile();
+        }
+        catch (Exception ex) {
+          ActivityLog.LogWarning("VSDoxyHighlighter", $"Failed to compile getter for '{propertyName}': {ex.ToString()}");
+          return obj => property.GetValue(obj);
+        }
+      }
+
       private readonly object mSemanticsTokenCache = null;
-      private readonly MethodInfo mGetTokensMethod = null;
-      private PropertyInfo mKindGetter = null;
-      private PropertyInfo mSpanGetter = null;
+      private readonly Func<object, NormalizedSnapshotSpanCollection, IEnumerable> mGetTokensCaller = null;
+      private Func<object, object> mKindGetter = null;
+      private Func<object, object> mSpanGetter = null;
     }
 
 